@@ -0,0 +1,158 @@
+/*******************************************************************************************
+*
+*   raylib [audio] example - Mixing benchmark (offline rendering)
+*
+*   NOTE: Voices are mixed offline with RenderAudioFrames(), no audio hardware is required,
+*   volume and pan are changed every frame so mixing kernels apply gain ramps on every voice
+*
+*   NOTE: Scalar mixing kernels can be measured compiling raylib with RAUDIO_NO_SIMD,
+*   voices are not limited by default, so all playing voices are mixed
+*
+*   Example originally created with raylib 5.5, last time updated with raylib 5.5
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2024 mdavisprog (@mdavisprog)
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include <math.h>           // Required for: sinf(), fabsf()
+
+#define SAMPLE_RATE         48000       // Offline rendering sample rate
+#define RENDER_FRAMES        4800       // Frames rendered for every voices count each frame (100 ms)
+#define MAX_VOICES             64       // Maximum voices mixed
+#define CONFIG_COUNT            4       // Number of voices counts measured
+#define MEASURE_FRAMES         30       // Frames measured before updating mixing cost
+
+static const int voiceCounts[CONFIG_COUNT] = { 8, 16, 32, 64 };
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raylib [audio] example - mixing benchmark");
+
+    InitAudioDeviceOffline(SAMPLE_RATE);    // Initialize audio device for offline rendering
+
+    // Generate a 2 seconds mono tone, converted to mixing format (f32 stereo) at loading
+    Wave wave = { 0 };
+    wave.frameCount = 2*SAMPLE_RATE;
+    wave.sampleRate = SAMPLE_RATE;
+    wave.sampleSize = 16;
+    wave.channels = 1;
+    wave.data = MemAlloc(wave.frameCount*sizeof(short));
+
+    short *samples = (short *)wave.data;
+    for (unsigned int i = 0; i < wave.frameCount; i++) samples[i] = (short)(8000.0f*sinf(2.0f*PI*440.0f*i/SAMPLE_RATE));
+
+    Sound sound = LoadSoundFromWave(wave);
+    UnloadWave(wave);
+
+    Sound voices[MAX_VOICES] = { 0 };
+    for (int i = 0; i < MAX_VOICES; i++) voices[i] = LoadSoundAlias(sound);
+
+    static float frames[RENDER_FRAMES*2] = { 0 };   // Rendered frames, interleaved stereo
+
+    double configTime[CONFIG_COUNT] = { 0 };        // Rendering time accumulated since last cost update
+    float voiceCost[CONFIG_COUNT] = { 0 };          // Mixing cost per voice and frame (nanoseconds)
+    int frameCounter = 0;
+
+    SetTargetFPS(60);               // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())    // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        // Render every voices count, voices are started before measuring time
+        int voicesPlaying = 0;
+
+        for (int i = 0; i < CONFIG_COUNT; i++)
+        {
+            for (; voicesPlaying < voiceCounts[i]; voicesPlaying++) PlaySound(voices[voicesPlaying]);
+
+            // Change volume and pan of every voice, mixer ramps gains along rendered frames
+            // NOTE: Volume is scaled so all voices playing the same tone in phase do not clip
+            for (int v = 0; v < voicesPlaying; v++)
+            {
+                SetSoundVolume(voices[v], (0.5f + 0.5f*sinf((float)(frameCounter + v)))*4.0f/MAX_VOICES);
+                SetSoundPan(voices[v], 0.5f + 0.5f*sinf((float)(frameCounter*3 + v)));
+            }
+
+            double time = GetTime();
+            RenderAudioFrames(frames, RENDER_FRAMES);
+            configTime[i] += (GetTime() - time);
+        }
+
+        for (int i = 0; i < voicesPlaying; i++) StopSound(voices[i]);
+
+        frameCounter++;
+
+        if (frameCounter == MEASURE_FRAMES)
+        {
+            for (int i = 0; i < CONFIG_COUNT; i++)
+            {
+                voiceCost[i] = (float)(configTime[i]/MEASURE_FRAMES/RENDER_FRAMES/voiceCounts[i]*1e9);
+                configTime[i] = 0.0;
+            }
+
+            frameCounter = 0;
+        }
+
+        // Get maximum cost to scale bars
+        float maxCost = 1.0f;
+        for (int i = 0; i < CONFIG_COUNT; i++) if (voiceCost[i] > maxCost) maxCost = voiceCost[i];
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            DrawText(TextFormat("MIXING COST PER VOICE (%i FRAMES AT %i HZ)", RENDER_FRAMES, SAMPLE_RATE), 20, 20, 20, DARKGRAY);
+
+            for (int i = 0; i < CONFIG_COUNT; i++)
+            {
+                int y = 80 + i*70;
+
+                DrawText(TextFormat("%i voices", voiceCounts[i]), 20, y, 20, GRAY);
+                DrawRectangle(160, y - 4, (int)(voiceCost[i]/maxCost*420.0f), 30, MAROON);
+                DrawText(TextFormat("%.2f ns/frame", voiceCost[i]), 600, y, 20, DARKGRAY);
+                DrawText(TextFormat("%.1f us per 10 ms block", voiceCost[i]*voiceCounts[i]*(SAMPLE_RATE/100)/1000.0f), 600, y + 24, 10, GRAY);
+            }
+
+            // Draw first rendered frames waveform (left channel), it must not clip
+            DrawRectangleLines(20, 360, 760, 70, LIGHTGRAY);
+            for (int i = 0; i < 760; i++)
+            {
+                float sample = frames[i*2];
+                DrawRectangle(20 + i, 395 - (int)(sample*35.0f), 1, 1, (fabsf(sample) > 1.0f)? RED : DARKBLUE);
+            }
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    for (int i = 0; i < MAX_VOICES; i++) UnloadSoundAlias(voices[i]);
+    UnloadSound(sound);     // Unload sound data
+
+    CloseAudioDevice();     // Close audio device
+
+    CloseWindow();          // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
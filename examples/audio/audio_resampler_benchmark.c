@@ -0,0 +1,213 @@
+/*******************************************************************************************
+*
+*   raylib [audio] example - Resampler quality benchmark (cost per voice and aliasing)
+*
+*   NOTE: Voices are mixed offline with RenderAudioFrames(), no audio hardware is required,
+*   every voice pitch is modulated every frame, as it would be done for engine sounds
+*
+*   NOTE: Aliasing is measured pitching up a 18 kHz tone by 1.5, output tone is over Nyquist
+*   frequency (24 kHz at 48 kHz), so everything left in the output is aliasing
+*
+*   Example originally created with raylib 5.5, last time updated with raylib 5.5
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2024 mdavisprog (@mdavisprog)
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include <math.h>           // Required for: sinf(), sqrtf(), log10f()
+
+#define SAMPLE_RATE         48000       // Offline rendering sample rate
+#define WAVE_SAMPLE_RATE    22050       // Engine sound wave sample rate
+#define RENDER_FRAMES        4800       // Frames rendered for every quality each frame (100 ms)
+#define MAX_VOICES             32       // Voices mixed for every quality
+#define QUALITY_COUNT           3       // Number of resampling qualities measured
+#define MEASURE_FRAMES         30       // Frames measured before updating mixing cost
+
+static const char *qualityNames[QUALITY_COUNT] = { "AUDIO_RESAMPLE_LINEAR", "AUDIO_RESAMPLE_SINC_MEDIUM", "AUDIO_RESAMPLE_SINC_HIGH" };
+
+//------------------------------------------------------------------------------------
+// Module functions declaration
+//------------------------------------------------------------------------------------
+static Wave GenWaveTone(int sampleRate, float frequency, float seconds);    // Generate a mono tone wave (16 bit)
+static float GetAliasingLevel(Sound tone, float *frames);                   // Get aliasing level of a tone pitched over Nyquist frequency (dB)
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raylib [audio] example - resampler quality benchmark");
+
+    InitAudioDeviceOffline(SAMPLE_RATE);    // Initialize audio device for offline rendering
+
+    // Sounds are kept at their sample rate, so they are always resampled at mixing time
+    SetSoundStorageFormat(SOUND_STORAGE_NATIVE);
+
+    Wave wave = GenWaveTone(WAVE_SAMPLE_RATE, 110.0f, 2.0f);
+    Sound sound = LoadSoundFromWave(wave);
+    UnloadWave(wave);
+
+    wave = GenWaveTone(SAMPLE_RATE, 18000.0f, 0.5f);
+    Sound tone = LoadSoundFromWave(wave);
+    UnloadWave(wave);
+
+    Sound voices[MAX_VOICES] = { 0 };
+    for (int i = 0; i < MAX_VOICES; i++)
+    {
+        voices[i] = LoadSoundAlias(sound);
+        SetSoundVolume(voices[i], 1.0f/MAX_VOICES);
+    }
+
+    static float frames[RENDER_FRAMES*2] = { 0 };   // Rendered frames, interleaved stereo
+
+    // Measure aliasing of every quality once, it does not change
+    float aliasing[QUALITY_COUNT] = { 0 };
+    for (int i = 0; i < QUALITY_COUNT; i++)
+    {
+        SetAudioResampleQuality(i);
+        aliasing[i] = GetAliasingLevel(tone, frames);
+    }
+
+    double qualityTime[QUALITY_COUNT] = { 0 };      // Rendering time accumulated since last cost update
+    float voiceCost[QUALITY_COUNT] = { 0 };         // Mixing cost per voice and frame (nanoseconds)
+    int frameCounter = 0;
+
+    SetTargetFPS(60);               // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())    // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        // Render the voices with every quality, voices pitch is modulated before measuring time
+        for (int i = 0; i < QUALITY_COUNT; i++)
+        {
+            SetAudioResampleQuality(i);
+
+            for (int v = 0; v < MAX_VOICES; v++)
+            {
+                PlaySound(voices[v]);
+                SetSoundPitch(voices[v], 1.0f + 0.5f*sinf((float)(frameCounter + v)*0.1f));
+            }
+
+            double time = GetTime();
+            RenderAudioFrames(frames, RENDER_FRAMES);
+            qualityTime[i] += (GetTime() - time);
+
+            for (int v = 0; v < MAX_VOICES; v++) StopSound(voices[v]);
+        }
+
+        frameCounter++;
+
+        if (frameCounter == MEASURE_FRAMES)
+        {
+            for (int i = 0; i < QUALITY_COUNT; i++)
+            {
+                voiceCost[i] = (float)(qualityTime[i]/MEASURE_FRAMES/RENDER_FRAMES/MAX_VOICES*1e9);
+                qualityTime[i] = 0.0;
+            }
+
+            frameCounter = 0;
+        }
+
+        // Get maximum cost to scale bars
+        float maxCost = 1.0f;
+        for (int i = 0; i < QUALITY_COUNT; i++) if (voiceCost[i] > maxCost) maxCost = voiceCost[i];
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            DrawText(TextFormat("RESAMPLING %i HZ TO %i HZ, %i PITCH MODULATED VOICES", WAVE_SAMPLE_RATE, SAMPLE_RATE, MAX_VOICES), 20, 20, 20, DARKGRAY);
+
+            for (int i = 0; i < QUALITY_COUNT; i++)
+            {
+                int y = 80 + i*110;
+
+                DrawText(qualityNames[i], 20, y, 20, GRAY);
+
+                DrawRectangle(20, y + 30, (int)(voiceCost[i]/maxCost*360.0f), 20, MAROON);
+                DrawText(TextFormat("%.2f ns/frame per voice", voiceCost[i]), 20, y + 56, 20, DARKGRAY);
+
+                // Aliasing bar is scaled from 0 dB to -120 dB
+                float level = (aliasing[i] < -120.0f)? -120.0f : aliasing[i];
+                DrawRectangle(420, y + 30, (int)((120.0f + level)/120.0f*360.0f), 20, SKYBLUE);
+                DrawText(TextFormat("aliasing: %.1f dB", aliasing[i]), 420, y + 56, 20, DARKBLUE);
+            }
+
+            DrawText("MIXING COST", 20, 410, 10, MAROON);
+            DrawText("ALIASING LEVEL (LOWER IS BETTER)", 420, 410, 10, DARKBLUE);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    for (int i = 0; i < MAX_VOICES; i++) UnloadSoundAlias(voices[i]);
+    UnloadSound(sound);     // Unload sound data
+    UnloadSound(tone);
+
+    CloseAudioDevice();     // Close audio device
+
+    CloseWindow();          // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
+
+//------------------------------------------------------------------------------------
+// Module functions definition
+//------------------------------------------------------------------------------------
+// Generate a mono tone wave (16 bit)
+static Wave GenWaveTone(int sampleRate, float frequency, float seconds)
+{
+    Wave wave = { 0 };
+    wave.frameCount = (unsigned int)(sampleRate*seconds);
+    wave.sampleRate = sampleRate;
+    wave.sampleSize = 16;
+    wave.channels = 1;
+    wave.data = MemAlloc(wave.frameCount*sizeof(short));
+
+    // NOTE: Time is wrapped every second to keep sinf() precision, frequency must be an integer
+    short *samples = (short *)wave.data;
+    for (unsigned int i = 0; i < wave.frameCount; i++) samples[i] = (short)(16000.0f*sinf(2.0f*PI*frequency*(float)(i%sampleRate)/sampleRate));
+
+    return wave;
+}
+
+// Get aliasing level of a tone pitched over Nyquist frequency (dB)
+// NOTE: Level is relative to the tone level played without pitch
+static float GetAliasingLevel(Sound tone, float *frames)
+{
+    float levels[2] = { 0 };
+
+    for (int i = 0; i < 2; i++)
+    {
+        SetSoundPitch(tone, (i == 0)? 1.0f : 1.5f);
+        PlaySound(tone);
+        RenderAudioFrames(frames, RENDER_FRAMES);
+        StopSound(tone);
+
+        // Skip first frames, resampler filters start from silence
+        float sum = 0.0f;
+        for (int f = 100; f < RENDER_FRAMES; f++) sum += frames[f*2]*frames[f*2];
+        levels[i] = sqrtf(sum/(RENDER_FRAMES - 100));
+    }
+
+    return 20.0f*log10f(levels[1]/levels[0] + 1e-7f);
+}
@@ -0,0 +1,227 @@
+/*******************************************************************************************
+*
+*   raylib [audio] example - Sound playing stress test (multiple threads)
+*
+*   NOTE: This example requires linking with pthreads library on MinGW,
+*   it can be accomplished passing -static parameter to compiler
+*
+*   NOTE: Mixer callback timing is measured on the audio thread with a mixed audio processor,
+*   without audio hardware available miniaudio uses its null backend (device period simulated)
+*
+*   Example originally created with raylib 5.5, last time updated with raylib 5.5
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2024 mdavisprog (@mdavisprog)
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+// WARNING: This example does not build on Windows with MSVC compiler
+#include "pthread.h"                        // POSIX style threads management
+
+#include <stdatomic.h>                      // C11 atomic data types
+#include <stdint.h>                         // Required for: intptr_t
+#include <math.h>                           // Required for: sqrtf()
+
+#define MAX_STRESS_THREADS       4          // Threads calling sound functions concurrently
+#define MAX_SOUND_ALIASES       32          // Sound aliases played by stress threads
+#define MAX_INTERVAL_HISTORY   256          // Mixer callbacks intervals kept for jitter measurement
+
+static Sound aliases[MAX_SOUND_ALIASES] = { 0 };
+
+static atomic_bool stressRunning = true;    // Stress threads calling sound functions
+static atomic_bool threadsClosing = false;  // Stress threads exit request
+static atomic_int soundCalls = 0;           // Sound functions calls done by stress threads
+static atomic_int maxCallTime = 0;          // Slowest PlaySound() call on stress threads (microseconds)
+
+// Mixer callbacks timing, written by the audio thread
+static atomic_int callbackCount = 0;        // Mixer callbacks measured
+static atomic_int intervals[MAX_INTERVAL_HISTORY] = { 0 };  // Latest intervals between callbacks (microseconds)
+static double lastCallbackTime = 0.0;       // Previous callback time, only accessed by the audio thread
+
+//------------------------------------------------------------------------------------
+// Module functions declaration
+//------------------------------------------------------------------------------------
+static void *StressThread(void *arg);                               // Call sound functions as fast as possible
+static void MeasureCallback(void *buffer, unsigned int frames);     // Store interval between mixer callbacks
+static void UpdateMaxValue(atomic_int *value, int candidate);       // Update an atomic maximum value
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raylib [audio] example - sound playing stress test");
+
+    InitAudioDevice();      // Initialize audio device
+    SetMasterVolume(0.2f);
+
+    Sound sound = LoadSound("resources/coin.wav");
+    for (int i = 0; i < MAX_SOUND_ALIASES; i++) aliases[i] = LoadSoundAlias(sound);
+
+    AttachAudioMixedProcessor(MeasureCallback);
+
+    pthread_t threads[MAX_STRESS_THREADS] = { 0 };
+    for (int i = 0; i < MAX_STRESS_THREADS; i++)
+    {
+        if (pthread_create(&threads[i], NULL, &StressThread, (void *)(intptr_t)i) != 0) TraceLog(LOG_ERROR, "Error creating stress thread");
+    }
+
+    int callsPerSecond = 0;
+    int lastSoundCalls = 0;
+    double lastCallsTime = GetTime();
+
+    SetTargetFPS(60);               // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())    // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        if (IsKeyPressed(KEY_SPACE)) atomic_store(&stressRunning, !atomic_load(&stressRunning));
+        if (IsKeyPressed(KEY_R)) atomic_store(&maxCallTime, 0);
+
+        // Update sound calls speed every second
+        if ((GetTime() - lastCallsTime) >= 1.0)
+        {
+            int calls = atomic_load(&soundCalls);
+            callsPerSecond = (int)((calls - lastSoundCalls)/(GetTime() - lastCallsTime));
+            lastSoundCalls = calls;
+            lastCallsTime = GetTime();
+        }
+
+        // Measure jitter on latest callbacks intervals: standard deviation and worst interval
+        int count = atomic_load(&callbackCount);
+        int intervalCount = (count < MAX_INTERVAL_HISTORY)? count : MAX_INTERVAL_HISTORY;
+        float mean = 0.0f;
+        float deviation = 0.0f;
+        int maxInterval = 0;
+
+        for (int i = 0; i < intervalCount; i++)
+        {
+            int interval = atomic_load(&intervals[i]);
+            mean += (float)interval/intervalCount;
+            if (interval > maxInterval) maxInterval = interval;
+        }
+
+        for (int i = 0; i < intervalCount; i++)
+        {
+            float difference = (float)atomic_load(&intervals[i]) - mean;
+            deviation += difference*difference/intervalCount;
+        }
+
+        deviation = sqrtf(deviation);
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            DrawText(TextFormat("STRESS THREADS: %i (%s)", MAX_STRESS_THREADS, atomic_load(&stressRunning)? "RUNNING" : "PAUSED"), 20, 20, 20, DARKGRAY);
+            DrawText(TextFormat("Sound calls: %i/s, slowest PlaySound(): %.3f ms", callsPerSecond, atomic_load(&maxCallTime)/1000.0f), 20, 50, 20, GRAY);
+
+            DrawText(TextFormat("Mixer callbacks: %i", count), 20, 90, 20, GRAY);
+            DrawText(TextFormat("Interval: %.3f ms, jitter: %.3f ms, worst: %.3f ms", mean/1000.0f, deviation/1000.0f, maxInterval/1000.0f), 20, 120, 20, MAROON);
+
+            // Draw latest callbacks intervals, scaled to worst interval
+            DrawRectangleLines(20, 160, 2*MAX_INTERVAL_HISTORY + 4, 220, GRAY);
+            for (int i = 0; (i < intervalCount) && (maxInterval > 0); i++)
+            {
+                int height = atomic_load(&intervals[(count + i)%MAX_INTERVAL_HISTORY])*200/maxInterval;
+                DrawRectangle(22 + i*2, 378 - height, 2, height, (height > 150)? MAROON : SKYBLUE);
+            }
+
+            DrawText("PRESS SPACE to PAUSE/RESUME stress threads", 20, 400, 10, DARKGRAY);
+            DrawText("PRESS R to RESET slowest PlaySound() call", 20, 420, 10, DARKGRAY);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    atomic_store(&threadsClosing, true);
+    for (int i = 0; i < MAX_STRESS_THREADS; i++) pthread_join(threads[i], NULL);
+
+    DetachAudioMixedProcessor(MeasureCallback);
+
+    for (int i = 0; i < MAX_SOUND_ALIASES; i++) UnloadSoundAlias(aliases[i]);
+    UnloadSound(sound);     // Unload sound data
+
+    CloseAudioDevice();     // Close audio device
+
+    CloseWindow();          // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
+
+//------------------------------------------------------------------------------------
+// Module functions definition
+//------------------------------------------------------------------------------------
+// Call sound functions as fast as possible, on sound aliases shared with other threads
+static void *StressThread(void *arg)
+{
+    int index = (int)(intptr_t)arg;
+    int counter = 0;
+
+    while (!atomic_load(&threadsClosing))
+    {
+        if (!atomic_load(&stressRunning))
+        {
+            WaitTime(0.01);
+            continue;
+        }
+
+        Sound alias = aliases[(index*7 + counter)%MAX_SOUND_ALIASES];
+
+        double time = GetTime();
+        PlaySound(alias);
+        UpdateMaxValue(&maxCallTime, (int)((GetTime() - time)*1000000.0));
+
+        SetSoundVolume(alias, 0.2f + (counter%5)*0.2f);
+        SetSoundPitch(alias, 0.8f + (counter%3)*0.2f);
+        if ((counter%4) == 0) StopSound(alias);
+
+        atomic_fetch_add(&soundCalls, ((counter%4) == 0)? 4 : 3);
+        counter++;
+    }
+
+    return NULL;
+}
+
+// Store interval between mixer callbacks, called on the audio thread
+static void MeasureCallback(void *buffer, unsigned int frames)
+{
+    (void)buffer;
+    (void)frames;
+
+    double time = GetTime();
+
+    if (lastCallbackTime > 0.0)
+    {
+        int count = atomic_load(&callbackCount);
+        atomic_store(&intervals[count%MAX_INTERVAL_HISTORY], (int)((time - lastCallbackTime)*1000000.0));
+        atomic_store(&callbackCount, count + 1);
+    }
+
+    lastCallbackTime = time;
+}
+
+// Update an atomic maximum value, value could be modified by other threads
+static void UpdateMaxValue(atomic_int *value, int candidate)
+{
+    int current = atomic_load(value);
+    while ((candidate > current) && !atomic_compare_exchange_weak(value, &current, candidate)) { }
+}
@@ -0,0 +1,201 @@
+/*******************************************************************************************
+*
+*   raylib [audio] example - Sound storage formats benchmark (memory and mixing cost)
+*
+*   NOTE: Sounds are loaded from a 16 bit mono wave at 22050 Hz, usual for sound effects,
+*   SOUND_STORAGE_DEVICE converts it at loading to mixing format (f32 stereo at device rate),
+*   SOUND_STORAGE_NATIVE and SOUND_STORAGE_QOA keep it smaller and convert it at mixing time
+*
+*   NOTE: Voices are mixed offline with RenderAudioFrames(), no audio hardware is required
+*
+*   Example originally created with raylib 5.5, last time updated with raylib 5.5
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2024 mdavisprog (@mdavisprog)
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include <math.h>           // Required for: sinf()
+
+#define SAMPLE_RATE         48000       // Offline rendering sample rate
+#define WAVE_SAMPLE_RATE    22050       // Source wave sample rate
+#define RENDER_FRAMES        4800       // Frames rendered for every storage format each frame (100 ms)
+#define MAX_VOICES             32       // Voices mixed for every storage format
+#define FORMAT_COUNT            3       // Number of storage formats measured
+#define MEASURE_FRAMES         30       // Frames measured before updating mixing cost
+
+static const char *formatNames[FORMAT_COUNT] = { "SOUND_STORAGE_DEVICE", "SOUND_STORAGE_NATIVE", "SOUND_STORAGE_QOA" };
+
+//------------------------------------------------------------------------------------
+// Module functions declaration
+//------------------------------------------------------------------------------------
+static int GetSoundStorageSize(Sound sound, int format);    // Get sound data size for a storage format (bytes)
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raylib [audio] example - sound storage formats benchmark");
+
+    InitAudioDeviceOffline(SAMPLE_RATE);    // Initialize audio device for offline rendering
+
+    // Generate a 2 seconds 16 bit mono sweep
+    Wave wave = { 0 };
+    wave.frameCount = 2*WAVE_SAMPLE_RATE;
+    wave.sampleRate = WAVE_SAMPLE_RATE;
+    wave.sampleSize = 16;
+    wave.channels = 1;
+    wave.data = MemAlloc(wave.frameCount*sizeof(short));
+
+    short *samples = (short *)wave.data;
+    float phase = 0.0f;
+    for (unsigned int i = 0; i < wave.frameCount; i++)
+    {
+        phase += 2.0f*PI*(200.0f + 2000.0f*i/wave.frameCount)/WAVE_SAMPLE_RATE;
+        samples[i] = (short)(8000.0f*sinf(phase));
+    }
+
+    // Load the same wave with every storage format, every format plays its own voices
+    Sound sounds[FORMAT_COUNT] = { 0 };
+    Sound voices[FORMAT_COUNT][MAX_VOICES] = { 0 };
+    int dataSize[FORMAT_COUNT] = { 0 };
+
+    for (int i = 0; i < FORMAT_COUNT; i++)
+    {
+        SetSoundStorageFormat(i);
+        sounds[i] = LoadSoundFromWave(wave);
+        dataSize[i] = GetSoundStorageSize(sounds[i], i);
+
+        for (int v = 0; v < MAX_VOICES; v++)
+        {
+            voices[i][v] = LoadSoundAlias(sounds[i]);
+            SetSoundVolume(voices[i][v], 1.0f/MAX_VOICES);
+        }
+    }
+
+    SetSoundStorageFormat(SOUND_STORAGE_DEVICE);
+    UnloadWave(wave);
+
+    static float frames[RENDER_FRAMES*2] = { 0 };   // Rendered frames, interleaved stereo
+
+    double formatTime[FORMAT_COUNT] = { 0 };        // Rendering time accumulated since last cost update
+    float voiceCost[FORMAT_COUNT] = { 0 };          // Mixing cost per voice and frame (nanoseconds)
+    int frameCounter = 0;
+
+    SetTargetFPS(60);               // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())    // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        // Render the voices of every storage format, voices are started before measuring time
+        for (int i = 0; i < FORMAT_COUNT; i++)
+        {
+            for (int v = 0; v < MAX_VOICES; v++) PlaySound(voices[i][v]);
+
+            double time = GetTime();
+            RenderAudioFrames(frames, RENDER_FRAMES);
+            formatTime[i] += (GetTime() - time);
+
+            for (int v = 0; v < MAX_VOICES; v++) StopSound(voices[i][v]);
+        }
+
+        frameCounter++;
+
+        if (frameCounter == MEASURE_FRAMES)
+        {
+            for (int i = 0; i < FORMAT_COUNT; i++)
+            {
+                voiceCost[i] = (float)(formatTime[i]/MEASURE_FRAMES/RENDER_FRAMES/MAX_VOICES*1e9);
+                formatTime[i] = 0.0;
+            }
+
+            frameCounter = 0;
+        }
+
+        // Get maximum values to scale bars
+        float maxCost = 1.0f;
+        int maxSize = 1;
+        for (int i = 0; i < FORMAT_COUNT; i++)
+        {
+            if (voiceCost[i] > maxCost) maxCost = voiceCost[i];
+            if (dataSize[i] > maxSize) maxSize = dataSize[i];
+        }
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            DrawText(TextFormat("SOUND STORAGE: 2 s, 16 BIT MONO AT %i HZ, %i VOICES", WAVE_SAMPLE_RATE, MAX_VOICES), 20, 20, 20, DARKGRAY);
+
+            for (int i = 0; i < FORMAT_COUNT; i++)
+            {
+                int y = 80 + i*110;
+
+                DrawText(formatNames[i], 20, y, 20, GRAY);
+
+                DrawRectangle(20, y + 30, (int)((float)dataSize[i]/maxSize*360.0f), 20, SKYBLUE);
+                DrawText(TextFormat("%i KB", dataSize[i]/1024), 20, y + 56, 20, DARKBLUE);
+
+                DrawRectangle(420, y + 30, (int)(voiceCost[i]/maxCost*360.0f), 20, MAROON);
+                DrawText(TextFormat("%.2f ns/frame per voice", voiceCost[i]), 420, y + 56, 20, DARKGRAY);
+            }
+
+            DrawText("MEMORY", 20, 410, 10, DARKBLUE);
+            DrawText("MIXING COST", 420, 410, 10, MAROON);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    for (int i = 0; i < FORMAT_COUNT; i++)
+    {
+        for (int v = 0; v < MAX_VOICES; v++) UnloadSoundAlias(voices[i][v]);
+        UnloadSound(sounds[i]);     // Unload sound data
+    }
+
+    CloseAudioDevice();     // Close audio device
+
+    CloseWindow();          // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
+
+//------------------------------------------------------------------------------------
+// Module functions definition
+//------------------------------------------------------------------------------------
+// Get sound data size for a storage format (bytes)
+// NOTE: QOA data size is computed as qoa_encode() does: file header, then frames of 5120 samples
+// per channel with a frame header, LMS state per channel and 64 bit slices of 20 samples per channel
+static int GetSoundStorageSize(Sound sound, int format)
+{
+    int size = sound.frameCount*sound.stream.channels*sound.stream.sampleSize/8;
+
+    if (format == SOUND_STORAGE_QOA)
+    {
+        int frameCount = (sound.frameCount + 5119)/5120;
+        int sliceCount = (sound.frameCount + 19)/20;
+
+        size = 8 + frameCount*(8 + 16*sound.stream.channels) + sliceCount*8*sound.stream.channels;
+    }
+
+    return size;
+}
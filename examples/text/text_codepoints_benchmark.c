@@ -0,0 +1,251 @@
+/*******************************************************************************************
+*
+*   raylib [text] example - Codepoints decoding benchmark
+*
+*   NOTE: Byte-wise baseline is the raylib 5.5 GetCodepointNext() decoder, copied in this example,
+*   GetCodepointNext(), LoadCodepoints() and GetCodepointCount() output is checked against it
+*
+*   Example originally created with raylib 5.5, last time updated with raylib 5.5
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2024 mdavisprog (@mdavisprog)
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include <stdlib.h>         // Required for: malloc(), free()
+#include <string.h>         // Required for: strlen(), memcpy(), memcmp()
+
+#define CORPUS_SIZE     (4*1024*1024)   // Corpus text size in bytes
+#define CORPUS_COUNT    3               // Number of corpora tested
+#define DECODER_COUNT   4               // Number of decoders measured
+#define BENCHMARK_RUNS  5               // Decoding runs per corpus, best time is kept
+
+// Corpus text units, repeated to fill every corpus (UTF-8, save this code file as UTF-8)
+static const char *corpusUnits[CORPUS_COUNT] = {
+    "The quick brown fox jumps over the lazy dog while the log view keeps scrolling. ",
+    "Él pidió un café y una crème brûlée; über Größe läßt sich streiten, ¿verdad? Ça va. ",
+    "いろはにほへと　ちりぬるを、わかよたれそ　つねならむ。日本語の文章とカタカナ。"
+};
+static const char *corpusNames[CORPUS_COUNT] = { "ASCII", "LATIN", "CJK" };
+static const char *decoderNames[DECODER_COUNT] = { "Byte-wise (raylib 5.5)", "GetCodepointNext()", "LoadCodepoints()", "GetCodepointCount()" };
+
+//------------------------------------------------------------------------------------
+// Module functions declaration
+//------------------------------------------------------------------------------------
+static char *LoadCorpus(const char *unit, int size);    // Load corpus text repeating a text unit
+static int GetCodepointNextBytewise(const char *text, int *codepointSize);  // Get next codepoint, raylib 5.5 byte-wise decoder
+static void RunBenchmark(char **corpora, float speeds[][DECODER_COUNT], bool *matches); // Run decoding benchmark (MB/s)
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raylib [text] example - codepoints decoding benchmark");
+
+    char *corpora[CORPUS_COUNT] = { 0 };
+    for (int i = 0; i < CORPUS_COUNT; i++) corpora[i] = LoadCorpus(corpusUnits[i], CORPUS_SIZE);
+
+    float speeds[CORPUS_COUNT][DECODER_COUNT] = { 0 };  // Decoding speed of every decoder (MB/s)
+    bool matches[CORPUS_COUNT] = { 0 };                 // Decoders output matches byte-wise decoding
+
+    RunBenchmark(corpora, speeds, matches);
+
+    SetTargetFPS(60);               // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())    // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        if (IsKeyPressed(KEY_SPACE)) RunBenchmark(corpora, speeds, matches);
+
+        // Get maximum speed to scale bars
+        float maxSpeed = 1.0f;
+        for (int i = 0; i < CORPUS_COUNT; i++)
+        {
+            for (int k = 0; k < DECODER_COUNT; k++) if (speeds[i][k] > maxSpeed) maxSpeed = speeds[i][k];
+        }
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            DrawText(TextFormat("UTF-8 DECODING SPEED (%i MB PER CORPUS)", CORPUS_SIZE/(1024*1024)), 20, 20, 20, DARKGRAY);
+
+            for (int i = 0; i < CORPUS_COUNT; i++)
+            {
+                int y = 60 + i*120;
+                Color colors[DECODER_COUNT] = { GRAY, DARKGRAY, MAROON, DARKBLUE };
+
+                DrawText(corpusNames[i], 20, y, 20, BLACK);
+                DrawText(matches[i]? "OUTPUT MATCHES BYTE-WISE DECODING" : "OUTPUT DOES NOT MATCH BYTE-WISE DECODING",
+                    180, y + 5, 10, matches[i]? DARKGREEN : RED);
+
+                for (int k = 0; k < DECODER_COUNT; k++)
+                {
+                    DrawText(decoderNames[k], 40, y + 26 + k*22, 10, DARKGRAY);
+                    DrawRectangle(180, y + 24 + k*22, (int)(speeds[i][k]/maxSpeed*460.0f), 16, colors[k]);
+                    DrawText(TextFormat("%.0f MB/s", speeds[i][k]), 650, y + 26 + k*22, 10, DARKGRAY);
+                }
+            }
+
+            DrawText("PRESS SPACE to run the benchmark again", 20, screenHeight - 30, 10, GRAY);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    for (int i = 0; i < CORPUS_COUNT; i++) free(corpora[i]);
+
+    CloseWindow();        // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
+
+//------------------------------------------------------------------------------------
+// Module functions definition
+//------------------------------------------------------------------------------------
+// Load corpus text repeating a text unit, up to size bytes
+static char *LoadCorpus(const char *unit, int size)
+{
+    char *text = (char *)malloc(size + 1);
+    int unitLength = (int)strlen(unit);
+    int length = 0;
+
+    while ((length + unitLength) <= size)
+    {
+        memcpy(text + length, unit, unitLength);
+        length += unitLength;
+    }
+
+    text[length] = '\0';
+
+    return text;
+}
+
+// Get next codepoint in a UTF-8 encoded text, raylib 5.5 byte-wise decoder
+// NOTE: Copied from raylib 5.5 GetCodepointNext() as baseline, no overlong sequences or surrogates checks
+static int GetCodepointNextBytewise(const char *text, int *codepointSize)
+{
+    const char *ptr = text;
+    int codepoint = 0x3f;       // Codepoint (defaults to '?')
+    *codepointSize = 1;
+
+    // Get current codepoint and bytes processed
+    if (0xf0 == (0xf8 & ptr[0]))
+    {
+        // 4 byte UTF-8 codepoint
+        if (((ptr[1] & 0xC0) ^ 0x80) || ((ptr[2] & 0xC0) ^ 0x80) || ((ptr[3] & 0xC0) ^ 0x80)) { return codepoint; } // 10xxxxxx checks
+        codepoint = ((0x07 & ptr[0]) << 18) | ((0x3f & ptr[1]) << 12) | ((0x3f & ptr[2]) << 6) | (0x3f & ptr[3]);
+        *codepointSize = 4;
+    }
+    else if (0xe0 == (0xf0 & ptr[0]))
+    {
+        // 3 byte UTF-8 codepoint
+        if (((ptr[1] & 0xC0) ^ 0x80) || ((ptr[2] & 0xC0) ^ 0x80)) { return codepoint; } // 10xxxxxx checks
+        codepoint = ((0x0f & ptr[0]) << 12) | ((0x3f & ptr[1]) << 6) | (0x3f & ptr[2]);
+        *codepointSize = 3;
+    }
+    else if (0xc0 == (0xe0 & ptr[0]))
+    {
+        // 2 byte UTF-8 codepoint
+        if ((ptr[1] & 0xC0) ^ 0x80) { return codepoint; } // 10xxxxxx checks
+        codepoint = ((0x1f & ptr[0]) << 6) | (0x3f & ptr[1]);
+        *codepointSize = 2;
+    }
+    else if (0x00 == (0x80 & ptr[0]))
+    {
+        // 1 byte UTF-8 codepoint
+        codepoint = ptr[0];
+        *codepointSize = 1;
+    }
+
+    return codepoint;
+}
+
+// Run decoding benchmark on every corpus, speeds in MB/s
+// NOTE: Every decoder output is checked against byte-wise decoding
+static void RunBenchmark(char **corpora, float speeds[][DECODER_COUNT], bool *matches)
+{
+    int *codepoints = (int *)malloc(CORPUS_SIZE*sizeof(int));   // Byte-wise decoded codepoints, reference output
+    int *decoded = (int *)malloc(CORPUS_SIZE*sizeof(int));      // GetCodepointNext() decoded codepoints
+
+    for (int i = 0; i < CORPUS_COUNT; i++)
+    {
+        int length = (int)strlen(corpora[i]);
+        double best[DECODER_COUNT] = { 1e9, 1e9, 1e9, 1e9 };
+        int codepointCount = 0;
+
+        matches[i] = true;
+
+        for (int run = 0; run < BENCHMARK_RUNS; run++)
+        {
+            // Decode one codepoint at a time, raylib 5.5 byte-wise decoder
+            double time = GetTime();
+            codepointCount = 0;
+            for (int b = 0; b < length; codepointCount++)
+            {
+                int codepointSize = 0;
+                codepoints[codepointCount] = GetCodepointNextBytewise(corpora[i] + b, &codepointSize);
+                b += codepointSize;
+            }
+            time = GetTime() - time;
+            if (time < best[0]) best[0] = time;
+
+            // Decode one codepoint at a time, current decoder
+            time = GetTime();
+            int count = 0;
+            for (int b = 0; b < length; count++)
+            {
+                int codepointSize = 0;
+                decoded[count] = GetCodepointNext(corpora[i] + b, &codepointSize);
+                b += codepointSize;
+            }
+            time = GetTime() - time;
+            if (time < best[1]) best[1] = time;
+
+            if ((count != codepointCount) || (memcmp(decoded, codepoints, count*sizeof(int)) != 0)) matches[i] = false;
+
+            // Decode all text at once
+            time = GetTime();
+            int *loaded = LoadCodepoints(corpora[i], &count);
+            time = GetTime() - time;
+            if (time < best[2]) best[2] = time;
+
+            if ((count != codepointCount) || (memcmp(loaded, codepoints, count*sizeof(int)) != 0)) matches[i] = false;
+            UnloadCodepoints(loaded);
+
+            // Count codepoints
+            time = GetTime();
+            count = GetCodepointCount(corpora[i]);
+            time = GetTime() - time;
+            if (time < best[3]) best[3] = time;
+
+            if (count != codepointCount) matches[i] = false;
+        }
+
+        if (!matches[i]) TraceLog(LOG_WARNING, "BENCHMARK: [%s] Decoded codepoints do not match byte-wise decoding", corpusNames[i]);
+
+        for (int k = 0; k < DECODER_COUNT; k++) speeds[i][k] = (float)(length/best[k]/1e6);
+    }
+
+    free(codepoints);
+    free(decoded);
+}
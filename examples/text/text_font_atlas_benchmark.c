@@ -0,0 +1,149 @@
+/*******************************************************************************************
+*
+*   raylib [text] example - Font atlas packing benchmark (10000 codepoints)
+*
+*   NOTE: Glyphs are rasterized once with LoadFontData(), then packed with every GenImageFontAtlas()
+*   packing method, codepoints not provided by the font use its missing glyph, packing method 2
+*   packs identical glyphs only once
+*
+*   Example originally created with raylib 5.5, last time updated with raylib 5.5
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2024 mdavisprog (@mdavisprog)
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include <stddef.h>         // Required for: NULL
+
+#define GLYPH_COUNT     10000       // Codepoints rasterized and packed
+#define FONT_SIZE          32       // Glyphs rasterization size
+#define GLYPH_PADDING       4       // Glyphs padding in atlas
+#define METHOD_COUNT        3       // Number of packing methods measured
+
+static const char *methodNames[METHOD_COUNT] = { "0: DEFAULT (ROWS)", "1: SKYLINE (STB_RECT_PACK)", "2: SKYLINE FITTED, SHARED GLYPHS" };
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raylib [text] example - font atlas packing benchmark");
+
+    // Codepoints: ASCII, Hiragana and Katakana, then CJK unified ideographs
+    int *codepoints = (int *)MemAlloc(GLYPH_COUNT*sizeof(int));
+    int count = 0;
+    for (int c = 32; c < 127; c++) codepoints[count++] = c;
+    for (int c = 0x3040; c < 0x3100; c++) codepoints[count++] = c;
+    for (int c = 0x4e00; count < GLYPH_COUNT; c++) codepoints[count++] = c;
+
+    int dataSize = 0;
+    unsigned char *fileData = LoadFileData("resources/DotGothic16-Regular.ttf", &dataSize);
+
+    double time = GetTime();
+    GlyphInfo *glyphs = LoadFontData(fileData, dataSize, FONT_SIZE, codepoints, GLYPH_COUNT, FONT_DEFAULT);
+    float rasterTime = (float)(GetTime() - time)*1000.0f;
+
+    // Pack glyphs with every method, atlas textures are kept for preview
+    Texture2D atlases[METHOD_COUNT] = { 0 };
+    float packTime[METHOD_COUNT] = { 0 };       // Atlas generation time (milliseconds)
+    int atlasSize[METHOD_COUNT] = { 0 };        // Atlas memory size (bytes, GRAY_ALPHA)
+
+    for (int i = 0; i < METHOD_COUNT; i++)
+    {
+        Rectangle *recs = NULL;
+
+        time = GetTime();
+        Image atlas = GenImageFontAtlas(glyphs, &recs, GLYPH_COUNT, FONT_SIZE, GLYPH_PADDING, i);
+        packTime[i] = (float)(GetTime() - time)*1000.0f;
+
+        atlasSize[i] = atlas.width*atlas.height*2;
+        atlases[i] = LoadTextureFromImage(atlas);
+        SetTextureFilter(atlases[i], TEXTURE_FILTER_BILINEAR);
+
+        UnloadImage(atlas);
+        MemFree(recs);
+    }
+
+    UnloadFontData(glyphs, GLYPH_COUNT);
+    UnloadFileData(fileData);
+    MemFree(codepoints);
+
+    int selected = 2;               // Packing method atlas previewed
+
+    SetTargetFPS(60);               // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())    // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        if (IsKeyPressed(KEY_ONE)) selected = 0;
+        else if (IsKeyPressed(KEY_TWO)) selected = 1;
+        else if (IsKeyPressed(KEY_THREE)) selected = 2;
+
+        // Get maximum values to scale bars
+        float maxTime = 1.0f;
+        int maxSize = 1;
+        for (int i = 0; i < METHOD_COUNT; i++)
+        {
+            if (packTime[i] > maxTime) maxTime = packTime[i];
+            if (atlasSize[i] > maxSize) maxSize = atlasSize[i];
+        }
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            DrawText(TextFormat("PACKING %i GLYPHS (%i PX), RASTERIZED IN %.1f MS", GLYPH_COUNT, FONT_SIZE, rasterTime), 20, 20, 20, DARKGRAY);
+
+            for (int i = 0; i < METHOD_COUNT; i++)
+            {
+                int y = 70 + i*110;
+
+                DrawText(methodNames[i], 20, y, 20, (i == selected)? MAROON : GRAY);
+
+                DrawRectangle(20, y + 30, (int)((float)atlasSize[i]/maxSize*200.0f), 20, SKYBLUE);
+                DrawText(TextFormat("%ix%i, %.1f MB", atlases[i].width, atlases[i].height, atlasSize[i]/(1024.0f*1024.0f)), 20, y + 56, 20, DARKBLUE);
+
+                DrawRectangle(240, y + 30, (int)(packTime[i]/maxTime*200.0f), 20, MAROON);
+                DrawText(TextFormat("%.1f ms", packTime[i]), 240, y + 56, 20, DARKGRAY);
+            }
+
+            // Draw selected atlas scaled to preview area, keeping its aspect ratio
+            Texture2D atlas = atlases[selected];
+            float scale = 340.0f/((atlas.width > atlas.height)? atlas.width : atlas.height);
+            DrawRectangle(450, 60, 340, 340, BLACK);
+            DrawTexturePro(atlas, (Rectangle){ 0, 0, (float)atlas.width, (float)atlas.height },
+                (Rectangle){ 450, 60, atlas.width*scale, atlas.height*scale }, (Vector2){ 0, 0 }, 0.0f, WHITE);
+            DrawRectangleLines(450, 60, 340, 340, GRAY);
+
+            DrawText("ATLAS MEMORY", 20, 410, 10, DARKBLUE);
+            DrawText("PACKING TIME", 240, 410, 10, MAROON);
+            DrawText("PRESS 1, 2 or 3 to PREVIEW method atlas", 450, 410, 10, DARKGRAY);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    for (int i = 0; i < METHOD_COUNT; i++) UnloadTexture(atlases[i]);
+
+    CloseWindow();          // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
@@ -0,0 +1,184 @@
+/*******************************************************************************************
+*
+*   raylib [text] example - Glyphs drawing benchmark
+*
+*   Example originally created with raylib 5.5, last time updated with raylib 5.5
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2024 mdavisprog (@mdavisprog)
+*
+********************************************************************************************/
+
+#include "raylib.h"
+#include "rlgl.h"           // Required for: rlDrawRenderBatchActive()
+
+#include <string.h>         // Required for: strcat()
+
+#define BENCHMARK_LINES     30      // Text lines drawn by every method each frame
+#define METHOD_COUNT         4      // Number of text drawing methods measured
+#define MEASURE_FRAMES      30      // Frames measured before updating glyphs speed
+#define FONT_SIZE           10      // Benchmark text font size
+#define LINE_SPACING         2      // Benchmark text line spacing
+
+static const char *methodNames[METHOD_COUNT] = { "DrawTexturePro() per glyph", "DrawTextEx()", "DrawTextCodepoints()", "DrawTextLayout()" };
+
+//------------------------------------------------------------------------------------
+// Module functions declaration
+//------------------------------------------------------------------------------------
+static void DrawTextPerGlyph(Font font, const char *text, Vector2 position, float fontSize, float spacing, Color tint); // Draw text calling DrawTexturePro() for every glyph
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raylib [text] example - glyphs drawing benchmark");
+
+    SetTextLineSpacing(LINE_SPACING);
+
+    // Benchmark text, every method draws the same text at the same position
+    static char text[BENCHMARK_LINES*100] = { 0 };
+    for (int i = 0; i < BENCHMARK_LINES; i++) strcat(text, TextFormat("%02i: THE QUICK BROWN FOX jumps over the lazy dog, 0123456789 {}[]()<>!?\n", i));
+
+    Font font = GetFontDefault();
+    Vector2 position = { 20, 70 };
+
+    int codepointCount = 0;
+    int *codepoints = LoadCodepoints(text, &codepointCount);
+    TextLayout layout = LoadTextLayout(font, text, FONT_SIZE, 1);
+
+    double methodTime[METHOD_COUNT] = { 0 };    // Drawing time accumulated since last speed update
+    float glyphsSpeed[METHOD_COUNT] = { 0 };    // Glyphs drawn per second (millions)
+    int frameCounter = 0;
+
+    SetTargetFPS(60);               // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())    // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        // Get maximum speed to scale bars
+        float maxSpeed = 1.0f;
+        for (int i = 0; i < METHOD_COUNT; i++) if (glyphsSpeed[i] > maxSpeed) maxSpeed = glyphsSpeed[i];
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            // Draw the same text with every method, render batch is drawn inside measured time
+            for (int i = 0; i < METHOD_COUNT; i++)
+            {
+                rlDrawRenderBatchActive();
+                double time = GetTime();
+
+                switch (i)
+                {
+                    case 0: DrawTextPerGlyph(font, text, position, FONT_SIZE, 1, LIGHTGRAY); break;
+                    case 1: DrawTextEx(font, text, position, FONT_SIZE, 1, LIGHTGRAY); break;
+                    case 2: DrawTextCodepoints(font, codepoints, codepointCount, position, FONT_SIZE, 1, LIGHTGRAY); break;
+                    case 3: DrawTextLayout(layout, position, LIGHTGRAY); break;
+                    default: break;
+                }
+
+                rlDrawRenderBatchActive();
+                methodTime[i] += (GetTime() - time);
+            }
+
+            frameCounter++;
+
+            if (frameCounter == MEASURE_FRAMES)
+            {
+                for (int i = 0; i < METHOD_COUNT; i++)
+                {
+                    glyphsSpeed[i] = (float)((double)layout.glyphCount*MEASURE_FRAMES/methodTime[i]/1e6);
+                    methodTime[i] = 0.0;
+                }
+
+                frameCounter = 0;
+            }
+
+            DrawText(TextFormat("GLYPHS DRAWING SPEED (%i GLYPHS PER METHOD)", layout.glyphCount), 20, 20, 20, DARKGRAY);
+
+            DrawRectangle(500, 70, 280, 20 + METHOD_COUNT*60, Fade(RAYWHITE, 0.9f));
+            DrawRectangleLines(500, 70, 280, 20 + METHOD_COUNT*60, GRAY);
+
+            for (int i = 0; i < METHOD_COUNT; i++)
+            {
+                int y = 90 + i*60;
+
+                DrawText(methodNames[i], 515, y, 10, DARKGRAY);
+                DrawRectangle(515, y + 16, (int)(glyphsSpeed[i]/maxSpeed*170.0f), 20, (i == 0)? GRAY : MAROON);
+                DrawText(TextFormat("%.1f M/s", glyphsSpeed[i]), 695, y + 21, 10, DARKGRAY);
+            }
+
+            DrawFPS(screenWidth - 100, 20);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    UnloadTextLayout(layout);
+    UnloadCodepoints(codepoints);
+
+    CloseWindow();        // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
+
+//------------------------------------------------------------------------------------
+// Module functions definition
+//------------------------------------------------------------------------------------
+// Draw text calling DrawTexturePro() for every glyph, glyph quads are built with rotation support
+// NOTE: Font kerning is not considered, default font has no kerning pairs
+static void DrawTextPerGlyph(Font font, const char *text, Vector2 position, float fontSize, float spacing, Color tint)
+{
+    float scaleFactor = fontSize/font.baseSize;
+    float textOffsetX = 0.0f;
+    float textOffsetY = 0.0f;
+
+    for (int i = 0; text[i] != '\0';)
+    {
+        int codepointSize = 0;
+        int codepoint = GetCodepointNext(&text[i], &codepointSize);
+        int index = GetGlyphIndex(font, codepoint);
+
+        if (codepoint == '\n')
+        {
+            textOffsetY += (fontSize + LINE_SPACING);
+            textOffsetX = 0.0f;
+        }
+        else
+        {
+            if ((codepoint != ' ') && (codepoint != '\t'))
+            {
+                Rectangle srcRec = { font.recs[index].x - font.glyphPadding, font.recs[index].y - font.glyphPadding,
+                                     font.recs[index].width + 2.0f*font.glyphPadding, font.recs[index].height + 2.0f*font.glyphPadding };
+                Rectangle dstRec = { position.x + textOffsetX + (font.glyphs[index].offsetX - font.glyphPadding)*scaleFactor,
+                                     position.y + textOffsetY + (font.glyphs[index].offsetY - font.glyphPadding)*scaleFactor,
+                                     srcRec.width*scaleFactor, srcRec.height*scaleFactor };
+
+                DrawTexturePro(font.texture, srcRec, dstRec, (Vector2){ 0, 0 }, 0.0f, tint);
+            }
+
+            if (font.glyphs[index].advanceX == 0) textOffsetX += (font.recs[index].width*scaleFactor + spacing);
+            else textOffsetX += (font.glyphs[index].advanceX*scaleFactor + spacing);
+        }
+
+        i += codepointSize;
+    }
+}
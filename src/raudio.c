@@ -183,6 +183,18 @@ typedef struct tagBITMAPINFOHEADER {
 #include <stdlib.h>                     // Required for: malloc(), free()
 #include <stdio.h>                      // Required for: FILE, fopen(), fclose(), fread()
 #include <string.h>                     // Required for: strcmp() [Used in IsFileExtension(), LoadWaveFromMemory(), LoadMusicStreamFromMemory()]
+#include <math.h>                       // Required for: sin(), sqrt(), fabs(), pow(), log2(), ceil() [Used in resampler]
+
+// Mixing kernels SIMD support, it can be disabled with RAUDIO_NO_SIMD
+#if !defined(RAUDIO_NO_SIMD)
+    #if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 1))
+        #define RAUDIO_MIX_SSE
+        #include <xmmintrin.h>          // Required for: SSE intrinsics [Used in MixAudioSamples(), MixAudioFramesStereoRamp()]
+    #elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+        #define RAUDIO_MIX_NEON
+        #include <arm_neon.h>           // Required for: NEON intrinsics [Used in MixAudioSamples(), MixAudioFramesStereoRamp()]
+    #endif
+#endif
 
 #if defined(RAUDIO_STANDALONE)
     #ifndef TRACELOG
@@ -285,6 +297,10 @@ typedef struct tagBITMAPINFOHEADER {
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
+#ifndef PI
+    #define PI 3.14159265358979323846f
+#endif
+
 #ifndef AUDIO_DEVICE_FORMAT
     #define AUDIO_DEVICE_FORMAT    ma_format_f32    // Device output format (float-32bit)
 #endif
@@ -298,6 +314,51 @@ typedef struct tagBITMAPINFOHEADER {
 #ifndef MAX_AUDIO_BUFFER_POOL_CHANNELS
     #define MAX_AUDIO_BUFFER_POOL_CHANNELS    16    // Audio pool channels
 #endif
+#ifndef AUDIO_VOLUME_RAMP_FRAMES
+    #define AUDIO_VOLUME_RAMP_FRAMES         256    // Audio buffer volume/pan changes ramp length (frames)
+#endif
+#ifndef AUDIO_VOICE_CULL_LEVEL
+    #define AUDIO_VOICE_CULL_LEVEL        0.001f    // Sounds mixing level below this one become virtual
+#endif
+#ifndef AUDIO_RESAMPLER_PHASES
+    #define AUDIO_RESAMPLER_PHASES          1024    // Resampler filter table phases (fractional positions)
+#endif
+#ifndef AUDIO_RESAMPLER_MAX_TAPS
+    #define AUDIO_RESAMPLER_MAX_TAPS          32    // Resampler maximum filter taps (highest quality)
+#endif
+#ifndef AUDIO_RESAMPLER_RATIOS
+    #define AUDIO_RESAMPLER_RATIOS             9    // Resampler sinc filter tables per quality, for downsampling ratios up to 4 (quarter octave steps)
+#endif
+#ifndef AUDIO_RESAMPLER_BLOCK_FRAMES
+    #define AUDIO_RESAMPLER_BLOCK_FRAMES     256    // Resampler input frames read at once
+#endif
+#ifndef AUDIO_OFFLINE_PERIOD_FRAMES
+    #define AUDIO_OFFLINE_PERIOD_FRAMES      512    // Offline rendering frames mixed at once
+#endif
+#ifndef AUDIO_BUS_BLOCK_FRAMES
+    #define AUDIO_BUS_BLOCK_FRAMES           512    // Mixing buses frames processed at once
+#endif
+#ifndef AUDIO_REVERB_SILENCE_LEVEL
+    #define AUDIO_REVERB_SILENCE_LEVEL  0.00001f    // Reverb tail output level below this one is considered silence (-100 dB)
+#endif
+#ifndef AUDIO_SPEED_OF_SOUND
+    #define AUDIO_SPEED_OF_SOUND          343.3f    // Speed of sound for doppler effect (world units per second)
+#endif
+#ifndef AUDIO_COMMAND_QUEUE_SIZE
+    #define AUDIO_COMMAND_QUEUE_SIZE        1024    // Mixer commands queue size, must be a power of two
+#endif
+#ifndef MUSIC_STREAM_DECODER_BUFFER_MS
+    #define MUSIC_STREAM_DECODER_BUFFER_MS   250    // Music stream decoder ring buffer length (milliseconds)
+#endif
+#ifndef MUSIC_STREAM_DECODER_SLEEP_MS
+    #define MUSIC_STREAM_DECODER_SLEEP_MS      5    // Music stream decoder thread wait between ring buffers refills (milliseconds)
+#endif
+#ifndef MUSIC_STREAM_SEEK_INTERVAL_MS
+    #define MUSIC_STREAM_SEEK_INTERVAL_MS    250    // Music stream seek index interval between seek points (milliseconds)
+#endif
+#ifndef MUSIC_MP3_SEEK_LEAD_FRAMES
+    #define MUSIC_MP3_SEEK_LEAD_FRAMES        16    // MP3 seek index maximum lead frames decoded before a seek point
+#endif
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
@@ -338,9 +399,131 @@ typedef enum {
     AUDIO_BUFFER_USAGE_STREAM
 } AudioBufferUsage;
 
+// Music stream decoder state
+// NOTE: Every state transition is owned by a single thread: FINISHED is set by the decoder thread,
+// DRAINED by the mixer once ring buffer is empty and DECODING again by the decoder thread after rewind
+// (or by the mixer when it drops the ring buffer after a seek)
+typedef enum {
+    MUSIC_DECODER_DECODING = 0,     // Decoding frames into ring buffer
+    MUSIC_DECODER_FINISHED,         // Last music frame decoded, waiting for the mixer to drain the ring buffer
+    MUSIC_DECODER_DRAINED           // Ring buffer drained and stream stopped, waiting for the decoder to rewind
+} MusicDecoderState;
+
+// Music stream decoder, fills a ring buffer from the decoder thread (threaded mode)
+// NOTE: Ring buffer is lock-free, single producer (decoder thread) and single consumer (mixer),
+// stop/seek requests are generations: program requests them, decoder thread seeks the context
+// and the mixer drops frames decoded before the seek, decoding resumes once the mixer acknowledged it
+typedef struct MusicStreamDecoder {
+    Music music;                    // Music stream data, context is only accessed by the decoder thread
+    ma_pcm_rb ring;                 // Ring buffer of decoded frames, in stream internal format
+    unsigned int framesDecoded;     // Music position of next frame to be decoded
+    ma_uint32 looping;              // Music looping, synced on UpdateMusicStream() (atomic)
+    ma_uint32 state;                // Decoder state: MusicDecoderState (atomic)
+    ma_uint32 seekPosition;         // Seek position requested by the program, 0 rewinds (atomic)
+    ma_uint32 seekGeneration;       // Seek requests counter, only modified by the program (atomic)
+    ma_uint32 resetPosition;        // Music position after last seek, set by the decoder thread (atomic)
+    ma_uint32 resetGeneration;      // Last seek request done by the decoder thread (atomic)
+    ma_uint32 resetAck;             // Last seek request acknowledged by the mixer, ring buffer dropped (atomic)
+    struct MusicStreamDecoder *next;        // Next decoder on the list
+    struct MusicStreamDecoder *updateNext;  // Next decoder on the decoder thread work list
+} MusicStreamDecoder;
+
+#if defined(SUPPORT_FILEFORMAT_MP3)
+// MP3 music stream seek point
+// NOTE: MP3 frames depend on previous frames (bit reservoir), decoding restarts from a lead frame
+typedef struct MusicMp3SeekPoint {
+    drmp3_uint64 leadPosition;      // Lead frame stream byte position
+    drmp3_uint64 framePosition;     // Seek point frame stream byte position
+    drmp3_uint64 pcmFrameIndex;     // Seek point frame first PCM frame
+} MusicMp3SeekPoint;
+
+// MP3 music stream context
+// NOTE: MP3 streams have no seek table, without an index every seek decodes from the start of the stream
+typedef struct MusicMp3 {
+    drmp3 mp3;                      // MP3 decoder, first member so music context can be used as drmp3
+    MusicMp3SeekPoint *seekPoints;  // Seek index, loaded on first seek
+    unsigned int seekPointCount;    // Seek index points count
+} MusicMp3;
+#endif
+
+#if defined(SUPPORT_FILEFORMAT_QOA)
+// Sound QOA decoder, QOA compressed sounds are decoded by frames at mixing time
+// NOTE: Every sound alias has its own decoder, compressed data is shared
+typedef struct SoundQoaDecoder {
+    qoa_desc desc;                  // QOA description, LMS state is restored from every frame header
+    unsigned int frameSize;         // QOA frame size in bytes (last frame could be smaller)
+    unsigned int dataSize;          // QOA compressed data size in bytes
+    int frameIndex;                 // Decoded QOA frame index, -1 if no frame decoded
+    short *samples;                 // Decoded QOA frame samples (QOA_FRAME_LEN*channels)
+} SoundQoaDecoder;
+#endif
+
+// Biquad filter (RBJ cookbook low/high-pass), transposed direct form II
+typedef struct AudioBiquad {
+    bool enabled;                   // Filter enabled
+    float b0, b1, b2, a1, a2;       // Filter coefficients, normalized by a0
+    float z1[AUDIO_DEVICE_CHANNELS];    // Filter state per channel
+    float z2[AUDIO_DEVICE_CHANNELS];    // Filter state per channel
+} AudioBiquad;
+
+// Audio buffer resampler, converts frames from buffer sample rate (considering pitch) to device sample rate
+typedef struct AudioResampler {
+    float frames[(AUDIO_RESAMPLER_MAX_TAPS + AUDIO_RESAMPLER_BLOCK_FRAMES)*AUDIO_DEVICE_CHANNELS];  // Input frames window, mixing format
+    unsigned int frameCount;        // Input frames available in window
+    double position;                // Next output frame position in window (input frames)
+    unsigned int endFrame;          // Input frames end position in window, once source ended
+    bool ended;                     // Source data ended, window is filled with silence
+    double lowPassStep;             // Resampling step low-pass filters are set for, 0.0 if not set
+    AudioBiquad lowPass[2];         // Low-pass filters, 4th order Butterworth, only used by linear interpolation
+} AudioResampler;
+
+#define AUDIO_BUS_COUNT                    4    // Mixing buses count: AudioBus
+
+// Mixing bus reverb (Freeverb): 8 parallel comb filters and 4 series allpass filters per channel
+// NOTE: Delay lines memory is allocated by the program, the mixer never allocates
+typedef struct AudioReverb {
+    bool enabled;                   // Reverb enabled
+    float feedback;                 // Comb filters feedback, from room size
+    float damping;                  // Comb filters damping
+    float wet;                      // Reverb output level
+    float dry;                      // Input output level
+    float *comb[2][8];              // Comb filters delay lines
+    unsigned int combSize[2][8];    // Comb filters delay lines length
+    unsigned int combIndex[2][8];   // Comb filters delay lines position
+    float combStore[2][8];          // Comb filters damping lowpass state
+    float *allpass[2][4];           // Allpass filters delay lines
+    unsigned int allpassSize[2][4]; // Allpass filters delay lines length
+    unsigned int allpassIndex[2][4];    // Allpass filters delay lines position
+    unsigned int tailFrames;        // Silent output frames required to consider the tail decayed
+} AudioReverb;
+
+// Mixing bus peak limiter: instant attack, exponential release
+typedef struct AudioLimiter {
+    bool enabled;                   // Limiter enabled
+    float threshold;                // Maximum output peak level
+    float release;                  // Release coefficient per frame
+    float gain;                     // Current gain reduction
+} AudioLimiter;
+
+// Mixing bus, audio buffers are mixed into their bus, then bus effects are applied and buses are mixed into master bus
+typedef struct rAudioBus {
+    float frames[AUDIO_BUS_BLOCK_FRAMES*AUDIO_DEVICE_CHANNELS];     // Bus mixed frames for current block
+    bool active;                    // Bus received frames on current block
+    float volume;                   // Bus volume
+    float gain;                     // Bus current gain, ramped to volume
+    float gainStep;                 // Bus gain increment per frame while ramping
+    unsigned int rampFrames;        // Bus gain ramp frames left
+    AudioBiquad highPass;           // High-pass filter
+    AudioBiquad lowPass;            // Low-pass filter
+    AudioReverb *reverb;            // Reverb, NULL if never enabled
+    unsigned int tailSilentFrames;  // Reverb tail silent frames since bus received frames
+    AudioLimiter limiter;           // Peak limiter
+} rAudioBus;
+
 // Audio buffer struct
 struct rAudioBuffer {
-    ma_data_converter converter;    // Audio data converter
+    ma_data_converter converter;    // Audio data converter (format and channels, sample rate is kept)
+    AudioResampler resampler;       // Audio data resampler, to device sample rate
 
     AudioCallback callback;         // Audio buffer callback for buffer filling on audio threads
     rAudioProcessor *processor;     // Audio processor
@@ -349,17 +532,57 @@ struct rAudioBuffer {
     float pitch;                    // Audio buffer pitch
     float pan;                      // Audio buffer pan (0.0f to 1.0f)
 
+    float mixLevels[2];             // Mixer current left/right levels (volume and pan)
+    float mixLevelsTarget[2];       // Mixer target left/right levels, ramped from current levels
+    float mixLevelsStep[2];         // Mixer levels increment per frame while ramping
+    unsigned int mixRampFrames;     // Mixer levels ramp frames left
+
+    int priority;                   // Voice priority, higher priority sounds are mixed first
+    float audibility;               // Voice audibility, maximum mixing level, computed by the mixer
+    bool isVirtual;                 // Voice is virtual: playing but not mixed, cursor keeps advancing
+    bool wasVirtual;                // Voice was virtual on last mix, it must be faded in
+    bool wasMixed;                  // Voice was mixed on last block, it must be faded out when becoming virtual
+    double virtualFraction;         // Virtual voice cursor fractional frames, kept between blocks
+
+    bool spatial;                   // Spatial sound, volume/pan/pitch also driven by emitter and listener
+    float emitterPosition[3];       // Emitter position
+    float emitterVelocity[3];       // Emitter velocity, for doppler effect
+    ma_uint32 emitterSequence;      // Emitter slot sequence, odd while the program writes the slot (atomic)
+    ma_uint32 emitterSlot[7];       // Emitter slot: spatial flag, position and velocity float bits (atomic)
+    ma_uint32 emitterApplied;       // Emitter slot sequence applied by the mixer
+    int attenuation;                // Distance attenuation model: SoundAttenuation
+    float minDistance;              // Distance attenuation minimum distance (no attenuation closer)
+    float maxDistance;              // Distance attenuation maximum distance (no more attenuation farther)
+    float rolloff;                  // Distance attenuation rolloff factor
+    float spatialLevels[2];         // Spatial left/right levels, computed by the mixer
+    float spatialGain;              // Spatial distance gain, computed by the mixer
+    float doppler;                  // Spatial doppler pitch factor, computed by the mixer
+
+    int bus;                        // Mixing bus: AudioBus
+
     bool playing;                   // Audio buffer state: AUDIO_PLAYING
     bool paused;                    // Audio buffer state: AUDIO_PAUSED
     bool looping;                   // Audio buffer looping, default to true for AudioStreams
     int usage;                      // Audio buffer usage mode: STATIC or STREAM
 
-    bool isSubBufferProcessed[2];   // SubBuffer processed (virtual double buffer)
+    ma_uint32 isSubBufferProcessed[2];  // SubBuffer processed (virtual double buffer) (atomic)
+    ma_uint32 cursorRewind;         // Stream cursor rewind requested by UpdateAudioStream(), done by the mixer (atomic)
     unsigned int sizeInFrames;      // Total buffer size in frames
-    unsigned int frameCursorPos;    // Frame cursor position
-    unsigned int framesProcessed;   // Total frames processed in this buffer (required for play timing)
+    unsigned int frameCursorPos;    // Frame cursor position, only modified by the mixer (atomic)
+    unsigned int framesProcessed;   // Total frames processed in this buffer (required for play timing) (atomic)
 
     unsigned char *data;            // Data buffer, on music stream keeps filling
+    bool ownsData;                  // Data buffer is owned by this buffer (not shared by a sound alias)
+    MusicStreamDecoder *decoder;    // Music stream decoder, only in threaded mode
+#if defined(SUPPORT_FILEFORMAT_QOA)
+    SoundQoaDecoder *qoa;           // Sound QOA decoder, only for QOA compressed sounds
+#endif
+
+    ma_uint32 stateCommandsPending; // Play/Stop/Pause/Resume commands not yet executed by the mixer (atomic)
+    bool requestedPlaying;          // Audio buffer state requested by the program, valid while state commands are pending
+    bool requestedPaused;           // Audio buffer state requested by the program, valid while state commands are pending
+    ma_uint32 untrackCommand;       // Untrack command index, buffer can be freed once mixer executed it
+    rAudioBuffer *retiredNext;      // Next audio buffer on the list of buffers waiting to be freed
 
     rAudioBuffer *next;             // Next audio buffer on the list
     rAudioBuffer *prev;             // Previous audio buffer on the list
@@ -375,13 +598,61 @@ struct rAudioProcessor {
 
 #define AudioBuffer rAudioBuffer    // HACK: To avoid CoreAudio (macOS) symbol collision
 
+// Mixer command type
+// NOTE: Audio buffers and mixer state are only modified by the mixer, executing
+// commands queued by the program, so the mixer never waits for the program
+typedef enum {
+    AUDIO_COMMAND_PLAY = 0,         // Play audio buffer from the start
+    AUDIO_COMMAND_STOP,             // Stop audio buffer
+    AUDIO_COMMAND_PAUSE,            // Pause audio buffer
+    AUDIO_COMMAND_RESUME,           // Resume audio buffer
+    AUDIO_COMMAND_VOLUME,           // Set audio buffer volume
+    AUDIO_COMMAND_PITCH,            // Set audio buffer pitch
+    AUDIO_COMMAND_PAN,              // Set audio buffer pan
+    AUDIO_COMMAND_PRIORITY,         // Set audio buffer voice priority
+    AUDIO_COMMAND_MAX_VOICES,       // Set maximum real voices
+    AUDIO_COMMAND_RESAMPLE_QUALITY, // Set resampling quality
+    AUDIO_COMMAND_ATTENUATION,      // Set audio buffer distance attenuation
+    AUDIO_COMMAND_LISTENER,         // Set listener position, orientation and velocity
+    AUDIO_COMMAND_DOPPLER,          // Set doppler factor
+    AUDIO_COMMAND_BUS,              // Set audio buffer mixing bus
+    AUDIO_COMMAND_BUS_VOLUME,       // Set bus volume
+    AUDIO_COMMAND_BUS_FILTER,       // Set bus low-pass/high-pass filter
+    AUDIO_COMMAND_BUS_REVERB,       // Set bus reverb
+    AUDIO_COMMAND_BUS_LIMITER,      // Set bus limiter
+    AUDIO_COMMAND_TRACK,            // Add audio buffer to the mixer list
+    AUDIO_COMMAND_UNTRACK,          // Remove audio buffer from the mixer list
+    AUDIO_COMMAND_ALIAS,            // Copy source audio buffer parameters to a sound alias
+    AUDIO_COMMAND_CALLBACK,         // Set audio buffer callback
+    AUDIO_COMMAND_ATTACH_PROCESSOR, // Attach processor to audio buffer, or to mixed output if no buffer provided
+    AUDIO_COMMAND_DETACH_PROCESSOR, // Detach processor from audio buffer, or from mixed output if no buffer provided
+    AUDIO_COMMAND_DECODER           // Set music stream decoder
+} AudioCommandType;
+
+// Mixer command, sent from the program to the mixer
+typedef struct AudioCommand {
+    int type;                       // Command type: AudioCommandType
+    AudioBuffer *buffer;            // Audio buffer affected
+    AudioBuffer *source;            // Source audio buffer, parameters copied to a sound alias
+    float value;                    // Volume, pitch or pan value
+    int param;                      // Voice priority, maximum voices, resampling quality, attenuation model or bus
+    float vectors[4][3];            // Listener position/forward/up/velocity or attenuation distances/rolloff
+    unsigned int position;          // Music stream position in frames
+    AudioCallback callback;         // Audio buffer callback
+    rAudioProcessor *processor;     // Audio processor to attach/detach
+    MusicStreamDecoder *decoder;    // Music stream decoder
+    AudioReverb *reverb;            // Bus reverb, allocated by the program
+    AudioBuffer **voices;           // Real voices array, allocated by the program
+} AudioCommand;
+
 // Audio data context
 typedef struct AudioData {
     struct {
         ma_context context;         // miniaudio context data
         ma_device device;           // miniaudio device
-        ma_mutex lock;              // miniaudio mutex lock
+        ma_mutex lock;              // Commands queue lock, serializes program threads, never taken by the mixer
         bool isReady;               // Check if audio device is ready
+        bool isOffline;             // Check if audio device is offline, mixing driven by RenderAudioFrames()
         size_t pcmBufferSize;       // Pre-allocated buffer size
         void *pcmBuffer;            // Pre-allocated buffer to read audio data from file/memory
     } System;
@@ -389,7 +660,41 @@ typedef struct AudioData {
         AudioBuffer *first;         // Pointer to first AudioBuffer in the list
         AudioBuffer *last;          // Pointer to last AudioBuffer in the list
         int defaultSize;            // Default audio buffer size for audio streams
+        int soundStorage;           // Storage format for new sounds: SoundStorageFormat
     } Buffer;
+    struct {
+        AudioCommand commands[AUDIO_COMMAND_QUEUE_SIZE];    // Commands ring buffer
+        ma_uint32 head;             // Commands written, only modified by the program (atomic)
+        ma_uint32 tail;             // Commands executed, only modified by the mixer (atomic)
+        AudioBuffer *retired;       // Unloaded audio buffers waiting for the mixer to untrack them
+    } Queue;
+    struct {
+        ma_thread thread;           // Music streams decoder thread
+        ma_mutex lock;              // Decoders list lock, never taken by the mixer nor held while decoding
+        ma_mutex updateLock;        // Decoders update lock, held while decoding a copy of the list
+        ma_uint32 running;          // Decoder thread running state (atomic)
+        MusicStreamDecoder *first;  // Pointer to first decoder in the list
+    } Decoder;
+    struct {
+        int maxReal;                // Maximum real voices mixed, 0 if not limited (no voices culling), only modified by the mixer
+        AudioBuffer **real;         // Real voices selected on voices update (maxReal), only modified by the mixer
+        AudioBuffer **allocated;    // Real voices array allocated by the program, freed once the mixer stops using it
+    } Voice;
+    struct {
+        float position[3];          // Listener position
+        float right[3];             // Listener right axis, computed from forward and up vectors
+        float velocity[3];          // Listener velocity, for doppler effect
+        float dopplerFactor;        // Doppler effect factor, 0.0f disables it
+    } Listener;                     // Listener state, only modified by the mixer
+    struct {
+        rAudioBus buses[AUDIO_BUS_COUNT];       // Mixing buses, only modified by the mixer
+        AudioReverb *reverbs[AUDIO_BUS_COUNT];  // Buses reverbs allocated by the program, freed on device closing
+    } Bus;
+    struct {
+        int quality;                // Resampling quality: AudioResampleQuality, only modified by the mixer
+        int taps[3];                // Filter taps per quality
+        float *tables[3][AUDIO_RESAMPLER_RATIOS];   // Polyphase filter tables per quality and downsampling ratio, shared by all buffers
+    } Resampler;
     rAudioProcessor *mixedProcessor;
 } AudioData;
 
@@ -403,6 +708,10 @@ static AudioData AUDIO = {          // Global AUDIO context
     // standard double-buffering system, a 4096 samples buffer has been chosen, it should be enough
     // In case of music-stalls, just increase this number
     .Buffer.defaultSize = 0,
+    .Listener.right = { 1.0f, 0.0f, 0.0f },
+    .Listener.dopplerFactor = 1.0f,
+    .Resampler.quality = AUDIO_RESAMPLE_LINEAR,
+    .Resampler.taps = { 2, 8, AUDIO_RESAMPLER_MAX_TAPS },
     .mixedProcessor = NULL
 };
 
@@ -410,17 +719,67 @@ static AudioData AUDIO = {          // Global AUDIO context
 // Module specific Functions Declaration
 //----------------------------------------------------------------------------------
 static void OnLog(void *pUserData, ma_uint32 level, const char *pMessage);
+static void InitAudioDeviceBackend(bool offline, int sampleRate);
 
 // Reads audio data from an AudioBuffer object in internal/device formats
 static ma_uint32 ReadAudioBufferFramesInInternalFormat(AudioBuffer *audioBuffer, void *framesOut, ma_uint32 frameCount);
 static ma_uint32 ReadAudioBufferFramesInMixingFormat(AudioBuffer *audioBuffer, float *framesOut, ma_uint32 frameCount);
+static ma_uint32 ReadAudioBufferFramesResampled(AudioBuffer *audioBuffer, float *framesOut, ma_uint32 frameCount);
+
+static double BesselI0(double x);
+static float *LoadAudioResamplerTable(int taps, double cutoff, double beta);
+static void LoadAudioResamplerTables(int quality);
+static int GetAudioResamplerRatioIndex(double step);
+static double GetAudioBufferResampleStep(AudioBuffer *buffer);
+static void ResetAudioResampler(AudioBuffer *buffer);
 
 static void OnSendAudioDataToDevice(ma_device *pDevice, void *pFramesOut, const void *pFramesInput, ma_uint32 frameCount);
 static void MixAudioFrames(float *framesOut, const float *framesIn, ma_uint32 frameCount, AudioBuffer *buffer);
+static void GetAudioBufferMixLevels(AudioBuffer *buffer, ma_uint32 channels, float *levels);
+static void MixAudioSamples(float *samplesOut, const float *samplesIn, ma_uint32 sampleCount, const float *levels);
+static void MixAudioFramesStereoRamp(float *framesOut, const float *framesIn, ma_uint32 frameCount, float *levels, const float *steps);
+
+static bool IsAudioVoiceMoreImportant(AudioBuffer *buffer, AudioBuffer *other);
+static void UpdateAudioVoices(void);
+static void UpdateAudioVoiceVirtual(AudioBuffer *buffer, ma_uint32 frameCount);
+static void DemoteAudioVoice(AudioBuffer *buffer, ma_uint32 frameCount);
+static void PromoteAudioVoice(AudioBuffer *buffer);
+static void UpdateAudioBufferSpatial(AudioBuffer *buffer);
+static void UpdateAudioBufferEmitter(AudioBuffer *buffer);
+static void SetAudioBufferEmitter(AudioBuffer *buffer, bool spatial, const float *position, const float *velocity);
+static void MixAudioBuffer(AudioBuffer *audioBuffer, float *framesOut, ma_uint32 frameCount);
+static bool IsAudioBusBypassed(rAudioBus *bus);
+static void ResetAudioBusState(rAudioBus *bus);
+static void SetAudioBiquad(AudioBiquad *biquad, int filter, float cutoff, float resonance);
+static AudioReverb *LoadAudioReverb(void);
+static void ResetAudioReverb(AudioReverb *reverb);
+static void MixAudioBuses(float *framesOut, ma_uint32 frameCount);
+
+static bool IsAudioMixerRunning(void);
+static void WaitAudioMixer(void);
+static void PushAudioCommand(AudioCommand command);
+static void FlushAudioCommands(void);
+static void ExecuteAudioCommands(void);
+static void FreeRetiredAudioBuffers(bool force);
+static void StopAudioBufferInMixer(AudioBuffer *buffer);
+
+#if defined(SUPPORT_FILEFORMAT_QOA)
+static SoundQoaDecoder *LoadSoundQoaDecoder(const qoa_desc *desc, unsigned int dataSize);
+static void ReadSoundQoaFrames(AudioBuffer *audioBuffer, short *framesOut, unsigned int position, unsigned int frameCount);
+#endif
 
-static bool IsAudioBufferPlayingInLockedState(AudioBuffer *buffer);
-static void StopAudioBufferInLockedState(AudioBuffer *buffer);
-static void UpdateAudioStreamInLockedState(AudioStream stream, const void *data, int frameCount);
+static void ReadMusicStreamFrames(Music music, void *framesOut, unsigned int framesToStream);
+static ma_uint32 ReadMusicStreamDecoderFrames(AudioBuffer *audioBuffer, void *framesOut, ma_uint32 frameCount);
+static void UpdateMusicStreamDecoder(MusicStreamDecoder *decoder);
+static void UpdateMusicStreamDecoders(void);
+static void RequestMusicStreamDecoderSeek(MusicStreamDecoder *decoder, unsigned int position);
+static unsigned int SeekMusicStreamContext(Music music, unsigned int position);
+#if defined(SUPPORT_FILEFORMAT_MP3)
+static void SeekMusicMp3(MusicMp3 *ctxMp3, unsigned int frameCount, unsigned int position);
+#endif
+#if !defined(__EMSCRIPTEN__)
+static ma_thread_result MA_THREADCALL MusicStreamDecoderThread(void *userData);
+#endif
 
 #if defined(RAUDIO_STANDALONE)
 static bool IsFileExtension(const char *fileName, const char *ext); // Check file extension
@@ -448,6 +807,7 @@ void ResumeAudioBuffer(AudioBuffer *buffer);
 void SetAudioBufferVolume(AudioBuffer *buffer, float volume);
 void SetAudioBufferPitch(AudioBuffer *buffer, float pitch);
 void SetAudioBufferPan(AudioBuffer *buffer, float pan);
+void SetAudioBufferBus(AudioBuffer *buffer, int bus);
 void TrackAudioBuffer(AudioBuffer *buffer);
 void UntrackAudioBuffer(AudioBuffer *buffer);
 
@@ -457,12 +817,55 @@ void UntrackAudioBuffer(AudioBuffer *buffer);
 //----------------------------------------------------------------------------------
 // Initialize audio device
 void InitAudioDevice(void)
+{
+    InitAudioDeviceBackend(false, AUDIO_DEVICE_SAMPLE_RATE);
+}
+
+// Initialize audio device for offline rendering, mixing is driven by RenderAudioFrames()
+// NOTE: No audio hardware is used (miniaudio null backend), so it works on headless machines
+void InitAudioDeviceOffline(int sampleRate)
+{
+    InitAudioDeviceBackend(true, sampleRate);
+}
+
+// Render audio frames offline, mixing all playing sounds, streams and music as the device would do
+// NOTE: Frames are interleaved float samples, AUDIO_DEVICE_CHANNELS per frame
+// NOTE: Offline device is never started, audio functions execute mixer commands directly on the calling
+// thread (with audio system mutex locked), so every period is mixed with that mutex locked too
+// WARNING: Audio functions must not be called from audio callbacks or processors while rendering offline
+void RenderAudioFrames(float *frames, int frameCount)
+{
+    if (!AUDIO.System.isReady || !AUDIO.System.isOffline)
+    {
+        TRACELOG(LOG_WARNING, "AUDIO: Offline rendering requires InitAudioDeviceOffline()");
+        return;
+    }
+
+    // Rendering is done in device periods, keeping threaded music streams decoders ahead of the mixer
+    while (frameCount > 0)
+    {
+        int framesToRender = (frameCount < AUDIO_OFFLINE_PERIOD_FRAMES)? frameCount : AUDIO_OFFLINE_PERIOD_FRAMES;
+
+        UpdateMusicStreamDecoders();
+
+        ma_mutex_lock(&AUDIO.System.lock);
+        OnSendAudioDataToDevice(&AUDIO.System.device, frames, NULL, (ma_uint32)framesToRender);
+        ma_mutex_unlock(&AUDIO.System.lock);
+
+        frames += framesToRender*AUDIO_DEVICE_CHANNELS;
+        frameCount -= framesToRender;
+    }
+}
+
+// Initialize audio device, on default backend or on null backend for offline rendering
+static void InitAudioDeviceBackend(bool offline, int sampleRate)
 {
     // Init audio context
     ma_context_config ctxConfig = ma_context_config_init();
     ma_log_callback_init(OnLog, NULL);
 
-    ma_result result = ma_context_init(NULL, 0, &ctxConfig, &AUDIO.System.context);
+    ma_backend nullBackend = ma_backend_null;
+    ma_result result = ma_context_init(offline? &nullBackend : NULL, offline? 1 : 0, &ctxConfig, &AUDIO.System.context);
     if (result != MA_SUCCESS)
     {
         TRACELOG(LOG_WARNING, "AUDIO: Failed to initialize context");
@@ -478,7 +881,7 @@ void InitAudioDevice(void)
     config.capture.pDeviceID = NULL;  // NULL for the default capture AUDIO.System.device
     config.capture.format = ma_format_s16;
     config.capture.channels = 1;
-    config.sampleRate = AUDIO_DEVICE_SAMPLE_RATE;
+    config.sampleRate = sampleRate;
     config.dataCallback = OnSendAudioDataToDevice;
     config.pUserData = NULL;
 
@@ -490,8 +893,8 @@ void InitAudioDevice(void)
         return;
     }
 
-    // Mixing happens on a separate thread which means we need to synchronize. I'm using a mutex here to make things simple, but may
-    // want to look at something a bit smarter later on to keep everything real-time, if that's necessary
+    // Mixing happens on a separate thread, program threads send it commands through a queue to keep it real-time
+    // NOTE: This mutex only serializes program threads pushing commands, it is never taken by the mixer
     if (ma_mutex_init(&AUDIO.System.lock) != MA_SUCCESS)
     {
         TRACELOG(LOG_WARNING, "AUDIO: Failed to create mutex for mixing");
@@ -500,18 +903,56 @@ void InitAudioDevice(void)
         return;
     }
 
-    // Keep the device running the whole time. May want to consider doing something a bit smarter and only have the device running
-    // while there's at least one sound being played
-    result = ma_device_start(&AUDIO.System.device);
-    if (result != MA_SUCCESS)
+    // Music streams decoder thread is lazily created, but its locks are required by music streams
+    if (ma_mutex_init(&AUDIO.Decoder.lock) != MA_SUCCESS)
+    {
+        TRACELOG(LOG_WARNING, "AUDIO: Failed to create mutex for music decoding");
+        ma_mutex_uninit(&AUDIO.System.lock);
+        ma_device_uninit(&AUDIO.System.device);
+        ma_context_uninit(&AUDIO.System.context);
+        return;
+    }
+
+    if (ma_mutex_init(&AUDIO.Decoder.updateLock) != MA_SUCCESS)
     {
-        TRACELOG(LOG_WARNING, "AUDIO: Failed to start playback device");
+        TRACELOG(LOG_WARNING, "AUDIO: Failed to create mutex for music decoding");
+        ma_mutex_uninit(&AUDIO.Decoder.lock);
+        ma_mutex_uninit(&AUDIO.System.lock);
         ma_device_uninit(&AUDIO.System.device);
         ma_context_uninit(&AUDIO.System.context);
         return;
     }
 
-    TRACELOG(LOG_INFO, "AUDIO: Device initialized successfully");
+    // Resampler filter tables are shared by all audio buffers, sinc tables are loaded once selected
+    LoadAudioResamplerTables(AUDIO_RESAMPLE_LINEAR);
+
+    // Mixing buses start with unity gain and no effects
+    for (int i = 0; i < AUDIO_BUS_COUNT; i++)
+    {
+        memset(&AUDIO.Bus.buses[i], 0, sizeof(rAudioBus));
+        AUDIO.Bus.buses[i].volume = 1.0f;
+        AUDIO.Bus.buses[i].gain = 1.0f;
+        AUDIO.Bus.buses[i].limiter.gain = 1.0f;
+    }
+
+    AUDIO.System.isOffline = offline;
+
+    // Keep the device running the whole time. May want to consider doing something a bit smarter and only have the device running
+    // while there's at least one sound being played
+    // NOTE: Offline device is never started, program commands are executed directly and mixing is driven by RenderAudioFrames()
+    if (!offline)
+    {
+        result = ma_device_start(&AUDIO.System.device);
+        if (result != MA_SUCCESS)
+        {
+            TRACELOG(LOG_WARNING, "AUDIO: Failed to start playback device");
+            ma_device_uninit(&AUDIO.System.device);
+            ma_context_uninit(&AUDIO.System.context);
+            return;
+        }
+    }
+
+    TRACELOG(LOG_INFO, "AUDIO: %s initialized successfully", offline? "Offline device" : "Device");
     TRACELOG(LOG_INFO, "    > Backend:       miniaudio | %s", ma_get_backend_name(AUDIO.System.context.backend));
     TRACELOG(LOG_INFO, "    > Format:        %s -> %s", ma_get_format_name(AUDIO.System.device.playback.format), ma_get_format_name(AUDIO.System.device.playback.internalFormat));
     TRACELOG(LOG_INFO, "    > Channels:      %d -> %d", AUDIO.System.device.playback.channels, AUDIO.System.device.playback.internalChannels);
@@ -526,11 +967,47 @@ void CloseAudioDevice(void)
 {
     if (AUDIO.System.isReady)
     {
-        ma_mutex_uninit(&AUDIO.System.lock);
+#if !defined(__EMSCRIPTEN__)
+        if (ma_atomic_load_32(&AUDIO.Decoder.running))
+        {
+            ma_atomic_exchange_32(&AUDIO.Decoder.running, 0);
+            ma_thread_wait(&AUDIO.Decoder.thread);
+        }
+#endif
         ma_device_uninit(&AUDIO.System.device);
         ma_context_uninit(&AUDIO.System.context);
 
+        // Mixer is not running anymore, execute pending commands and free unloaded buffers
+        ExecuteAudioCommands();
+        FreeRetiredAudioBuffers(true);
+
+        RL_FREE(AUDIO.Voice.allocated);
+        AUDIO.Voice.allocated = NULL;
+        AUDIO.Voice.real = NULL;
+        AUDIO.Voice.maxReal = 0;
+
+        ma_mutex_uninit(&AUDIO.Decoder.updateLock);
+        ma_mutex_uninit(&AUDIO.Decoder.lock);
+        ma_mutex_uninit(&AUDIO.System.lock);
+
+        for (int i = 0; i < 3; i++)
+        {
+            for (int j = 0; j < AUDIO_RESAMPLER_RATIOS; j++)
+            {
+                RL_FREE(AUDIO.Resampler.tables[i][j]);
+                AUDIO.Resampler.tables[i][j] = NULL;
+            }
+        }
+
+        for (int i = 0; i < AUDIO_BUS_COUNT; i++)
+        {
+            RL_FREE(AUDIO.Bus.reverbs[i]);
+            AUDIO.Bus.reverbs[i] = NULL;
+            AUDIO.Bus.buses[i].reverb = NULL;
+        }
+
         AUDIO.System.isReady = false;
+        AUDIO.System.isOffline = false;
         RL_FREE(AUDIO.System.pcmBuffer);
         AUDIO.System.pcmBuffer = NULL;
         AUDIO.System.pcmBufferSize = 0;
@@ -560,6 +1037,155 @@ float GetMasterVolume(void)
     return volume;
 }
 
+// Set storage format for sounds loaded afterwards
+// NOTE: Native and QOA storage formats save memory, but sounds are converted at mixing time
+void SetSoundStorageFormat(int format)
+{
+    AUDIO.Buffer.soundStorage = format;
+}
+
+// Set audio listener position, orientation and velocity, for spatial sounds
+void SetAudioListener(Vector3 position, Vector3 forward, Vector3 up, Vector3 velocity)
+{
+    ma_mutex_lock(&AUDIO.System.lock);
+    AudioCommand command = { .type = AUDIO_COMMAND_LISTENER };
+    Vector3 vectors[4] = { position, forward, up, velocity };
+
+    for (int i = 0; i < 4; i++)
+    {
+        command.vectors[i][0] = vectors[i].x;
+        command.vectors[i][1] = vectors[i].y;
+        command.vectors[i][2] = vectors[i].z;
+    }
+
+    PushAudioCommand(command);
+    ma_mutex_unlock(&AUDIO.System.lock);
+}
+
+// Set doppler effect factor for spatial sounds (1.0f is default, 0.0f disables it)
+void SetAudioDopplerFactor(float factor)
+{
+    if (factor < 0.0f) factor = 0.0f;
+
+    ma_mutex_lock(&AUDIO.System.lock);
+    AudioCommand command = { .type = AUDIO_COMMAND_DOPPLER, .value = factor };
+    PushAudioCommand(command);
+    ma_mutex_unlock(&AUDIO.System.lock);
+}
+
+// Set audio bus volume, all sounds and streams routed to the bus are affected
+void SetAudioBusVolume(int bus, float volume)
+{
+    if ((bus < 0) || (bus >= AUDIO_BUS_COUNT)) return;
+
+    ma_mutex_lock(&AUDIO.System.lock);
+    AudioCommand command = { .type = AUDIO_COMMAND_BUS_VOLUME, .param = bus, .value = volume };
+    PushAudioCommand(command);
+    ma_mutex_unlock(&AUDIO.System.lock);
+}
+
+// Set audio bus low-pass or high-pass filter (AudioFilter), cutoff frequency 0.0f disables it
+// NOTE: Resonance is the filter Q factor, 0.0f uses default 0.707f (no resonance peak)
+void SetAudioBusFilter(int bus, int filter, float cutoff, float resonance)
+{
+    if ((bus < 0) || (bus >= AUDIO_BUS_COUNT)) return;
+
+    ma_mutex_lock(&AUDIO.System.lock);
+    AudioCommand command = { .type = AUDIO_COMMAND_BUS_FILTER, .param = bus, .value = cutoff };
+    command.vectors[0][0] = (float)filter;
+    command.vectors[0][1] = resonance;
+    PushAudioCommand(command);
+    ma_mutex_unlock(&AUDIO.System.lock);
+}
+
+// Set audio bus reverb: room size and damping in [0.0f..1.0f], wet level 0.0f disables it
+// NOTE: Reverb delay lines are allocated on first use and kept until audio device is closed
+void SetAudioBusReverb(int bus, float roomSize, float damping, float wet)
+{
+    if ((bus < 0) || (bus >= AUDIO_BUS_COUNT)) return;
+
+    ma_mutex_lock(&AUDIO.System.lock);
+
+    if ((AUDIO.Bus.reverbs[bus] == NULL) && (wet > 0.0f))
+    {
+        AUDIO.Bus.reverbs[bus] = LoadAudioReverb();
+        if (AUDIO.Bus.reverbs[bus] == NULL) TRACELOG(LOG_WARNING, "AUDIO: Failed to allocate memory for bus reverb");
+    }
+
+    if (AUDIO.Bus.reverbs[bus] != NULL)
+    {
+        AudioCommand command = { .type = AUDIO_COMMAND_BUS_REVERB, .param = bus, .value = wet, .reverb = AUDIO.Bus.reverbs[bus] };
+        command.vectors[0][0] = roomSize;
+        command.vectors[0][1] = damping;
+        PushAudioCommand(command);
+    }
+
+    ma_mutex_unlock(&AUDIO.System.lock);
+}
+
+// Set audio bus peak limiter: maximum output level and release time (seconds), threshold 0.0f disables it
+void SetAudioBusLimiter(int bus, float threshold, float release)
+{
+    if ((bus < 0) || (bus >= AUDIO_BUS_COUNT)) return;
+
+    ma_mutex_lock(&AUDIO.System.lock);
+    AudioCommand command = { .type = AUDIO_COMMAND_BUS_LIMITER, .param = bus, .value = threshold };
+    command.vectors[0][0] = release;
+    PushAudioCommand(command);
+    ma_mutex_unlock(&AUDIO.System.lock);
+}
+
+// Set resampling quality, used for sample rate conversion and pitching
+void SetAudioResampleQuality(int quality)
+{
+    if ((quality < AUDIO_RESAMPLE_LINEAR) || (quality > AUDIO_RESAMPLE_SINC_HIGH))
+    {
+        TRACELOG(LOG_WARNING, "AUDIO: Resample quality not valid");
+        return;
+    }
+
+    ma_mutex_lock(&AUDIO.System.lock);
+    LoadAudioResamplerTables(quality);
+    AudioCommand command = { .type = AUDIO_COMMAND_RESAMPLE_QUALITY, .param = quality };
+    PushAudioCommand(command);
+    ma_mutex_unlock(&AUDIO.System.lock);
+}
+
+// Set maximum number of sounds mixed at once (real voices), 0 disables the limit (default)
+// NOTE: Lower priority or less audible sounds become virtual, they keep playing but they are not mixed,
+// sounds are never virtual if voices are not limited
+void SetAudioMaxVoices(int maxVoices)
+{
+    if (maxVoices < 0) maxVoices = 0;
+
+    // Voices array is allocated by the program, the mixer could be using previous one until command is executed
+    AudioBuffer **voices = NULL;
+
+    if (maxVoices > 0)
+    {
+        voices = (AudioBuffer **)RL_CALLOC(maxVoices, sizeof(AudioBuffer *));
+
+        if (voices == NULL)
+        {
+            TRACELOG(LOG_WARNING, "AUDIO: Failed to allocate memory for voices");
+            return;
+        }
+    }
+
+    ma_mutex_lock(&AUDIO.System.lock);
+
+    AudioBuffer **previous = AUDIO.Voice.allocated;
+    AUDIO.Voice.allocated = voices;
+
+    AudioCommand command = { .type = AUDIO_COMMAND_MAX_VOICES, .param = maxVoices, .voices = voices };
+    PushAudioCommand(command);
+    FlushAudioCommands();
+
+    ma_mutex_unlock(&AUDIO.System.lock);
+
+    RL_FREE(previous);
+}
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition - Audio Buffer management
 //----------------------------------------------------------------------------------
@@ -575,17 +1201,21 @@ AudioBuffer *LoadAudioBuffer(ma_format format, ma_uint32 channels, ma_uint32 sam
         return NULL;
     }
 
-    if (sizeInFrames > 0) audioBuffer->data = RL_CALLOC(sizeInFrames*channels*ma_get_bytes_per_sample(format), 1);
+    if (sizeInFrames > 0)
+    {
+        audioBuffer->data = RL_CALLOC(sizeInFrames*channels*ma_get_bytes_per_sample(format), 1);
+        audioBuffer->ownsData = true;
+    }
 
-    // Audio data runs through a format converter
-    ma_data_converter_config converterConfig = ma_data_converter_config_init(format, AUDIO_DEVICE_FORMAT, channels, AUDIO_DEVICE_CHANNELS, sampleRate, AUDIO.System.device.sampleRate);
-    converterConfig.allowDynamicSampleRate = true;
+    // Audio data runs through a format converter, then through the resampler
+    ma_data_converter_config converterConfig = ma_data_converter_config_init(format, AUDIO_DEVICE_FORMAT, channels, AUDIO_DEVICE_CHANNELS, sampleRate, sampleRate);
 
     ma_result result = ma_data_converter_init(&converterConfig, NULL, &audioBuffer->converter);
 
     if (result != MA_SUCCESS)
     {
         TRACELOG(LOG_WARNING, "AUDIO: Failed to create data conversion pipeline");
+        RL_FREE(audioBuffer->data);
         RL_FREE(audioBuffer);
         return NULL;
     }
@@ -595,6 +1225,14 @@ AudioBuffer *LoadAudioBuffer(ma_format format, ma_uint32 channels, ma_uint32 sam
     audioBuffer->pitch = 1.0f;
     audioBuffer->pan = 0.5f;
 
+    audioBuffer->attenuation = SOUND_ATTENUATION_INVERSE;
+    audioBuffer->minDistance = 1.0f;
+    audioBuffer->maxDistance = 1000.0f;
+    audioBuffer->rolloff = 1.0f;
+    audioBuffer->spatialGain = 1.0f;
+    audioBuffer->doppler = 1.0f;
+    audioBuffer->bus = (usage == AUDIO_BUFFER_USAGE_STATIC)? AUDIO_BUS_SFX : AUDIO_BUS_MUSIC;
+
     audioBuffer->callback = NULL;
     audioBuffer->processor = NULL;
 
@@ -604,12 +1242,13 @@ AudioBuffer *LoadAudioBuffer(ma_format format, ma_uint32 channels, ma_uint32 sam
 
     audioBuffer->usage = usage;
     audioBuffer->frameCursorPos = 0;
+    ResetAudioResampler(audioBuffer);
     audioBuffer->sizeInFrames = sizeInFrames;
 
     // Buffers should be marked as processed by default so that a call to
     // UpdateAudioStream() immediately after initialization works correctly
-    audioBuffer->isSubBufferProcessed[0] = true;
-    audioBuffer->isSubBufferProcessed[1] = true;
+    audioBuffer->isSubBufferProcessed[0] = 1;
+    audioBuffer->isSubBufferProcessed[1] = 1;
 
     // Track audio buffer to linked list next position
     TrackAudioBuffer(audioBuffer);
@@ -618,24 +1257,40 @@ AudioBuffer *LoadAudioBuffer(ma_format format, ma_uint32 channels, ma_uint32 sam
 }
 
 // Delete an audio buffer
+// NOTE: Buffer memory is freed once the mixer has untracked it, it is not referenced by the program anymore
 void UnloadAudioBuffer(AudioBuffer *buffer)
 {
     if (buffer != NULL)
     {
-        UntrackAudioBuffer(buffer);
-        ma_data_converter_uninit(&buffer->converter, NULL);
-        RL_FREE(buffer->data);
-        RL_FREE(buffer);
+        ma_mutex_lock(&AUDIO.System.lock);
+        {
+            AudioCommand command = { .type = AUDIO_COMMAND_UNTRACK, .buffer = buffer };
+            PushAudioCommand(command);
+
+            buffer->untrackCommand = AUDIO.Queue.head;
+            buffer->retiredNext = AUDIO.Queue.retired;
+            AUDIO.Queue.retired = buffer;
+
+            FreeRetiredAudioBuffers(false);
+        }
+        ma_mutex_unlock(&AUDIO.System.lock);
     }
 }
 
-// Check if an audio buffer is playing from a program state without lock
+// Check if an audio buffer is playing
+// NOTE: While state commands are pending, the state requested by the program is returned
 bool IsAudioBufferPlaying(AudioBuffer *buffer)
 {
     bool result = false;
-    ma_mutex_lock(&AUDIO.System.lock);
-    result = IsAudioBufferPlayingInLockedState(buffer);
-    ma_mutex_unlock(&AUDIO.System.lock);
+
+    if (buffer != NULL)
+    {
+        ma_mutex_lock(&AUDIO.System.lock);
+        if (ma_atomic_load_32(&buffer->stateCommandsPending) > 0) result = (buffer->requestedPlaying && !buffer->requestedPaused);
+        else result = (buffer->playing && !buffer->paused);
+        ma_mutex_unlock(&AUDIO.System.lock);
+    }
+
     return result;
 }
 
@@ -647,19 +1302,26 @@ void PlayAudioBuffer(AudioBuffer *buffer)
     if (buffer != NULL)
     {
         ma_mutex_lock(&AUDIO.System.lock);
-        buffer->playing = true;
-        buffer->paused = false;
-        buffer->frameCursorPos = 0;
+        buffer->requestedPlaying = true;
+        buffer->requestedPaused = false;
+        AudioCommand command = { .type = AUDIO_COMMAND_PLAY, .buffer = buffer };
+        PushAudioCommand(command);
         ma_mutex_unlock(&AUDIO.System.lock);
     }
 }
 
-// Stop an audio buffer from a program state without lock
+// Stop an audio buffer
 void StopAudioBuffer(AudioBuffer *buffer)
 {
-    ma_mutex_lock(&AUDIO.System.lock);
-    StopAudioBufferInLockedState(buffer);
-    ma_mutex_unlock(&AUDIO.System.lock);
+    if (buffer != NULL)
+    {
+        ma_mutex_lock(&AUDIO.System.lock);
+        buffer->requestedPlaying = false;
+        buffer->requestedPaused = false;
+        AudioCommand command = { .type = AUDIO_COMMAND_STOP, .buffer = buffer };
+        PushAudioCommand(command);
+        ma_mutex_unlock(&AUDIO.System.lock);
+    }
 }
 
 // Pause an audio buffer
@@ -668,7 +1330,9 @@ void PauseAudioBuffer(AudioBuffer *buffer)
     if (buffer != NULL)
     {
         ma_mutex_lock(&AUDIO.System.lock);
-        buffer->paused = true;
+        buffer->requestedPaused = true;
+        AudioCommand command = { .type = AUDIO_COMMAND_PAUSE, .buffer = buffer };
+        PushAudioCommand(command);
         ma_mutex_unlock(&AUDIO.System.lock);
     }
 }
@@ -679,7 +1343,9 @@ void ResumeAudioBuffer(AudioBuffer *buffer)
     if (buffer != NULL)
     {
         ma_mutex_lock(&AUDIO.System.lock);
-        buffer->paused = false;
+        buffer->requestedPaused = false;
+        AudioCommand command = { .type = AUDIO_COMMAND_RESUME, .buffer = buffer };
+        PushAudioCommand(command);
         ma_mutex_unlock(&AUDIO.System.lock);
     }
 }
@@ -690,7 +1356,8 @@ void SetAudioBufferVolume(AudioBuffer *buffer, float volume)
     if (buffer != NULL)
     {
         ma_mutex_lock(&AUDIO.System.lock);
-        buffer->volume = volume;
+        AudioCommand command = { .type = AUDIO_COMMAND_VOLUME, .buffer = buffer, .value = volume };
+        PushAudioCommand(command);
         ma_mutex_unlock(&AUDIO.System.lock);
     }
 }
@@ -701,14 +1368,8 @@ void SetAudioBufferPitch(AudioBuffer *buffer, float pitch)
     if ((buffer != NULL) && (pitch > 0.0f))
     {
         ma_mutex_lock(&AUDIO.System.lock);
-        // Pitching is just an adjustment of the sample rate
-        // Note that this changes the duration of the sound:
-        //  - higher pitches will make the sound faster
-        //  - lower pitches make it slower
-        ma_uint32 outputSampleRate = (ma_uint32)((float)buffer->converter.sampleRateOut/pitch);
-        ma_data_converter_set_rate(&buffer->converter, buffer->converter.sampleRateIn, outputSampleRate);
-
-        buffer->pitch = pitch;
+        AudioCommand command = { .type = AUDIO_COMMAND_PITCH, .buffer = buffer, .value = pitch };
+        PushAudioCommand(command);
         ma_mutex_unlock(&AUDIO.System.lock);
     }
 }
@@ -722,7 +1383,20 @@ void SetAudioBufferPan(AudioBuffer *buffer, float pan)
     if (buffer != NULL)
     {
         ma_mutex_lock(&AUDIO.System.lock);
-        buffer->pan = pan;
+        AudioCommand command = { .type = AUDIO_COMMAND_PAN, .buffer = buffer, .value = pan };
+        PushAudioCommand(command);
+        ma_mutex_unlock(&AUDIO.System.lock);
+    }
+}
+
+// Set mixing bus for an audio buffer
+void SetAudioBufferBus(AudioBuffer *buffer, int bus)
+{
+    if ((buffer != NULL) && (bus >= 0) && (bus < AUDIO_BUS_COUNT))
+    {
+        ma_mutex_lock(&AUDIO.System.lock);
+        AudioCommand command = { .type = AUDIO_COMMAND_BUS, .buffer = buffer, .param = bus };
+        PushAudioCommand(command);
         ma_mutex_unlock(&AUDIO.System.lock);
     }
 }
@@ -731,33 +1405,19 @@ void SetAudioBufferPan(AudioBuffer *buffer, float pan)
 void TrackAudioBuffer(AudioBuffer *buffer)
 {
     ma_mutex_lock(&AUDIO.System.lock);
-    {
-        if (AUDIO.Buffer.first == NULL) AUDIO.Buffer.first = buffer;
-        else
-        {
-            AUDIO.Buffer.last->next = buffer;
-            buffer->prev = AUDIO.Buffer.last;
-        }
-
-        AUDIO.Buffer.last = buffer;
-    }
+    AudioCommand command = { .type = AUDIO_COMMAND_TRACK, .buffer = buffer };
+    PushAudioCommand(command);
     ma_mutex_unlock(&AUDIO.System.lock);
 }
 
 // Untrack audio buffer from linked list
+// NOTE: It waits for the mixer to execute the command, so buffer can be freed afterwards
 void UntrackAudioBuffer(AudioBuffer *buffer)
 {
     ma_mutex_lock(&AUDIO.System.lock);
-    {
-        if (buffer->prev == NULL) AUDIO.Buffer.first = buffer->next;
-        else buffer->prev->next = buffer->next;
-
-        if (buffer->next == NULL) AUDIO.Buffer.last = buffer->prev;
-        else buffer->next->prev = buffer->prev;
-
-        buffer->prev = NULL;
-        buffer->next = NULL;
-    }
+    AudioCommand command = { .type = AUDIO_COMMAND_UNTRACK, .buffer = buffer };
+    PushAudioCommand(command);
+    FlushAudioCommands();
     ma_mutex_unlock(&AUDIO.System.lock);
 }
 
@@ -934,58 +1594,155 @@ Sound LoadSoundFromWave(Wave wave)
         //   1) Convert the whole sound in one go at load time (here)
         //   2) Convert the audio data in chunks at mixing time
         //
-        // First option has been selected, format conversion is done on the loading stage
-        // The downside is that it uses more memory if the original sound is u8 or s16
+        // First option is used by default (SOUND_STORAGE_DEVICE), format conversion is done on the loading stage
+        // The downside is that it uses more memory if the original sound is u8 or s16, mono or at lower sample rate
+        // Second option can be selected with SetSoundStorageFormat(), keeping wave format (SOUND_STORAGE_NATIVE)
+        // or compressing it with QOA (SOUND_STORAGE_QOA), mixer converts it in chunks at the cost of some CPU
         ma_format formatIn = ((wave.sampleSize == 8)? ma_format_u8 : ((wave.sampleSize == 16)? ma_format_s16 : ma_format_f32));
         ma_uint32 frameCountIn = wave.frameCount;
 
-        ma_uint32 frameCount = (ma_uint32)ma_convert_frames(NULL, 0, AUDIO_DEVICE_FORMAT, AUDIO_DEVICE_CHANNELS, AUDIO.System.device.sampleRate, NULL, frameCountIn, formatIn, wave.channels, wave.sampleRate);
-        if (frameCount == 0) TRACELOG(LOG_WARNING, "SOUND: Failed to get frame count for format conversion");
+        int storage = AUDIO.Buffer.soundStorage;
 
-        AudioBuffer *audioBuffer = LoadAudioBuffer(AUDIO_DEVICE_FORMAT, AUDIO_DEVICE_CHANNELS, AUDIO.System.device.sampleRate, frameCount, AUDIO_BUFFER_USAGE_STATIC);
-        if (audioBuffer == NULL)
+#if defined(SUPPORT_FILEFORMAT_QOA)
+        if ((storage == SOUND_STORAGE_QOA) && (wave.channels > QOA_MAX_CHANNELS))
         {
-            TRACELOG(LOG_WARNING, "SOUND: Failed to create buffer");
-            return sound; // early return to avoid dereferencing the audioBuffer null pointer
+            TRACELOG(LOG_WARNING, "SOUND: QOA storage supports up to %i channels, using native storage", QOA_MAX_CHANNELS);
+            storage = SOUND_STORAGE_NATIVE;
+        }
+#else
+        if (storage == SOUND_STORAGE_QOA)
+        {
+            TRACELOG(LOG_WARNING, "SOUND: QOA storage not supported, using native storage");
+            storage = SOUND_STORAGE_NATIVE;
         }
+#endif
 
-        frameCount = (ma_uint32)ma_convert_frames(audioBuffer->data, frameCount, AUDIO_DEVICE_FORMAT, AUDIO_DEVICE_CHANNELS, AUDIO.System.device.sampleRate, wave.data, frameCountIn, formatIn, wave.channels, wave.sampleRate);
-        if (frameCount == 0) TRACELOG(LOG_WARNING, "SOUND: Failed format conversion");
+        if (storage == SOUND_STORAGE_DEVICE)
+        {
+            ma_uint32 frameCount = (ma_uint32)ma_convert_frames(NULL, 0, AUDIO_DEVICE_FORMAT, AUDIO_DEVICE_CHANNELS, AUDIO.System.device.sampleRate, NULL, frameCountIn, formatIn, wave.channels, wave.sampleRate);
+            if (frameCount == 0) TRACELOG(LOG_WARNING, "SOUND: Failed to get frame count for format conversion");
 
-        sound.frameCount = frameCount;
-        sound.stream.sampleRate = AUDIO.System.device.sampleRate;
-        sound.stream.sampleSize = 32;
-        sound.stream.channels = AUDIO_DEVICE_CHANNELS;
-        sound.stream.buffer = audioBuffer;
-    }
+            AudioBuffer *audioBuffer = LoadAudioBuffer(AUDIO_DEVICE_FORMAT, AUDIO_DEVICE_CHANNELS, AUDIO.System.device.sampleRate, frameCount, AUDIO_BUFFER_USAGE_STATIC);
+            if (audioBuffer == NULL)
+            {
+                TRACELOG(LOG_WARNING, "SOUND: Failed to create buffer");
+                return sound; // early return to avoid dereferencing the audioBuffer null pointer
+            }
 
-    return sound;
-}
+            frameCount = (ma_uint32)ma_convert_frames(audioBuffer->data, frameCount, AUDIO_DEVICE_FORMAT, AUDIO_DEVICE_CHANNELS, AUDIO.System.device.sampleRate, wave.data, frameCountIn, formatIn, wave.channels, wave.sampleRate);
+            if (frameCount == 0) TRACELOG(LOG_WARNING, "SOUND: Failed format conversion");
 
-// Clone sound from existing sound data, clone does not own wave data
-// NOTE: Wave data must be unallocated manually and will be shared across all clones
-Sound LoadSoundAlias(Sound source)
-{
-    Sound sound = { 0 };
+            sound.frameCount = frameCount;
+            sound.stream.sampleRate = AUDIO.System.device.sampleRate;
+            sound.stream.sampleSize = 32;
+            sound.stream.channels = AUDIO_DEVICE_CHANNELS;
+            sound.stream.buffer = audioBuffer;
+        }
+#if defined(SUPPORT_FILEFORMAT_QOA)
+        else if (storage == SOUND_STORAGE_QOA)
+        {
+            // QOA encoder requires 16 bit samples
+            short *samples = (short *)wave.data;
 
-    if (source.stream.buffer->data != NULL)
-    {
-        AudioBuffer *audioBuffer = LoadAudioBuffer(AUDIO_DEVICE_FORMAT, AUDIO_DEVICE_CHANNELS, AUDIO.System.device.sampleRate, 0, AUDIO_BUFFER_USAGE_STATIC);
+            if (formatIn != ma_format_s16)
+            {
+                samples = (short *)RL_MALLOC(frameCountIn*wave.channels*sizeof(short));
+                ma_convert_frames(samples, frameCountIn, ma_format_s16, wave.channels, wave.sampleRate, wave.data, frameCountIn, formatIn, wave.channels, wave.sampleRate);
+            }
 
-        if (audioBuffer == NULL)
-        {
-            TRACELOG(LOG_WARNING, "SOUND: Failed to create buffer");
-            return sound; // Early return to avoid dereferencing the audioBuffer null pointer
-        }
+            qoa_desc desc = { 0 };
+            desc.channels = wave.channels;
+            desc.samplerate = wave.sampleRate;
+            desc.samples = frameCountIn;
 
-        audioBuffer->sizeInFrames = source.stream.buffer->sizeInFrames;
-        audioBuffer->volume = source.stream.buffer->volume;
-        audioBuffer->data = source.stream.buffer->data;
+            unsigned int dataSize = 0;
+            unsigned char *data = (unsigned char *)qoa_encode(samples, &desc, &dataSize);
+
+            if (samples != wave.data) RL_FREE(samples);
+
+            if (data == NULL)
+            {
+                TRACELOG(LOG_WARNING, "SOUND: Failed to compress sound data (QOA)");
+                return sound;
+            }
+
+            AudioBuffer *audioBuffer = LoadAudioBuffer(ma_format_s16, wave.channels, wave.sampleRate, 0, AUDIO_BUFFER_USAGE_STATIC);
+            if (audioBuffer == NULL)
+            {
+                TRACELOG(LOG_WARNING, "SOUND: Failed to create buffer");
+                RL_FREE(data);
+                return sound;
+            }
+
+            audioBuffer->data = data;
+            audioBuffer->ownsData = true;
+            audioBuffer->sizeInFrames = frameCountIn;
+            audioBuffer->qoa = LoadSoundQoaDecoder(&desc, dataSize);
+
+            sound.frameCount = frameCountIn;
+            sound.stream.sampleRate = wave.sampleRate;
+            sound.stream.sampleSize = 16;
+            sound.stream.channels = wave.channels;
+            sound.stream.buffer = audioBuffer;
+        }
+#endif
+        else
+        {
+            AudioBuffer *audioBuffer = LoadAudioBuffer(formatIn, wave.channels, wave.sampleRate, frameCountIn, AUDIO_BUFFER_USAGE_STATIC);
+            if (audioBuffer == NULL)
+            {
+                TRACELOG(LOG_WARNING, "SOUND: Failed to create buffer");
+                return sound;
+            }
+
+            memcpy(audioBuffer->data, wave.data, frameCountIn*ma_get_bytes_per_frame(formatIn, wave.channels));
+
+            sound.frameCount = frameCountIn;
+            sound.stream.sampleRate = wave.sampleRate;
+            sound.stream.sampleSize = wave.sampleSize;
+            sound.stream.channels = wave.channels;
+            sound.stream.buffer = audioBuffer;
+        }
+    }
+
+    return sound;
+}
+
+// Clone sound from existing sound data, clone does not own wave data
+// NOTE: Wave data must be unallocated manually and will be shared across all clones
+Sound LoadSoundAlias(Sound source)
+{
+    Sound sound = { 0 };
+
+    if (source.stream.buffer->data != NULL)
+    {
+        // Alias uses the same storage format than source sound
+        ma_data_converter *converter = &source.stream.buffer->converter;
+        AudioBuffer *audioBuffer = LoadAudioBuffer(converter->formatIn, converter->channelsIn, converter->sampleRateIn, 0, AUDIO_BUFFER_USAGE_STATIC);
+
+        if (audioBuffer == NULL)
+        {
+            TRACELOG(LOG_WARNING, "SOUND: Failed to create buffer");
+            return sound; // Early return to avoid dereferencing the audioBuffer null pointer
+        }
+
+        audioBuffer->sizeInFrames = source.stream.buffer->sizeInFrames;
+        audioBuffer->data = source.stream.buffer->data;
+#if defined(SUPPORT_FILEFORMAT_QOA)
+        // Compressed data is shared but every alias requires its own decoder
+        if (source.stream.buffer->qoa != NULL) audioBuffer->qoa = LoadSoundQoaDecoder(&source.stream.buffer->qoa->desc, source.stream.buffer->qoa->dataSize);
+#endif
+
+        // Source volume, priority, attenuation and bus are modified by the mixer, so they are copied by the mixer
+        ma_mutex_lock(&AUDIO.System.lock);
+        AudioCommand command = { .type = AUDIO_COMMAND_ALIAS, .buffer = audioBuffer, .source = source.stream.buffer };
+        PushAudioCommand(command);
+        ma_mutex_unlock(&AUDIO.System.lock);
 
         sound.frameCount = source.frameCount;
-        sound.stream.sampleRate = AUDIO.System.device.sampleRate;
-        sound.stream.sampleSize = 32;
-        sound.stream.channels = AUDIO_DEVICE_CHANNELS;
+        sound.stream.sampleRate = source.stream.sampleRate;
+        sound.stream.sampleSize = source.stream.sampleSize;
+        sound.stream.channels = source.stream.channels;
         sound.stream.buffer = audioBuffer;
     }
 
@@ -1023,13 +1780,9 @@ void UnloadSound(Sound sound)
 
 void UnloadSoundAlias(Sound alias)
 {
-    // Untrack and unload just the sound buffer, not the sample data, it is shared with the source for the alias
-    if (alias.stream.buffer != NULL)
-    {
-        UntrackAudioBuffer(alias.stream.buffer);
-        ma_data_converter_uninit(&alias.stream.buffer->converter, NULL);
-        RL_FREE(alias.stream.buffer);
-    }
+    // Unload just the sound buffer, not the sample data, it is shared with the source for the alias
+    // NOTE: Alias buffer does not own its data, so it is not freed by UnloadAudioBuffer()
+    UnloadAudioBuffer(alias.stream.buffer);
 }
 
 // Update sound buffer with new data
@@ -1037,8 +1790,20 @@ void UpdateSound(Sound sound, const void *data, int frameCount)
 {
     if (sound.stream.buffer != NULL)
     {
+#if defined(SUPPORT_FILEFORMAT_QOA)
+        if (sound.stream.buffer->qoa != NULL)
+        {
+            TRACELOG(LOG_WARNING, "SOUND: QOA compressed sounds can not be updated");
+            return;
+        }
+#endif
         StopAudioBuffer(sound.stream.buffer);
 
+        // Make sure mixer is not reading sound data anymore
+        ma_mutex_lock(&AUDIO.System.lock);
+        FlushAudioCommands();
+        ma_mutex_unlock(&AUDIO.System.lock);
+
         memcpy(sound.stream.buffer->data, data, frameCount*ma_get_bytes_per_frame(sound.stream.buffer->converter.formatIn, sound.stream.buffer->converter.channelsIn));
     }
 }
@@ -1220,6 +1985,94 @@ void SetSoundPan(Sound sound, float pan)
     SetAudioBufferPan(sound.stream.buffer, pan);
 }
 
+// Set mixing bus for a sound (AudioBus), default: AUDIO_BUS_SFX
+void SetSoundBus(Sound sound, int bus)
+{
+    SetAudioBufferBus(sound.stream.buffer, bus);
+}
+
+// Set sound emitter position and velocity, enabling 3d spatialization for the sound
+// NOTE: Distance attenuation, panning and doppler effect are computed by the mixer
+void SetSoundEmitter(Sound sound, Vector3 position, Vector3 velocity)
+{
+    SoundEmitter emitter = { sound, position, velocity };
+    UpdateSoundEmitters(&emitter, 1);
+}
+
+// Update multiple sound emitters at once, only one lock is required for all of them
+// NOTE: Emitters are written to a latest-value slot per sound, read by the mixer once per callback,
+// no mixer commands are used, so any number of emitters can be updated without filling commands queue
+void UpdateSoundEmitters(const SoundEmitter *emitters, int count)
+{
+    ma_mutex_lock(&AUDIO.System.lock);
+
+    for (int i = 0; i < count; i++)
+    {
+        if (emitters[i].sound.stream.buffer == NULL) continue;
+
+        float position[3] = { emitters[i].position.x, emitters[i].position.y, emitters[i].position.z };
+        float velocity[3] = { emitters[i].velocity.x, emitters[i].velocity.y, emitters[i].velocity.z };
+        SetAudioBufferEmitter(emitters[i].sound.stream.buffer, true, position, velocity);
+    }
+
+    ma_mutex_unlock(&AUDIO.System.lock);
+}
+
+// Set sound spatialization enabled/disabled, last emitter position and velocity are kept
+// NOTE: Disabled spatialization ramps the sound back to its volume and pan, without doppler effect
+void SetSoundSpatial(Sound sound, bool spatial)
+{
+    AudioBuffer *buffer = sound.stream.buffer;
+
+    if (buffer != NULL)
+    {
+        ma_mutex_lock(&AUDIO.System.lock);
+
+        float position[3] = { 0 };
+        float velocity[3] = { 0 };
+        for (int i = 0; i < 3; i++)
+        {
+            ma_uint32 bits[2] = { ma_atomic_load_32(&buffer->emitterSlot[1 + i]), ma_atomic_load_32(&buffer->emitterSlot[4 + i]) };
+            memcpy(&position[i], &bits[0], sizeof(float));
+            memcpy(&velocity[i], &bits[1], sizeof(float));
+        }
+
+        SetAudioBufferEmitter(buffer, spatial, position, velocity);
+
+        ma_mutex_unlock(&AUDIO.System.lock);
+    }
+}
+
+// Set sound distance attenuation model (SoundAttenuation), default: inverse, 1.0f to 1000.0f, rolloff 1.0f
+void SetSoundAttenuation(Sound sound, int model, float minDistance, float maxDistance, float rolloff)
+{
+    if (sound.stream.buffer != NULL)
+    {
+        if (minDistance <= 0.0f) minDistance = 0.0001f;
+        if (maxDistance < minDistance) maxDistance = minDistance;
+
+        ma_mutex_lock(&AUDIO.System.lock);
+        AudioCommand command = { .type = AUDIO_COMMAND_ATTENUATION, .buffer = sound.stream.buffer, .param = model };
+        command.vectors[0][0] = minDistance;
+        command.vectors[0][1] = maxDistance;
+        command.vectors[0][2] = rolloff;
+        PushAudioCommand(command);
+        ma_mutex_unlock(&AUDIO.System.lock);
+    }
+}
+
+// Set priority for a sound, higher priority sounds are mixed first when voices are limited (0 is default)
+void SetSoundPriority(Sound sound, int priority)
+{
+    if (sound.stream.buffer != NULL)
+    {
+        ma_mutex_lock(&AUDIO.System.lock);
+        AudioCommand command = { .type = AUDIO_COMMAND_PRIORITY, .buffer = sound.stream.buffer, .param = priority };
+        PushAudioCommand(command);
+        ma_mutex_unlock(&AUDIO.System.lock);
+    }
+}
+
 // Convert wave data to desired format
 void WaveFormat(Wave *wave, int sampleRate, int sampleSize, int channels)
 {
@@ -1382,7 +2235,7 @@ Music LoadMusicStream(const char *fileName)
 #if defined(SUPPORT_FILEFORMAT_MP3)
     else if (IsFileExtension(fileName, ".mp3"))
     {
-        drmp3 *ctxMp3 = RL_CALLOC(1, sizeof(drmp3));
+        drmp3 *ctxMp3 = RL_CALLOC(1, sizeof(MusicMp3));
         int result = drmp3_init_file(ctxMp3, fileName, NULL);
 
         if (result > 0)
@@ -1575,7 +2428,7 @@ Music LoadMusicStreamFromMemory(const char *fileType, const unsigned char *data,
 #if defined(SUPPORT_FILEFORMAT_MP3)
     else if ((strcmp(fileType, ".mp3") == 0) || (strcmp(fileType, ".MP3") == 0))
     {
-        drmp3 *ctxMp3 = RL_CALLOC(1, sizeof(drmp3));
+        drmp3 *ctxMp3 = RL_CALLOC(1, sizeof(MusicMp3));
         int success = drmp3_init_memory(ctxMp3, (const void*)data, dataSize, NULL);
 
         if (success)
@@ -1739,6 +2592,7 @@ bool IsMusicReady(Music music)
 // Unload music stream
 void UnloadMusicStream(Music music)
 {
+    SetMusicStreamThreaded(music, false);
     UnloadAudioStream(music.stream);
 
     if (music.ctxData != NULL)
@@ -1751,7 +2605,7 @@ void UnloadMusicStream(Music music)
         else if (music.ctxType == MUSIC_AUDIO_OGG) stb_vorbis_close((stb_vorbis *)music.ctxData);
 #endif
 #if defined(SUPPORT_FILEFORMAT_MP3)
-        else if (music.ctxType == MUSIC_AUDIO_MP3) { drmp3_uninit((drmp3 *)music.ctxData); RL_FREE(music.ctxData); }
+        else if (music.ctxType == MUSIC_AUDIO_MP3) { drmp3_uninit((drmp3 *)music.ctxData); RL_FREE(((MusicMp3 *)music.ctxData)->seekPoints); RL_FREE(music.ctxData); }
 #endif
 #if defined(SUPPORT_FILEFORMAT_QOA)
         else if (music.ctxType == MUSIC_AUDIO_QOA) qoaplay_close((qoaplay_desc *)music.ctxData);
@@ -1791,31 +2645,11 @@ void StopMusicStream(Music music)
 {
     StopAudioStream(music.stream);
 
-    switch (music.ctxType)
-    {
-#if defined(SUPPORT_FILEFORMAT_WAV)
-        case MUSIC_AUDIO_WAV: drwav_seek_to_first_pcm_frame((drwav *)music.ctxData); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_OGG)
-        case MUSIC_AUDIO_OGG: stb_vorbis_seek_start((stb_vorbis *)music.ctxData); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_MP3)
-        case MUSIC_AUDIO_MP3: drmp3_seek_to_start_of_stream((drmp3 *)music.ctxData); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_QOA)
-        case MUSIC_AUDIO_QOA: qoaplay_rewind((qoaplay_desc *)music.ctxData); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_FLAC)
-        case MUSIC_AUDIO_FLAC: drflac__seek_to_first_frame((drflac *)music.ctxData); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_XM)
-        case MUSIC_MODULE_XM: jar_xm_reset((jar_xm_context_t *)music.ctxData); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_MOD)
-        case MUSIC_MODULE_MOD: jar_mod_seek_start((jar_mod_context_t *)music.ctxData); break;
-#endif
-        default: break;
-    }
+    // In threaded mode, music context is owned by the decoder thread, it rewinds it on request
+    MusicStreamDecoder *decoder = (music.stream.buffer != NULL)? music.stream.buffer->decoder : NULL;
+
+    if (decoder != NULL) RequestMusicStreamDecoderSeek(decoder, 0);
+    else SeekMusicStreamContext(music, 0);
 }
 
 // Seek music to a certain position (in seconds)
@@ -1826,36 +2660,15 @@ void SeekMusicStream(Music music, float position)
 
     unsigned int positionInFrames = (unsigned int)(position*music.stream.sampleRate);
 
-    switch (music.ctxType)
-    {
-#if defined(SUPPORT_FILEFORMAT_WAV)
-        case MUSIC_AUDIO_WAV: drwav_seek_to_pcm_frame((drwav *)music.ctxData, positionInFrames); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_OGG)
-        case MUSIC_AUDIO_OGG: stb_vorbis_seek_frame((stb_vorbis *)music.ctxData, positionInFrames); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_MP3)
-        case MUSIC_AUDIO_MP3: drmp3_seek_to_pcm_frame((drmp3 *)music.ctxData, positionInFrames); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_QOA)
-        case MUSIC_AUDIO_QOA:
-        {
-            int qoaFrame = positionInFrames/QOA_FRAME_LEN;
-            qoaplay_seek_frame((qoaplay_desc *)music.ctxData, qoaFrame); // Seeks to QOA frame, not PCM frame
+    // In threaded mode, music context is owned by the decoder thread, it seeks it on request
+    MusicStreamDecoder *decoder = (music.stream.buffer != NULL)? music.stream.buffer->decoder : NULL;
 
-            // We need to compute QOA frame number and update positionInFrames
-            positionInFrames = ((qoaplay_desc *)music.ctxData)->sample_position;
-        } break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_FLAC)
-        case MUSIC_AUDIO_FLAC: drflac_seek_to_pcm_frame((drflac *)music.ctxData, positionInFrames); break;
-#endif
-        default: break;
+    if (decoder != NULL) RequestMusicStreamDecoderSeek(decoder, positionInFrames);
+    else
+    {
+        positionInFrames = SeekMusicStreamContext(music, positionInFrames);
+        ma_atomic_exchange_32(&music.stream.buffer->framesProcessed, positionInFrames);
     }
-
-    ma_mutex_lock(&AUDIO.System.lock);
-    music.stream.buffer->framesProcessed = positionInFrames;
-    ma_mutex_unlock(&AUDIO.System.lock);
 }
 
 // Update (re-fill) music buffers if data already processed
@@ -1863,7 +2676,13 @@ void UpdateMusicStream(Music music)
 {
     if (music.stream.buffer == NULL) return;
 
-    ma_mutex_lock(&AUDIO.System.lock);
+    // Music streams in threaded mode are decoded by the decoder thread,
+    // just keep looping state in sync with the program
+    if (music.stream.buffer->decoder != NULL)
+    {
+        ma_atomic_exchange_32(&music.stream.buffer->decoder->looping, (ma_uint32)music.looping);
+        return;
+    }
 
     unsigned int subBufferSizeInFrames = music.stream.buffer->sizeInFrames/2;
 
@@ -1881,142 +2700,127 @@ void UpdateMusicStream(Music music)
     // Check both sub-buffers to check if they require refilling
     for (int i = 0; i < 2; i++)
     {
-        if (!music.stream.buffer->isSubBufferProcessed[i]) continue; // No refilling required, move to next sub-buffer
+        if (!ma_atomic_load_32(&music.stream.buffer->isSubBufferProcessed[i])) continue; // No refilling required, move to next sub-buffer
+
+        unsigned int framesLeft = music.frameCount - ma_atomic_load_32(&music.stream.buffer->framesProcessed);  // Frames left to be processed
 
-        unsigned int framesLeft = music.frameCount - music.stream.buffer->framesProcessed;  // Frames left to be processed
         unsigned int framesToStream = 0;                 // Total frames to be streamed
 
         if ((framesLeft >= subBufferSizeInFrames) || music.looping) framesToStream = subBufferSizeInFrames;
         else framesToStream = framesLeft;
 
-        int frameCountStillNeeded = framesToStream;
-        int frameCountReadTotal = 0;
-
-        switch (music.ctxType)
-        {
-        #if defined(SUPPORT_FILEFORMAT_WAV)
-            case MUSIC_AUDIO_WAV:
-            {
-                if (music.stream.sampleSize == 16)
-                {
-                    while (true)
-                    {
-                        int frameCountRead = (int)drwav_read_pcm_frames_s16((drwav *)music.ctxData, frameCountStillNeeded, (short *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize));
-                        frameCountReadTotal += frameCountRead;
-                        frameCountStillNeeded -= frameCountRead;
-                        if (frameCountStillNeeded == 0) break;
-                        else drwav_seek_to_first_pcm_frame((drwav *)music.ctxData);
-                    }
-                }
-                else if (music.stream.sampleSize == 32)
-                {
-                    while (true)
-                    {
-                        int frameCountRead = (int)drwav_read_pcm_frames_f32((drwav *)music.ctxData, frameCountStillNeeded, (float *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize));
-                        frameCountReadTotal += frameCountRead;
-                        frameCountStillNeeded -= frameCountRead;
-                        if (frameCountStillNeeded == 0) break;
-                        else drwav_seek_to_first_pcm_frame((drwav *)music.ctxData);
-                    }
-                }
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_OGG)
-            case MUSIC_AUDIO_OGG:
-            {
-                while (true)
-                {
-                    int frameCountRead = stb_vorbis_get_samples_short_interleaved((stb_vorbis *)music.ctxData, music.stream.channels, (short *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize), frameCountStillNeeded*music.stream.channels);
-                    frameCountReadTotal += frameCountRead;
-                    frameCountStillNeeded -= frameCountRead;
-                    if (frameCountStillNeeded == 0) break;
-                    else stb_vorbis_seek_start((stb_vorbis *)music.ctxData);
-                }
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_MP3)
-            case MUSIC_AUDIO_MP3:
-            {
-                while (true)
-                {
-                    int frameCountRead = (int)drmp3_read_pcm_frames_f32((drmp3 *)music.ctxData, frameCountStillNeeded, (float *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize));
-                    frameCountReadTotal += frameCountRead;
-                    frameCountStillNeeded -= frameCountRead;
-                    if (frameCountStillNeeded == 0) break;
-                    else drmp3_seek_to_start_of_stream((drmp3 *)music.ctxData);
-                }
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_QOA)
-            case MUSIC_AUDIO_QOA:
-            {
-                unsigned int frameCountRead = qoaplay_decode((qoaplay_desc *)music.ctxData, (float *)AUDIO.System.pcmBuffer, framesToStream);
-                frameCountReadTotal += frameCountRead;
-                /*
-                while (true)
-                {
-                    int frameCountRead = (int)qoaplay_decode((qoaplay_desc *)music.ctxData, (float *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize),  frameCountStillNeeded);
-                    frameCountReadTotal += frameCountRead;
-                    frameCountStillNeeded -= frameCountRead;
-                    if (frameCountStillNeeded == 0) break;
-                    else qoaplay_rewind((qoaplay_desc *)music.ctxData);
-                }
-                */
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_FLAC)
-            case MUSIC_AUDIO_FLAC:
-            {
-                while (true)
-                {
-                    int frameCountRead = (int)drflac_read_pcm_frames_s16((drflac *)music.ctxData, frameCountStillNeeded, (short *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize));
-                    frameCountReadTotal += frameCountRead;
-                    frameCountStillNeeded -= frameCountRead;
-                    if (frameCountStillNeeded == 0) break;
-                    else drflac__seek_to_first_frame((drflac *)music.ctxData);
-                }
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_XM)
-            case MUSIC_MODULE_XM:
-            {
-                // NOTE: Internally we consider 2 channels generation, so sampleCount/2
-                if (AUDIO_DEVICE_FORMAT == ma_format_f32) jar_xm_generate_samples((jar_xm_context_t *)music.ctxData, (float *)AUDIO.System.pcmBuffer, framesToStream);
-                else if (AUDIO_DEVICE_FORMAT == ma_format_s16) jar_xm_generate_samples_16bit((jar_xm_context_t *)music.ctxData, (short *)AUDIO.System.pcmBuffer, framesToStream);
-                else if (AUDIO_DEVICE_FORMAT == ma_format_u8) jar_xm_generate_samples_8bit((jar_xm_context_t *)music.ctxData, (char *)AUDIO.System.pcmBuffer, framesToStream);
-                //jar_xm_reset((jar_xm_context_t *)music.ctxData);
+        // Music context is not accessed by the mixer, so the mixer can keep running while decoding
+        ReadMusicStreamFrames(music, AUDIO.System.pcmBuffer, framesToStream);
 
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_MOD)
-            case MUSIC_MODULE_MOD:
-            {
-                // NOTE: 3rd parameter (nbsample) specify the number of stereo 16bits samples you want, so sampleCount/2
-                jar_mod_fillbuffer((jar_mod_context_t *)music.ctxData, (short *)AUDIO.System.pcmBuffer, framesToStream, 0);
-                //jar_mod_seek_start((jar_mod_context_t *)music.ctxData);
+        UpdateAudioStream(music.stream, AUDIO.System.pcmBuffer, framesToStream);
+        ma_atomic_exchange_32(&music.stream.buffer->framesProcessed, ma_atomic_load_32(&music.stream.buffer->framesProcessed)%music.frameCount);
 
-            } break;
-        #endif
-            default: break;
+        if ((framesLeft <= subBufferSizeInFrames) && !music.looping)
+        {
+            // Streaming is ending, we filled latest frames from input
+            StopMusicStream(music);
+            return;
         }
+    }
+}
 
-        UpdateAudioStreamInLockedState(music.stream, AUDIO.System.pcmBuffer, framesToStream);
+// Set music stream to be decoded on a background thread (threaded mode)
+// NOTE: Decoded frames are pushed into a lock-free ring buffer consumed by the mixer,
+// in threaded mode UpdateMusicStream() does not decode, it only syncs music.looping
+void SetMusicStreamThreaded(Music music, bool threaded)
+{
+    AudioBuffer *buffer = music.stream.buffer;
 
-        music.stream.buffer->framesProcessed = music.stream.buffer->framesProcessed%music.frameCount;
+    if ((buffer == NULL) || (music.ctxData == NULL) || (music.frameCount == 0)) return;
+    if (threaded == (buffer->decoder != NULL)) return;
 
-        if (framesLeft <= subBufferSizeInFrames)
+#if defined(__EMSCRIPTEN__)
+    TRACELOG(LOG_WARNING, "STREAM: Threaded music decoding not supported on this platform");
+#else
+    if (threaded)
+    {
+        // Decoder thread is lazily created on first threaded music stream
+        if (!ma_atomic_load_32(&AUDIO.Decoder.running))
         {
-            if (!music.looping)
+            ma_atomic_exchange_32(&AUDIO.Decoder.running, 1);
+
+            if (ma_thread_create(&AUDIO.Decoder.thread, ma_thread_priority_normal, 0, MusicStreamDecoderThread, NULL, NULL) != MA_SUCCESS)
             {
-                ma_mutex_unlock(&AUDIO.System.lock);
-                // Streaming is ending, we filled latest frames from input
-                StopMusicStream(music);
+                ma_atomic_exchange_32(&AUDIO.Decoder.running, 0);
+                TRACELOG(LOG_WARNING, "STREAM: Failed to create music decoder thread");
                 return;
             }
         }
+
+        MusicStreamDecoder *decoder = (MusicStreamDecoder *)RL_CALLOC(1, sizeof(MusicStreamDecoder));
+
+        // Ring buffer must at least hold a complete stream buffer
+        ma_uint32 sizeInFrames = music.stream.sampleRate*MUSIC_STREAM_DECODER_BUFFER_MS/1000;
+        if (sizeInFrames < buffer->sizeInFrames) sizeInFrames = buffer->sizeInFrames;
+
+        if (ma_pcm_rb_init(buffer->converter.formatIn, buffer->converter.channelsIn, sizeInFrames, NULL, NULL, &decoder->ring) != MA_SUCCESS)
+        {
+            TRACELOG(LOG_WARNING, "STREAM: Failed to create music decoder ring buffer");
+            RL_FREE(decoder);
+            return;
+        }
+
+        decoder->music = music;
+        decoder->looping = (ma_uint32)music.looping;
+        decoder->state = MUSIC_DECODER_DECODING;
+
+        ma_mutex_lock(&AUDIO.Decoder.lock);
+        {
+            // Decoding continues from current context position, frames pending on sub-buffers are dropped
+            decoder->framesDecoded = ma_atomic_load_32(&buffer->framesProcessed)%music.frameCount;
+
+            ma_mutex_lock(&AUDIO.System.lock);
+            AudioCommand command = { .type = AUDIO_COMMAND_DECODER, .buffer = buffer, .decoder = decoder, .position = decoder->framesDecoded };
+            PushAudioCommand(command);
+            FlushAudioCommands();
+            ma_mutex_unlock(&AUDIO.System.lock);
+
+            decoder->next = AUDIO.Decoder.first;
+            AUDIO.Decoder.first = decoder;
+        }
+        ma_mutex_unlock(&AUDIO.Decoder.lock);
+
+        TRACELOG(LOG_INFO, "STREAM: Music stream decoding on background thread (%i frames buffer)", sizeInFrames);
     }
+    else
+    {
+        MusicStreamDecoder *decoder = buffer->decoder;
 
-    ma_mutex_unlock(&AUDIO.System.lock);
+        ma_mutex_lock(&AUDIO.Decoder.lock);
+        if (AUDIO.Decoder.first == decoder) AUDIO.Decoder.first = decoder->next;
+        else
+        {
+            MusicStreamDecoder *prev = AUDIO.Decoder.first;
+            while (prev->next != decoder) prev = prev->next;
+            prev->next = decoder->next;
+        }
+        ma_mutex_unlock(&AUDIO.Decoder.lock);
+
+        // Wait for decoder thread to finish current update, it could still be decoding a copy of the list
+        ma_mutex_lock(&AUDIO.Decoder.updateLock);
+        ma_mutex_unlock(&AUDIO.Decoder.updateLock);
+
+        // Music context is owned by the program again, apply last seek request not done by decoder thread
+        unsigned int position = decoder->framesDecoded;
+        if (ma_atomic_load_32(&decoder->seekGeneration) != decoder->resetGeneration) position = SeekMusicStreamContext(music, decoder->seekPosition);
+
+        // Polling continues from last decoded position, frames pending on ring buffer are dropped
+        // NOTE: Ring buffer is freed after, so wait for the mixer to stop reading from it
+        ma_mutex_lock(&AUDIO.System.lock);
+        AudioCommand command = { .type = AUDIO_COMMAND_DECODER, .buffer = buffer, .decoder = NULL, .position = position };
+        PushAudioCommand(command);
+        FlushAudioCommands();
+        ma_mutex_unlock(&AUDIO.System.lock);
+
+        ma_pcm_rb_uninit(&decoder->ring);
+        RL_FREE(decoder);
+    }
+#endif
 }
 
 // Check if any music is playing
@@ -2043,6 +2847,12 @@ void SetMusicPan(Music music, float pan)
     SetAudioBufferPan(music.stream.buffer, pan);
 }
 
+// Set mixing bus for a music (AudioBus), default: AUDIO_BUS_MUSIC
+void SetMusicBus(Music music, int bus)
+{
+    SetAudioBufferBus(music.stream.buffer, bus);
+}
+
 // Get music time length (in seconds)
 float GetMusicTimeLength(Music music)
 {
@@ -2070,17 +2880,21 @@ float GetMusicTimePlayed(Music music)
         else
 #endif
         {
-            ma_mutex_lock(&AUDIO.System.lock);
             //ma_uint32 frameSizeInBytes = ma_get_bytes_per_sample(music.stream.buffer->dsp.formatConverterIn.config.formatIn)*music.stream.buffer->dsp.formatConverterIn.config.channels;
-            int framesProcessed = (int)music.stream.buffer->framesProcessed;
-            int subBufferSize = (int)music.stream.buffer->sizeInFrames/2;
-            int framesInFirstBuffer = music.stream.buffer->isSubBufferProcessed[0]? 0 : subBufferSize;
-            int framesInSecondBuffer = music.stream.buffer->isSubBufferProcessed[1]? 0 : subBufferSize;
-            int framesSentToMix = music.stream.buffer->frameCursorPos%subBufferSize;
-            int framesPlayed = (framesProcessed - framesInFirstBuffer - framesInSecondBuffer + framesSentToMix)%(int)music.frameCount;
-            if (framesPlayed < 0) framesPlayed += music.frameCount;
-            secondsPlayed = (float)framesPlayed/music.stream.sampleRate;
-            ma_mutex_unlock(&AUDIO.System.lock);
+            int framesProcessed = (int)ma_atomic_load_32(&music.stream.buffer->framesProcessed);
+
+            // In threaded mode frames processed are the frames already sent to mix
+            if (music.stream.buffer->decoder != NULL) secondsPlayed = (float)(framesProcessed%(int)music.frameCount)/music.stream.sampleRate;
+            else
+            {
+                int subBufferSize = (int)music.stream.buffer->sizeInFrames/2;
+                int framesInFirstBuffer = ma_atomic_load_32(&music.stream.buffer->isSubBufferProcessed[0])? 0 : subBufferSize;
+                int framesInSecondBuffer = ma_atomic_load_32(&music.stream.buffer->isSubBufferProcessed[1])? 0 : subBufferSize;
+                int framesSentToMix = ma_atomic_load_32(&music.stream.buffer->frameCursorPos)%subBufferSize;
+                int framesPlayed = (framesProcessed - framesInFirstBuffer - framesInSecondBuffer + framesSentToMix)%(int)music.frameCount;
+                if (framesPlayed < 0) framesPlayed += music.frameCount;
+                secondsPlayed = (float)framesPlayed/music.stream.sampleRate;
+            }
         }
     }
 
@@ -2139,23 +2953,69 @@ void UnloadAudioStream(AudioStream stream)
 // Update audio stream buffers with data
 // NOTE 1: Only updates one buffer of the stream source: dequeue -> update -> queue
 // NOTE 2: To dequeue a buffer it needs to be processed: IsAudioStreamProcessed()
+// NOTE 3: Mixer never reads a processed sub-buffer, so it can be updated without locking,
+// it is just required to publish the data before marking it as not processed; frame cursor
+// is owned by the mixer, it is only requested to rewind when both sub-buffers were processed
 void UpdateAudioStream(AudioStream stream, const void *data, int frameCount)
 {
-    ma_mutex_lock(&AUDIO.System.lock);
-    UpdateAudioStreamInLockedState(stream, data, frameCount);
-    ma_mutex_unlock(&AUDIO.System.lock);
-}
+    if (stream.buffer != NULL)
+    {
+        bool isSubBufferProcessed[2] = { 0 };
+        isSubBufferProcessed[0] = (ma_atomic_load_32(&stream.buffer->isSubBufferProcessed[0]) != 0);
+        isSubBufferProcessed[1] = (ma_atomic_load_32(&stream.buffer->isSubBufferProcessed[1]) != 0);
+
+        if (isSubBufferProcessed[0] || isSubBufferProcessed[1])
+        {
+            ma_uint32 subBufferToUpdate = 0;
+
+            if (isSubBufferProcessed[0] && isSubBufferProcessed[1])
+            {
+                // Both buffers are available for updating
+                // Update the first one and make sure the cursor is moved back to the front
+                subBufferToUpdate = 0;
+                ma_atomic_exchange_32(&stream.buffer->cursorRewind, 1);
+            }
+            else
+            {
+                // Just update whichever sub-buffer is processed
+                subBufferToUpdate = (isSubBufferProcessed[0])? 0 : 1;
+            }
+
+            ma_uint32 subBufferSizeInFrames = stream.buffer->sizeInFrames/2;
+            unsigned char *subBuffer = stream.buffer->data + ((subBufferSizeInFrames*stream.channels*(stream.sampleSize/8))*subBufferToUpdate);
+
+            // Total frames processed in buffer is always the complete size, filled with 0 if required
+            ma_atomic_fetch_add_32(&stream.buffer->framesProcessed, subBufferSizeInFrames);
+
+            // Does this API expect a whole buffer to be updated in one go?
+            // Assuming so, but if not will need to change this logic
+            if (subBufferSizeInFrames >= (ma_uint32)frameCount)
+            {
+                ma_uint32 framesToWrite = (ma_uint32)frameCount;
+
+                ma_uint32 bytesToWrite = framesToWrite*stream.channels*(stream.sampleSize/8);
+                memcpy(subBuffer, data, bytesToWrite);
+
+                // Any leftover frames should be filled with zeros
+                ma_uint32 leftoverFrameCount = subBufferSizeInFrames - framesToWrite;
+
+                if (leftoverFrameCount > 0) memset(subBuffer + bytesToWrite, 0, leftoverFrameCount*stream.channels*(stream.sampleSize/8));
+
+                // Sub-buffer data (and cursor rewind request) is published before its processed state
+                ma_atomic_exchange_32(&stream.buffer->isSubBufferProcessed[subBufferToUpdate], 0);
+            }
+            else TRACELOG(LOG_WARNING, "STREAM: Attempting to write too many frames to buffer");
+        }
+        else TRACELOG(LOG_WARNING, "STREAM: Buffer not available for updating");
+    }
+}
 
 // Check if any audio stream buffers requires refill
 bool IsAudioStreamProcessed(AudioStream stream)
 {
     if (stream.buffer == NULL) return false;
 
-    bool result = false;
-    ma_mutex_lock(&AUDIO.System.lock);
-    result = stream.buffer->isSubBufferProcessed[0] || stream.buffer->isSubBufferProcessed[1];
-    ma_mutex_unlock(&AUDIO.System.lock);
-    return result;
+    return (ma_atomic_load_32(&stream.buffer->isSubBufferProcessed[0]) || ma_atomic_load_32(&stream.buffer->isSubBufferProcessed[1]));
 }
 
 // Play audio stream
@@ -2206,6 +3066,12 @@ void SetAudioStreamPan(AudioStream stream, float pan)
     SetAudioBufferPan(stream.buffer, pan);
 }
 
+// Set mixing bus for audio stream (AudioBus), default: AUDIO_BUS_MUSIC
+void SetAudioStreamBus(AudioStream stream, int bus)
+{
+    SetAudioBufferBus(stream.buffer, bus);
+}
+
 // Default size for new audio streams
 void SetAudioStreamBufferSizeDefault(int size)
 {
@@ -2218,7 +3084,8 @@ void SetAudioStreamCallback(AudioStream stream, AudioCallback callback)
     if (stream.buffer != NULL)
     {
         ma_mutex_lock(&AUDIO.System.lock);
-        stream.buffer->callback = callback;
+        AudioCommand command = { .type = AUDIO_COMMAND_CALLBACK, .buffer = stream.buffer, .callback = callback };
+        PushAudioCommand(command);
         ma_mutex_unlock(&AUDIO.System.lock);
     }
 }
@@ -2228,24 +3095,12 @@ void SetAudioStreamCallback(AudioStream stream, AudioCallback callback)
 // a given stream, we iterate through the list to find the end. That way we don't need a pointer to the last element
 void AttachAudioStreamProcessor(AudioStream stream, AudioCallback process)
 {
-    ma_mutex_lock(&AUDIO.System.lock);
-
     rAudioProcessor *processor = (rAudioProcessor *)RL_CALLOC(1, sizeof(rAudioProcessor));
     processor->process = process;
 
-    rAudioProcessor *last = stream.buffer->processor;
-
-    while (last && last->next)
-    {
-        last = last->next;
-    }
-    if (last)
-    {
-        processor->prev = last;
-        last->next = processor;
-    }
-    else stream.buffer->processor = processor;
-
+    ma_mutex_lock(&AUDIO.System.lock);
+    AudioCommand command = { .type = AUDIO_COMMAND_ATTACH_PROCESSOR, .buffer = stream.buffer, .processor = processor };
+    PushAudioCommand(command);
     ma_mutex_unlock(&AUDIO.System.lock);
 }
 
@@ -2254,18 +3109,21 @@ void DetachAudioStreamProcessor(AudioStream stream, AudioCallback process)
 {
     ma_mutex_lock(&AUDIO.System.lock);
 
+    // Processors list is only modified by the mixer executing commands,
+    // once all commands are executed it can be safely traversed
+    FlushAudioCommands();
+
     rAudioProcessor *processor = stream.buffer->processor;
 
     while (processor)
     {
         rAudioProcessor *next = processor->next;
-        rAudioProcessor *prev = processor->prev;
 
         if (processor->process == process)
         {
-            if (stream.buffer->processor == processor) stream.buffer->processor = next;
-            if (prev) prev->next = next;
-            if (next) next->prev = prev;
+            AudioCommand command = { .type = AUDIO_COMMAND_DETACH_PROCESSOR, .buffer = stream.buffer, .processor = processor };
+            PushAudioCommand(command);
+            FlushAudioCommands();
 
             RL_FREE(processor);
         }
@@ -2281,24 +3139,12 @@ void DetachAudioStreamProcessor(AudioStream stream, AudioCallback process)
 // these two work on the already mixed output just before sending it to the sound hardware
 void AttachAudioMixedProcessor(AudioCallback process)
 {
-    ma_mutex_lock(&AUDIO.System.lock);
-
     rAudioProcessor *processor = (rAudioProcessor *)RL_CALLOC(1, sizeof(rAudioProcessor));
     processor->process = process;
 
-    rAudioProcessor *last = AUDIO.mixedProcessor;
-
-    while (last && last->next)
-    {
-        last = last->next;
-    }
-    if (last)
-    {
-        processor->prev = last;
-        last->next = processor;
-    }
-    else AUDIO.mixedProcessor = processor;
-
+    ma_mutex_lock(&AUDIO.System.lock);
+    AudioCommand command = { .type = AUDIO_COMMAND_ATTACH_PROCESSOR, .buffer = NULL, .processor = processor };
+    PushAudioCommand(command);
     ma_mutex_unlock(&AUDIO.System.lock);
 }
 
@@ -2307,18 +3153,19 @@ void DetachAudioMixedProcessor(AudioCallback process)
 {
     ma_mutex_lock(&AUDIO.System.lock);
 
+    FlushAudioCommands();
+
     rAudioProcessor *processor = AUDIO.mixedProcessor;
 
     while (processor)
     {
         rAudioProcessor *next = processor->next;
-        rAudioProcessor *prev = processor->prev;
 
         if (processor->process == process)
         {
-            if (AUDIO.mixedProcessor == processor) AUDIO.mixedProcessor = next;
-            if (prev) prev->next = next;
-            if (next) next->prev = prev;
+            AudioCommand command = { .type = AUDIO_COMMAND_DETACH_PROCESSOR, .buffer = NULL, .processor = processor };
+            PushAudioCommand(command);
+            FlushAudioCommands();
 
             RL_FREE(processor);
         }
@@ -2347,21 +3194,33 @@ static ma_uint32 ReadAudioBufferFramesInInternalFormat(AudioBuffer *audioBuffer,
     if (audioBuffer->callback)
     {
         audioBuffer->callback(framesOut, frameCount);
-        audioBuffer->framesProcessed += frameCount;
+        ma_atomic_fetch_add_32(&audioBuffer->framesProcessed, frameCount);
 
         return frameCount;
     }
 
-    ma_uint32 subBufferSizeInFrames = (audioBuffer->sizeInFrames > 1)? audioBuffer->sizeInFrames/2 : audioBuffer->sizeInFrames;
-    ma_uint32 currentSubBufferIndex = audioBuffer->frameCursorPos/subBufferSizeInFrames;
-
-    if (currentSubBufferIndex > 1) return 0;
+    // Using music stream decoder ring buffer, filled on decoder thread
+    if (audioBuffer->decoder != NULL) return ReadMusicStreamDecoderFrames(audioBuffer, framesOut, frameCount);
 
     // Another thread can update the processed state of buffers, so
     // we just take a copy here to try and avoid potential synchronization problems
+    // NOTE: Sub-buffer data is published before its processed state
     bool isSubBufferProcessed[2] = { 0 };
-    isSubBufferProcessed[0] = audioBuffer->isSubBufferProcessed[0];
-    isSubBufferProcessed[1] = audioBuffer->isSubBufferProcessed[1];
+    isSubBufferProcessed[0] = (ma_atomic_load_32(&audioBuffer->isSubBufferProcessed[0]) != 0);
+    isSubBufferProcessed[1] = (ma_atomic_load_32(&audioBuffer->isSubBufferProcessed[1]) != 0);
+
+    // Both stream sub-buffers were processed and the first one was refilled, restart from it
+    // NOTE: Checked after processed state copy, so a refilled sub-buffer is never read before the rewind
+    if ((audioBuffer->usage == AUDIO_BUFFER_USAGE_STREAM) && ma_atomic_load_32(&audioBuffer->cursorRewind))
+    {
+        ma_atomic_exchange_32(&audioBuffer->cursorRewind, 0);
+        ma_atomic_exchange_32(&audioBuffer->frameCursorPos, 0);
+    }
+
+    ma_uint32 subBufferSizeInFrames = (audioBuffer->sizeInFrames > 1)? audioBuffer->sizeInFrames/2 : audioBuffer->sizeInFrames;
+    ma_uint32 currentSubBufferIndex = audioBuffer->frameCursorPos/subBufferSizeInFrames;
+
+    if (currentSubBufferIndex > 1) return 0;
 
     ma_uint32 frameSizeInBytes = ma_get_bytes_per_frame(audioBuffer->converter.formatIn, audioBuffer->converter.channelsIn);
 
@@ -2399,22 +3258,27 @@ static ma_uint32 ReadAudioBufferFramesInInternalFormat(AudioBuffer *audioBuffer,
         ma_uint32 framesToRead = totalFramesRemaining;
         if (framesToRead > framesRemainingInOutputBuffer) framesToRead = framesRemainingInOutputBuffer;
 
+#if defined(SUPPORT_FILEFORMAT_QOA)
+        if (audioBuffer->qoa != NULL) ReadSoundQoaFrames(audioBuffer, (short *)((unsigned char *)framesOut + (framesRead*frameSizeInBytes)), audioBuffer->frameCursorPos, framesToRead);
+        else
+#endif
         memcpy((unsigned char *)framesOut + (framesRead*frameSizeInBytes), audioBuffer->data + (audioBuffer->frameCursorPos*frameSizeInBytes), framesToRead*frameSizeInBytes);
-        audioBuffer->frameCursorPos = (audioBuffer->frameCursorPos + framesToRead)%audioBuffer->sizeInFrames;
+        ma_atomic_exchange_32(&audioBuffer->frameCursorPos, (audioBuffer->frameCursorPos + framesToRead)%audioBuffer->sizeInFrames);
         framesRead += framesToRead;
 
         // If we've read to the end of the buffer, mark it as processed
         if (framesToRead == framesRemainingInOutputBuffer)
         {
-            audioBuffer->isSubBufferProcessed[currentSubBufferIndex] = true;
+            ma_atomic_exchange_32(&audioBuffer->isSubBufferProcessed[currentSubBufferIndex], 1);
             isSubBufferProcessed[currentSubBufferIndex] = true;
 
             currentSubBufferIndex = (currentSubBufferIndex + 1)%2;
 
             // We need to break from this loop if we're not looping
+            // NOTE: Static buffers are stopped by the mixer, once resampler frames are consumed
             if (!audioBuffer->looping)
             {
-                StopAudioBufferInLockedState(audioBuffer);
+                if (audioBuffer->usage != AUDIO_BUFFER_USAGE_STATIC) StopAudioBufferInMixer(audioBuffer);
                 break;
             }
         }
@@ -2436,6 +3300,7 @@ static ma_uint32 ReadAudioBufferFramesInInternalFormat(AudioBuffer *audioBuffer,
 }
 
 // Reads audio data from an AudioBuffer object in device format, returned data will be in a format appropriate for mixing
+// NOTE: Data is kept at audio buffer sample rate, it is resampled by ReadAudioBufferFramesResampled()
 static ma_uint32 ReadAudioBufferFramesInMixingFormat(AudioBuffer *audioBuffer, float *framesOut, ma_uint32 frameCount)
 {
     // What's going on here is that we're continuously converting data from the AudioBuffer's internal format to the mixing format, which
@@ -2481,225 +3346,1810 @@ static ma_uint32 ReadAudioBufferFramesInMixingFormat(AudioBuffer *audioBuffer, f
     return totalOutputFramesProcessed;
 }
 
-// Sending audio data to device callback function
-// This function will be called when miniaudio needs more data
-// NOTE: All the mixing takes place here
-static void OnSendAudioDataToDevice(ma_device *pDevice, void *pFramesOut, const void *pFramesInput, ma_uint32 frameCount)
+// Write audio buffer emitter slot, read by the mixer once per callback
+// NOTE: Must be called with AUDIO.System.lock held, so only one writer is possible,
+// sequence is odd while writing, so the mixer never applies a partially written slot
+static void SetAudioBufferEmitter(AudioBuffer *buffer, bool spatial, const float *position, const float *velocity)
 {
-    (void)pDevice;
+    ma_uint32 sequence = ma_atomic_load_32(&buffer->emitterSequence);
+    ma_atomic_exchange_32(&buffer->emitterSequence, sequence + 1);
 
-    // Mixing is basically just an accumulation, we need to initialize the output buffer to 0
-    memset(pFramesOut, 0, frameCount*pDevice->playback.channels*ma_get_bytes_per_sample(pDevice->playback.format));
+    ma_atomic_exchange_32(&buffer->emitterSlot[0], spatial? 1 : 0);
+    for (int i = 0; i < 3; i++)
+    {
+        ma_uint32 bits[2] = { 0 };
+        memcpy(&bits[0], &position[i], sizeof(float));
+        memcpy(&bits[1], &velocity[i], sizeof(float));
+        ma_atomic_exchange_32(&buffer->emitterSlot[1 + i], bits[0]);
+        ma_atomic_exchange_32(&buffer->emitterSlot[4 + i], bits[1]);
+    }
 
-    // Using a mutex here for thread-safety which makes things not real-time
-    // This is unlikely to be necessary for this project, but may want to consider how you might want to avoid this
-    ma_mutex_lock(&AUDIO.System.lock);
+    ma_atomic_exchange_32(&buffer->emitterSequence, sequence + 2);
+}
+
+// Apply latest audio buffer emitter slot written by the program, called from the mixer
+// NOTE: A slot being written is skipped, it will be applied on next mixer callback
+static void UpdateAudioBufferEmitter(AudioBuffer *buffer)
+{
+    ma_uint32 sequence = ma_atomic_load_32(&buffer->emitterSequence);
+    if (((sequence & 1) != 0) || (sequence == buffer->emitterApplied)) return;
+
+    ma_uint32 slot[7] = { 0 };
+    for (int i = 0; i < 7; i++) slot[i] = ma_atomic_load_32(&buffer->emitterSlot[i]);
+    if (ma_atomic_load_32(&buffer->emitterSequence) != sequence) return;
+
+    buffer->emitterApplied = sequence;
+
+    float position[3] = { 0 };
+    float velocity[3] = { 0 };
+    memcpy(position, &slot[1], 3*sizeof(float));
+    memcpy(velocity, &slot[4], 3*sizeof(float));
+
+    if (slot[0] == 0)
     {
-        for (AudioBuffer *audioBuffer = AUDIO.Buffer.first; audioBuffer != NULL; audioBuffer = audioBuffer->next)
-        {
-            // Ignore stopped or paused sounds
-            if (!audioBuffer->playing || audioBuffer->paused) continue;
+        // Levels are ramped back to volume and pan by the mixer
+        buffer->spatial = false;
+        buffer->doppler = 1.0f;
+    }
+    else if (!buffer->spatial)
+    {
+        // First emitter update starts without ramping from non-spatial levels
+        buffer->spatial = true;
+        memcpy(buffer->emitterPosition, position, 3*sizeof(float));
+        UpdateAudioBufferSpatial(buffer);
+        GetAudioBufferMixLevels(buffer, AUDIO.System.device.playback.channels, buffer->mixLevels);
+    }
 
-            ma_uint32 framesRead = 0;
+    memcpy(buffer->emitterPosition, position, 3*sizeof(float));
+    memcpy(buffer->emitterVelocity, velocity, 3*sizeof(float));
+}
 
-            while (1)
-            {
-                if (framesRead >= frameCount) break;
+// Update audio buffer spatial parameters from emitter and listener, called from the mixer once per callback
+// NOTE: Distance attenuation, equal-power panning on listener right axis and doppler pitch shift
+static void UpdateAudioBufferSpatial(AudioBuffer *buffer)
+{
+    const float *listener = AUDIO.Listener.position;
 
-                // Just read as much data as we can from the stream
-                ma_uint32 framesToRead = (frameCount - framesRead);
+    // Vector from listener to emitter
+    float dir[3] = { buffer->emitterPosition[0] - listener[0], buffer->emitterPosition[1] - listener[1], buffer->emitterPosition[2] - listener[2] };
+    float distance = sqrtf(dir[0]*dir[0] + dir[1]*dir[1] + dir[2]*dir[2]);
 
-                while (framesToRead > 0)
-                {
-                    float tempBuffer[1024] = { 0 }; // Frames for stereo
-
-                    ma_uint32 framesToReadRightNow = framesToRead;
-                    if (framesToReadRightNow > sizeof(tempBuffer)/sizeof(tempBuffer[0])/AUDIO_DEVICE_CHANNELS)
-                    {
-                        framesToReadRightNow = sizeof(tempBuffer)/sizeof(tempBuffer[0])/AUDIO_DEVICE_CHANNELS;
-                    }
-
-                    ma_uint32 framesJustRead = ReadAudioBufferFramesInMixingFormat(audioBuffer, tempBuffer, framesToReadRightNow);
-                    if (framesJustRead > 0)
-                    {
-                        float *framesOut = (float *)pFramesOut + (framesRead*AUDIO.System.device.playback.channels);
-                        float *framesIn = tempBuffer;
-
-                        // Apply processors chain if defined
-                        rAudioProcessor *processor = audioBuffer->processor;
-                        while (processor)
-                        {
-                            processor->process(framesIn, framesJustRead);
-                            processor = processor->next;
-                        }
-
-                        MixAudioFrames(framesOut, framesIn, framesJustRead, audioBuffer);
-
-                        framesToRead -= framesJustRead;
-                        framesRead += framesJustRead;
-                    }
-
-                    if (!audioBuffer->playing)
-                    {
-                        framesRead = frameCount;
-                        break;
-                    }
-
-                    // If we weren't able to read all the frames we requested, break
-                    if (framesJustRead < framesToReadRightNow)
-                    {
-                        if (!audioBuffer->looping)
-                        {
-                            StopAudioBufferInLockedState(audioBuffer);
-                            break;
-                        }
-                        else
-                        {
-                            // Should never get here, but just for safety,
-                            // move the cursor position back to the start and continue the loop
-                            audioBuffer->frameCursorPos = 0;
-                            continue;
-                        }
-                    }
-                }
+    if (distance > 0.0001f)
+    {
+        dir[0] /= distance;
+        dir[1] /= distance;
+        dir[2] /= distance;
+    }
+    else dir[0] = dir[1] = dir[2] = 0.0f;
 
-                // If for some reason we weren't able to read every frame we'll need to break from the loop
-                // Not doing this could theoretically put us into an infinite loop
-                if (framesToRead > 0) break;
-            }
-        }
+    // Distance attenuation, distance is clamped to [minDistance, maxDistance]
+    float minDistance = buffer->minDistance;
+    float maxDistance = buffer->maxDistance;
+    float clamped = (distance < minDistance)? minDistance : ((distance > maxDistance)? maxDistance : distance);
+    float gain = 1.0f;
+
+    switch (buffer->attenuation)
+    {
+        case SOUND_ATTENUATION_INVERSE: gain = minDistance/(minDistance + buffer->rolloff*(clamped - minDistance)); break;
+        case SOUND_ATTENUATION_LINEAR: gain = (maxDistance > minDistance)? 1.0f - buffer->rolloff*(clamped - minDistance)/(maxDistance - minDistance) : 1.0f; break;
+        case SOUND_ATTENUATION_EXPONENTIAL: gain = powf(clamped/minDistance, -buffer->rolloff); break;
+        default: break;
     }
 
-    rAudioProcessor *processor = AUDIO.mixedProcessor;
-    while (processor)
+    if (gain < 0.0f) gain = 0.0f;
+    else if (gain > 1.0f) gain = 1.0f;
+
+    // Equal-power panning, considering emitter direction projected on listener right axis
+    const float *right = AUDIO.Listener.right;
+    float x = dir[0]*right[0] + dir[1]*right[1] + dir[2]*right[2];
+    float angle = (x + 1.0f)*PI/4.0f;
+
+    buffer->spatialLevels[0] = gain*cosf(angle);
+    buffer->spatialLevels[1] = gain*sinf(angle);
+    buffer->spatialGain = gain;
+
+    // Doppler shift, velocities projected on the emitter to listener axis
+    float doppler = 1.0f;
+
+    if ((AUDIO.Listener.dopplerFactor > 0.0f) && (distance > 0.0001f))
     {
-        processor->process(pFramesOut, frameCount);
-        processor = processor->next;
+        const float *vl = AUDIO.Listener.velocity;
+        const float *vs = buffer->emitterVelocity;
+        float speed = AUDIO_SPEED_OF_SOUND/AUDIO.Listener.dopplerFactor;
+
+        // Projected speeds are clamped below the speed of sound
+        float listenerSpeed = -(vl[0]*dir[0] + vl[1]*dir[1] + vl[2]*dir[2]);
+        float emitterSpeed = -(vs[0]*dir[0] + vs[1]*dir[1] + vs[2]*dir[2]);
+        if (listenerSpeed > speed*0.9f) listenerSpeed = speed*0.9f;
+        if (emitterSpeed > speed*0.9f) emitterSpeed = speed*0.9f;
+
+        doppler = (speed - listenerSpeed)/(speed - emitterSpeed);
+        if (doppler < 0.25f) doppler = 0.25f;
+        else if (doppler > 4.0f) doppler = 4.0f;
     }
 
-    ma_mutex_unlock(&AUDIO.System.lock);
+    buffer->doppler = doppler;
 }
 
-// Main mixing function, pretty simple in this project, just an accumulation
-// NOTE: framesOut is both an input and an output, it is initially filled with zeros outside of this function
-static void MixAudioFrames(float *framesOut, const float *framesIn, ma_uint32 frameCount, AudioBuffer *buffer)
+// Check if an audio bus does not modify its input, so frames can be mixed directly into master bus
+static bool IsAudioBusBypassed(rAudioBus *bus)
 {
-    const float localVolume = buffer->volume;
-    const ma_uint32 channels = AUDIO.System.device.playback.channels;
+    return ((bus->gain == 1.0f) && (bus->rampFrames == 0) && !bus->highPass.enabled && !bus->lowPass.enabled &&
+            ((bus->reverb == NULL) || !bus->reverb->enabled) && !bus->limiter.enabled);
+}
+
+// Reset audio bus effects state, when bus is not processed
+static void ResetAudioBusState(rAudioBus *bus)
+{
+    memset(bus->highPass.z1, 0, sizeof(bus->highPass.z1));
+    memset(bus->highPass.z2, 0, sizeof(bus->highPass.z2));
+    memset(bus->lowPass.z1, 0, sizeof(bus->lowPass.z1));
+    memset(bus->lowPass.z2, 0, sizeof(bus->lowPass.z2));
+    bus->limiter.gain = 1.0f;
+}
 
-    if (channels == 2)  // We consider panning
+// Set biquad filter coefficients for a low-pass or high-pass filter (RBJ audio EQ cookbook)
+static void SetAudioBiquad(AudioBiquad *biquad, int filter, float cutoff, float resonance)
+{
+    float sampleRate = (float)AUDIO.System.device.sampleRate;
+
+    biquad->enabled = (cutoff > 0.0f);
+    if (!biquad->enabled) return;
+
+    if (cutoff > sampleRate*0.49f) cutoff = sampleRate*0.49f;
+    if (resonance <= 0.0f) resonance = 0.7071f;
+
+    float w0 = 2.0f*PI*cutoff/sampleRate;
+    float cosw0 = cosf(w0);
+    float alpha = sinf(w0)/(2.0f*resonance);
+    float a0 = 1.0f + alpha;
+
+    if (filter == AUDIO_FILTER_HIGHPASS)
     {
-        const float left = buffer->pan;
-        const float right = 1.0f - left;
+        biquad->b0 = (1.0f + cosw0)*0.5f/a0;
+        biquad->b1 = -(1.0f + cosw0)/a0;
+    }
+    else
+    {
+        biquad->b0 = (1.0f - cosw0)*0.5f/a0;
+        biquad->b1 = (1.0f - cosw0)/a0;
+    }
 
-        // Fast sine approximation in [0..1] for pan law: y = 0.5f*x*(3 - x*x);
-        const float levels[2] = { localVolume*0.5f*left*(3.0f - left*left), localVolume*0.5f*right*(3.0f - right*right) };
+    biquad->b2 = biquad->b0;
+    biquad->a1 = -2.0f*cosw0/a0;
+    biquad->a2 = (1.0f - alpha)/a0;
+}
+
+// Process biquad filter in place
+static void ProcessAudioBiquad(AudioBiquad *biquad, float *frames, ma_uint32 frameCount, ma_uint32 channels)
+{
+    const float b0 = biquad->b0, b1 = biquad->b1, b2 = biquad->b2, a1 = biquad->a1, a2 = biquad->a2;
 
-        float *frameOut = framesOut;
-        const float *frameIn = framesIn;
+    // NOTE: Filter is recursive, channels are processed separately keeping state in registers
+    for (ma_uint32 c = 0; c < channels; c++)
+    {
+        float z1 = biquad->z1[c];
+        float z2 = biquad->z2[c];
 
         for (ma_uint32 frame = 0; frame < frameCount; frame++)
         {
-            frameOut[0] += (frameIn[0]*levels[0]);
-            frameOut[1] += (frameIn[1]*levels[1]);
+            float x = frames[frame*channels + c];
+            float y = b0*x + z1;
 
-            frameOut += 2;
-            frameIn += 2;
+            z1 = b1*x - a1*y + z2;
+            z2 = b2*x - a2*y;
+            frames[frame*channels + c] = y;
         }
+
+        // Avoid denormals once the filter input is silent
+        biquad->z1[c] = (fabsf(z1) < 1e-15f)? 0.0f : z1;
+        biquad->z2[c] = (fabsf(z2) < 1e-15f)? 0.0f : z2;
     }
-    else  // We do not consider panning
+}
+
+// Load reverb delay lines for the device sample rate
+// NOTE: Freeverb tunings are defined for 44100 Hz, right channel delay lines are 23 frames longer
+static AudioReverb *LoadAudioReverb(void)
+{
+    static const unsigned int combTuning[8] = { 1116, 1188, 1277, 1356, 1422, 1491, 1557, 1617 };
+    static const unsigned int allpassTuning[4] = { 556, 441, 341, 225 };
+    const float scale = (float)AUDIO.System.device.sampleRate/44100.0f;
+
+    unsigned int combSize[2][8] = { 0 };
+    unsigned int allpassSize[2][4] = { 0 };
+    unsigned int totalSize = 0;
+
+    for (int c = 0; c < 2; c++)
     {
-        for (ma_uint32 frame = 0; frame < frameCount; frame++)
+        for (int i = 0; i < 8; i++) { combSize[c][i] = (unsigned int)((combTuning[i] + c*23)*scale); totalSize += combSize[c][i]; }
+        for (int i = 0; i < 4; i++) { allpassSize[c][i] = (unsigned int)((allpassTuning[i] + c*23)*scale); totalSize += allpassSize[c][i]; }
+    }
+
+    AudioReverb *reverb = (AudioReverb *)RL_CALLOC(1, sizeof(AudioReverb) + totalSize*sizeof(float));
+    if (reverb == NULL) return NULL;
+
+    float *memory = (float *)(reverb + 1);
+
+    for (int c = 0; c < 2; c++)
+    {
+        for (int i = 0; i < 8; i++) { reverb->comb[c][i] = memory; reverb->combSize[c][i] = combSize[c][i]; memory += combSize[c][i]; }
+        for (int i = 0; i < 4; i++) { reverb->allpass[c][i] = memory; reverb->allpassSize[c][i] = allpassSize[c][i]; memory += allpassSize[c][i]; }
+    }
+
+    // Tail is decayed when output is silent for the longest path: longest comb filter and all allpass filters
+    reverb->tailFrames = combSize[1][7];
+    for (int i = 0; i < 4; i++) reverb->tailFrames += allpassSize[1][i];
+
+    return reverb;
+}
+
+// Reset reverb delay lines and filters state to silence
+static void ResetAudioReverb(AudioReverb *reverb)
+{
+    for (int c = 0; c < 2; c++)
+    {
+        for (int i = 0; i < 8; i++) memset(reverb->comb[c][i], 0, reverb->combSize[c][i]*sizeof(float));
+        for (int i = 0; i < 4; i++) memset(reverb->allpass[c][i], 0, reverb->allpassSize[c][i]*sizeof(float));
+    }
+
+    memset(reverb->combStore, 0, sizeof(reverb->combStore));
+}
+
+// Process reverb in place, input is the sum of left and right channels
+static void ProcessAudioReverb(AudioReverb *reverb, float *frames, ma_uint32 frameCount, ma_uint32 channels)
+{
+    const int outputs = (channels < 2)? channels : 2;
+    const float damp1 = reverb->damping;
+    const float damp2 = 1.0f - reverb->damping;
+    const float feedback = reverb->feedback;
+
+    for (ma_uint32 frame = 0; frame < frameCount; frame++)
+    {
+        float *frameOut = frames + frame*channels;
+        float input = (frameOut[0] + ((channels > 1)? frameOut[1] : frameOut[0]))*0.015f;
+
+        for (int c = 0; c < outputs; c++)
         {
-            for (ma_uint32 c = 0; c < channels; c++)
+            float out = 0.0f;
+
+            // Parallel comb filters, feedback is lowpass filtered for high frequencies damping
+            for (int i = 0; i < 8; i++)
             {
-                float *frameOut = framesOut + (frame*channels);
-                const float *frameIn = framesIn + (frame*channels);
+                float *line = reverb->comb[c][i];
+                unsigned int index = reverb->combIndex[c][i];
+                float delayed = line[index];
+
+                reverb->combStore[c][i] = delayed*damp2 + reverb->combStore[c][i]*damp1;
+                if (fabsf(reverb->combStore[c][i]) < 1e-15f) reverb->combStore[c][i] = 0.0f;
+
+                line[index] = input + reverb->combStore[c][i]*feedback;
+                reverb->combIndex[c][i] = (index + 1 < reverb->combSize[c][i])? index + 1 : 0;
+                out += delayed;
+            }
+
+            // Series allpass filters, for diffusion
+            for (int i = 0; i < 4; i++)
+            {
+                float *line = reverb->allpass[c][i];
+                unsigned int index = reverb->allpassIndex[c][i];
+                float delayed = line[index];
+
+                if (fabsf(delayed) < 1e-15f) delayed = 0.0f;
 
-                // Output accumulates input multiplied by volume to provided output (usually 0)
-                frameOut[c] += (frameIn[c]*localVolume);
+                line[index] = out + delayed*0.5f;
+                reverb->allpassIndex[c][i] = (index + 1 < reverb->allpassSize[c][i])? index + 1 : 0;
+                out = delayed - out;
             }
+
+            frameOut[c] = frameOut[c]*reverb->dry + out*reverb->wet;
         }
     }
 }
 
-// Check if an audio buffer is playing, assuming the audio system mutex has been locked
-static bool IsAudioBufferPlayingInLockedState(AudioBuffer *buffer)
+// Process peak limiter in place
+static void ProcessAudioLimiter(AudioLimiter *limiter, float *frames, ma_uint32 frameCount, ma_uint32 channels)
 {
-    bool result = false;
+    float gain = limiter->gain;
 
-    if (buffer != NULL) result = (buffer->playing && !buffer->paused);
+    for (ma_uint32 frame = 0; frame < frameCount; frame++)
+    {
+        float *frameOut = frames + frame*channels;
+        float peak = 0.0f;
 
-    return result;
+        for (ma_uint32 c = 0; c < channels; c++) peak = (fabsf(frameOut[c]) > peak)? fabsf(frameOut[c]) : peak;
+
+        // Gain reduction is applied instantly, and released exponentially
+        float target = (peak > limiter->threshold)? limiter->threshold/peak : 1.0f;
+        gain = (target < gain)? target : target + (gain - target)*limiter->release;
+
+        for (ma_uint32 c = 0; c < channels; c++) frameOut[c] *= gain;
+    }
+
+    limiter->gain = gain;
 }
 
-// Stop an audio buffer, assuming the audio system mutex has been locked
-static void StopAudioBufferInLockedState(AudioBuffer *buffer)
+// Process audio bus effects in place: filters, reverb, gain and limiter
+static void ProcessAudioBus(rAudioBus *bus, float *frames, ma_uint32 frameCount)
 {
-    if (buffer != NULL)
+    const ma_uint32 channels = AUDIO.System.device.playback.channels;
+
+    if (bus->highPass.enabled) ProcessAudioBiquad(&bus->highPass, frames, frameCount, channels);
+    if (bus->lowPass.enabled) ProcessAudioBiquad(&bus->lowPass, frames, frameCount, channels);
+    if ((bus->reverb != NULL) && bus->reverb->enabled) ProcessAudioReverb(bus->reverb, frames, frameCount, channels);
+
+    // Bus volume changes are ramped linearly over AUDIO_VOLUME_RAMP_FRAMES, as audio buffers volume
+    ma_uint32 frame = 0;
+
+    for (; (frame < frameCount) && (bus->rampFrames > 0); frame++, bus->rampFrames--)
     {
-        if (IsAudioBufferPlayingInLockedState(buffer))
-        {
-            buffer->playing = false;
-            buffer->paused = false;
-            buffer->frameCursorPos = 0;
-            buffer->framesProcessed = 0;
-            buffer->isSubBufferProcessed[0] = true;
-            buffer->isSubBufferProcessed[1] = true;
-        }
+        bus->gain += bus->gainStep;
+        for (ma_uint32 c = 0; c < channels; c++) frames[frame*channels + c] *= bus->gain;
+    }
+
+    if (bus->rampFrames == 0) bus->gain = bus->volume;
+
+    if (bus->gain != 1.0f)
+    {
+        const float gain = bus->gain;
+        for (ma_uint32 i = frame*channels; i < frameCount*channels; i++) frames[i] *= gain;
     }
+
+    if (bus->limiter.enabled) ProcessAudioLimiter(&bus->limiter, frames, frameCount, channels);
 }
 
-// Update audio stream, assuming the audio system mutex has been locked
-static void UpdateAudioStreamInLockedState(AudioStream stream, const void *data, int frameCount)
+// Mix buses into master bus and apply master bus effects
+// NOTE: Buses without input frames are only processed while their reverb tail is ringing,
+// tail is decayed once output stays below AUDIO_REVERB_SILENCE_LEVEL for the reverb longest path
+static void MixAudioBuses(float *framesOut, ma_uint32 frameCount)
 {
-    if (stream.buffer != NULL)
+    const ma_uint32 channels = AUDIO.System.device.playback.channels;
+    const float levels[2] = { 1.0f, 1.0f };
+
+    for (int i = AUDIO_BUS_MASTER + 1; i < AUDIO_BUS_COUNT; i++)
     {
-        if (stream.buffer->isSubBufferProcessed[0] || stream.buffer->isSubBufferProcessed[1])
-        {
-            ma_uint32 subBufferToUpdate = 0;
+        rAudioBus *bus = &AUDIO.Bus.buses[i];
+        AudioReverb *reverb = ((bus->reverb != NULL) && bus->reverb->enabled)? bus->reverb : NULL;
 
-            if (stream.buffer->isSubBufferProcessed[0] && stream.buffer->isSubBufferProcessed[1])
-            {
-                // Both buffers are available for updating
-                // Update the first one and make sure the cursor is moved back to the front
-                subBufferToUpdate = 0;
-                stream.buffer->frameCursorPos = 0;
-            }
+        if (bus->active) bus->tailSilentFrames = 0;
+        else
+        {
+            if ((reverb != NULL) && (bus->tailSilentFrames < reverb->tailFrames)) memset(bus->frames, 0, frameCount*channels*sizeof(float));
             else
             {
-                // Just update whichever sub-buffer is processed
-                subBufferToUpdate = (stream.buffer->isSubBufferProcessed[0])? 0 : 1;
+                ResetAudioBusState(bus);
+                continue;
             }
+        }
 
-            ma_uint32 subBufferSizeInFrames = stream.buffer->sizeInFrames/2;
-            unsigned char *subBuffer = stream.buffer->data + ((subBufferSizeInFrames*stream.channels*(stream.sampleSize/8))*subBufferToUpdate);
+        ProcessAudioBus(bus, bus->frames, frameCount);
+        MixAudioSamples(framesOut, bus->frames, frameCount*channels, levels);
 
-            // Total frames processed in buffer is always the complete size, filled with 0 if required
-            stream.buffer->framesProcessed += subBufferSizeInFrames;
+        if (!bus->active)
+        {
+            float peak = 0.0f;
+            for (ma_uint32 j = 0; j < frameCount*channels; j++) if (fabsf(bus->frames[j]) > peak) peak = fabsf(bus->frames[j]);
 
-            // Does this API expect a whole buffer to be updated in one go?
-            // Assuming so, but if not will need to change this logic
-            if (subBufferSizeInFrames >= (ma_uint32)frameCount)
-            {
-                ma_uint32 framesToWrite = (ma_uint32)frameCount;
+            if (peak < AUDIO_REVERB_SILENCE_LEVEL) bus->tailSilentFrames += frameCount;
+            else bus->tailSilentFrames = 0;
 
-                ma_uint32 bytesToWrite = framesToWrite*stream.channels*(stream.sampleSize/8);
-                memcpy(subBuffer, data, bytesToWrite);
+            // Decayed tail is cleared, so next input starts from silence
+            if (bus->tailSilentFrames >= reverb->tailFrames) ResetAudioReverb(reverb);
+        }
 
-                // Any leftover frames should be filled with zeros
-                ma_uint32 leftoverFrameCount = subBufferSizeInFrames - framesToWrite;
+        bus->active = false;
+    }
 
-                if (leftoverFrameCount > 0) memset(subBuffer + bytesToWrite, 0, leftoverFrameCount*stream.channels*(stream.sampleSize/8));
+    if (!IsAudioBusBypassed(&AUDIO.Bus.buses[AUDIO_BUS_MASTER])) ProcessAudioBus(&AUDIO.Bus.buses[AUDIO_BUS_MASTER], framesOut, frameCount);
+}
 
-                stream.buffer->isSubBufferProcessed[subBufferToUpdate] = false;
-            }
-            else TRACELOG(LOG_WARNING, "STREAM: Attempting to write too many frames to buffer");
-        }
-        else TRACELOG(LOG_WARNING, "STREAM: Buffer not available for updating");
+// Zeroth order modified Bessel function of the first kind, required for Kaiser window
+static double BesselI0(double x)
+{
+    double result = 1.0;
+    double term = 1.0;
+
+    for (int k = 1; k < 32; k++)
+    {
+        term *= (x/(2.0*k))*(x/(2.0*k));
+        result += term;
+        if (term < result*1e-12) break;
     }
+
+    return result;
 }
 
+// Load resampler polyphase filter table: AUDIO_RESAMPLER_PHASES phases of taps coefficients
+// NOTE: Two taps table is linear interpolation, longer ones are Kaiser windowed-sinc
+static float *LoadAudioResamplerTable(int taps, double cutoff, double beta)
+{
+    float *table = (float *)RL_MALLOC(AUDIO_RESAMPLER_PHASES*taps*sizeof(float));
+    int half = taps/2;
+
+    for (int phase = 0; phase < AUDIO_RESAMPLER_PHASES; phase++)
+    {
+        double frac = (double)phase/AUDIO_RESAMPLER_PHASES;
+        double sum = 0.0;
+        float *coeffs = table + phase*taps;
+
+        for (int k = 0; k < taps; k++)
+        {
+            // Tap distance to interpolated position, taps cover frames [i - half + 1, i + half]
+            double x = (double)(k - (half - 1)) - frac;
+            double value = 0.0;
+
+            if (taps == 2) value = 1.0 - fabs(x);
+            else
+            {
+                double sinc = (x == 0.0)? 1.0 : sin(PI*cutoff*x)/(PI*cutoff*x);
+                double w = x/half;
+                double window = (fabs(w) >= 1.0)? 0.0 : BesselI0(beta*sqrt(1.0 - w*w))/BesselI0(beta);
+
+                value = cutoff*sinc*window;
+            }
+
+            coeffs[k] = (float)value;
+            sum += value;
+        }
+
+        // Normalize phase gain to unity, avoiding amplitude ripple between phases
+        for (int k = 0; k < taps; k++) coeffs[k] = (float)(coeffs[k]/sum);
+    }
+
+    return table;
+}
+
+// Load resampler polyphase filter tables for a quality, if not loaded yet
+// NOTE: Sinc tables cutoff is scaled down for every downsampling ratio, avoiding aliasing
+static void LoadAudioResamplerTables(int quality)
+{
+    static const double cutoffs[3] = { 1.0, 0.85, 0.95 };
+    static const double betas[3] = { 0.0, 5.0, 8.0 };
+    int count = (quality == AUDIO_RESAMPLE_LINEAR)? 1 : AUDIO_RESAMPLER_RATIOS;
+
+    for (int i = 0; i < count; i++)
+    {
+        if (AUDIO.Resampler.tables[quality][i] == NULL)
+        {
+            AUDIO.Resampler.tables[quality][i] = LoadAudioResamplerTable(AUDIO.Resampler.taps[quality], cutoffs[quality]*pow(2.0, -i/4.0), betas[quality]);
+        }
+    }
+}
+
+// Get resampler sinc table index for a resampling step
+// NOTE: Tables are spaced by a quarter octave, next ratio is used so cutoff is always below output Nyquist frequency
+static int GetAudioResamplerRatioIndex(double step)
+{
+    if (step <= 1.0) return 0;
+
+    int index = (int)ceil(4.0*log2(step) - 1e-9);
+
+    return (index < AUDIO_RESAMPLER_RATIOS)? index : (AUDIO_RESAMPLER_RATIOS - 1);
+}
+
+// Get audio buffer resampling step: input frames per output frame, considering pitch
+static double GetAudioBufferResampleStep(AudioBuffer *buffer)
+{
+    // Pitching is just an adjustment of the sample rate
+    // Note that this changes the duration of the sound:
+    //  - higher pitches will make the sound faster
+    //  - lower pitches make it slower
+    return (double)buffer->converter.sampleRateIn*buffer->pitch*buffer->doppler/AUDIO.System.device.sampleRate;
+}
+
+// Reset audio buffer resampler, frames previous to first one are silence
+static void ResetAudioResampler(AudioBuffer *buffer)
+{
+    AudioResampler *resampler = &buffer->resampler;
+
+    memset(resampler->frames, 0, sizeof(resampler->frames));
+    resampler->frameCount = AUDIO_RESAMPLER_MAX_TAPS/2 - 1;
+    resampler->position = (double)resampler->frameCount;
+    resampler->endFrame = 0;
+    resampler->ended = false;
+    resampler->lowPassStep = 0.0;
+    memset(resampler->lowPass, 0, sizeof(resampler->lowPass));
+}
+
+// Reads audio data from an AudioBuffer object resampled to device sample rate, in mixing format
+// NOTE: Pitch changes only modify the resampling step, so they can be continuous and cheap
+static ma_uint32 ReadAudioBufferFramesResampled(AudioBuffer *audioBuffer, float *framesOut, ma_uint32 frameCount)
+{
+    AudioResampler *resampler = &audioBuffer->resampler;
+    const int quality = AUDIO.Resampler.quality;
+    const int taps = AUDIO.Resampler.taps[quality];
+    const int channels = AUDIO_DEVICE_CHANNELS;
+    const int windowOffset = AUDIO_RESAMPLER_MAX_TAPS/2 - taps/2;     // Shorter filters are centered on the window
+    const double step = GetAudioBufferResampleStep(audioBuffer);
+    const ma_uint32 windowCapacity = AUDIO_RESAMPLER_MAX_TAPS + AUDIO_RESAMPLER_BLOCK_FRAMES;
+
+    // Sinc filters cutoff is scaled by the downsampling ratio, linear interpolation is low-pass filtered instead
+    const int ratioIndex = (quality == AUDIO_RESAMPLE_LINEAR)? 0 : GetAudioResamplerRatioIndex(step);
+    const float *table = AUDIO.Resampler.tables[quality][ratioIndex];
+    const bool lowPass = (quality == AUDIO_RESAMPLE_LINEAR) && (step != 1.0);
+
+    if (lowPass && (resampler->lowPassStep != step))
+    {
+        // Cutoff at the lowest sample rate Nyquist frequency, filters run at the highest sample rate:
+        // input frames are filtered when downsampling, output frames are filtered when upsampling
+        float cutoff = 0.5f*AUDIO.System.device.sampleRate*(float)((step < 1.0)? step : 1.0/step);
+
+        SetAudioBiquad(&resampler->lowPass[0], AUDIO_FILTER_LOWPASS, cutoff, 0.5412f);
+        SetAudioBiquad(&resampler->lowPass[1], AUDIO_FILTER_LOWPASS, cutoff, 1.3066f);
+        resampler->lowPassStep = step;
+    }
+
+    ma_uint32 framesRead = 0;
+
+    while (framesRead < frameCount)
+    {
+        unsigned int index = (unsigned int)resampler->position;
+
+        if (resampler->ended && (index >= resampler->endFrame)) break;
+
+        // Window must contain frames [index - MAX_TAPS/2 + 1, index + MAX_TAPS/2], refill it when required
+        if ((index + AUDIO_RESAMPLER_MAX_TAPS/2) >= resampler->frameCount)
+        {
+            unsigned int discard = index - (AUDIO_RESAMPLER_MAX_TAPS/2 - 1);
+            unsigned int framesKept = resampler->frameCount - discard;
+
+            memmove(resampler->frames, resampler->frames + discard*channels, framesKept*channels*sizeof(float));
+            resampler->frameCount = framesKept;
+            resampler->position -= discard;
+            if (resampler->ended) resampler->endFrame -= discard;
+
+            ma_uint32 framesToRead = windowCapacity - framesKept;
+            ma_uint32 framesJustRead = 0;
+
+            if (!resampler->ended)
+            {
+                framesJustRead = ReadAudioBufferFramesInMixingFormat(audioBuffer, resampler->frames + framesKept*channels, framesToRead);
+
+                if (lowPass && (step > 1.0))
+                {
+                    ProcessAudioBiquad(&resampler->lowPass[0], resampler->frames + framesKept*channels, framesJustRead, channels);
+                    ProcessAudioBiquad(&resampler->lowPass[1], resampler->frames + framesKept*channels, framesJustRead, channels);
+                }
+
+                // Source data ended, remaining frames are filtered against silence
+                if (framesJustRead < framesToRead)
+                {
+                    resampler->ended = true;
+                    resampler->endFrame = framesKept + framesJustRead;
+                }
+            }
+
+            memset(resampler->frames + (framesKept + framesJustRead)*channels, 0, (framesToRead - framesJustRead)*channels*sizeof(float));
+            resampler->frameCount = windowCapacity;
+            continue;
+        }
+
+        float *frameOut = framesOut + framesRead*channels;
+        int phase = (int)((resampler->position - index)*AUDIO_RESAMPLER_PHASES);
+
+        // First phase is always an exact input frame, no filtering required (i.e. pitch 1.0 without resampling),
+        // unless sinc cutoff is scaled for downsampling
+        if ((phase == 0) && (ratioIndex == 0)) memcpy(frameOut, resampler->frames + index*channels, channels*sizeof(float));
+        else
+        {
+            const float *coeffs = table + phase*taps;
+            const float *frameIn = resampler->frames + (index - (AUDIO_RESAMPLER_MAX_TAPS/2 - 1) + windowOffset)*channels;
+
+            for (int c = 0; c < channels; c++)
+            {
+                float sum = 0.0f;
+                for (int k = 0; k < taps; k++) sum += coeffs[k]*frameIn[k*channels + c];
+                frameOut[c] = sum;
+            }
+        }
+
+        resampler->position += step;
+        framesRead++;
+    }
+
+    if (lowPass && (step < 1.0))
+    {
+        ProcessAudioBiquad(&resampler->lowPass[0], framesOut, framesRead, channels);
+        ProcessAudioBiquad(&resampler->lowPass[1], framesOut, framesRead, channels);
+    }
+
+    return framesRead;
+}
+
+// Sending audio data to device callback function
+// This function will be called when miniaudio needs more data
+// NOTE: All the mixing takes place here
+static void OnSendAudioDataToDevice(ma_device *pDevice, void *pFramesOut, const void *pFramesInput, ma_uint32 frameCount)
+{
+    (void)pDevice;
+
+    // Mixing is basically just an accumulation, we need to initialize the output buffer to 0
+    memset(pFramesOut, 0, frameCount*pDevice->playback.channels*ma_get_bytes_per_sample(pDevice->playback.format));
+
+    // Mixer state is only modified here, executing commands queued by the program,
+    // so no lock is required and the callback never waits for the program
+    ExecuteAudioCommands();
+
+    // Select voices to be mixed, it bounds mixing cost independently of the number of sounds playing
+    UpdateAudioVoices();
+
+    // Frames are mixed in blocks, so buses frames do not need to be allocated for the device period size
+    for (ma_uint32 blockStart = 0; blockStart < frameCount; blockStart += AUDIO_BUS_BLOCK_FRAMES)
+    {
+        ma_uint32 blockFrames = ((frameCount - blockStart) < AUDIO_BUS_BLOCK_FRAMES)? (frameCount - blockStart) : AUDIO_BUS_BLOCK_FRAMES;
+        float *blockOut = (float *)pFramesOut + (blockStart*AUDIO.System.device.playback.channels);
+
+        for (AudioBuffer *audioBuffer = AUDIO.Buffer.first; audioBuffer != NULL; audioBuffer = audioBuffer->next)
+        {
+            // Ignore stopped or paused sounds
+            if (!audioBuffer->playing || audioBuffer->paused) continue;
+
+            // Virtual voices are not mixed, just advanced, but voices mixed on last block are faded out first
+            if (audioBuffer->isVirtual)
+            {
+                if (audioBuffer->wasMixed) DemoteAudioVoice(audioBuffer, blockFrames);
+                else
+                {
+                    UpdateAudioVoiceVirtual(audioBuffer, blockFrames);
+                    continue;
+                }
+            }
+            else if (audioBuffer->wasVirtual) PromoteAudioVoice(audioBuffer);
+
+            // Audio buffers are mixed into their bus, unless the bus does not modify them
+            rAudioBus *bus = &AUDIO.Bus.buses[audioBuffer->bus];
+            float *framesOut = blockOut;
+
+            if ((audioBuffer->bus != AUDIO_BUS_MASTER) && !IsAudioBusBypassed(bus))
+            {
+                if (!bus->active) memset(bus->frames, 0, blockFrames*AUDIO.System.device.playback.channels*sizeof(float));
+                bus->active = true;
+                framesOut = bus->frames;
+            }
+
+            MixAudioBuffer(audioBuffer, framesOut, blockFrames);
+            audioBuffer->wasMixed = !audioBuffer->isVirtual;
+        }
+
+        MixAudioBuses(blockOut, blockFrames);
+    }
+
+    rAudioProcessor *processor = AUDIO.mixedProcessor;
+    while (processor)
+    {
+        processor->process(pFramesOut, frameCount);
+        processor = processor->next;
+    }
+}
+
+// Mix audio buffer frames, reading, resampling and processing them
+// NOTE: framesOut is both an input and an output, frames are accumulated
+static void MixAudioBuffer(AudioBuffer *audioBuffer, float *framesOut, ma_uint32 frameCount)
+{
+    ma_uint32 framesRead = 0;
+
+    while (1)
+    {
+        if (framesRead >= frameCount) break;
+
+        // Just read as much data as we can from the stream
+        ma_uint32 framesToRead = (frameCount - framesRead);
+
+        while (framesToRead > 0)
+        {
+            float tempBuffer[1024] = { 0 }; // Frames for stereo
+
+            ma_uint32 framesToReadRightNow = framesToRead;
+            if (framesToReadRightNow > sizeof(tempBuffer)/sizeof(tempBuffer[0])/AUDIO_DEVICE_CHANNELS)
+            {
+                framesToReadRightNow = sizeof(tempBuffer)/sizeof(tempBuffer[0])/AUDIO_DEVICE_CHANNELS;
+            }
+
+            ma_uint32 framesJustRead = ReadAudioBufferFramesResampled(audioBuffer, tempBuffer, framesToReadRightNow);
+            if (framesJustRead > 0)
+            {
+                float *framesIn = tempBuffer;
+
+                // Apply processors chain if defined
+                rAudioProcessor *processor = audioBuffer->processor;
+                while (processor)
+                {
+                    processor->process(framesIn, framesJustRead);
+                    processor = processor->next;
+                }
+
+                MixAudioFrames(framesOut + (framesRead*AUDIO.System.device.playback.channels), framesIn, framesJustRead, audioBuffer);
+
+                framesToRead -= framesJustRead;
+                framesRead += framesJustRead;
+            }
+
+            if (!audioBuffer->playing)
+            {
+                framesRead = frameCount;
+                break;
+            }
+
+            // If we weren't able to read all the frames we requested, break
+            if (framesJustRead < framesToReadRightNow)
+            {
+                if (!audioBuffer->looping)
+                {
+                    StopAudioBufferInMixer(audioBuffer);
+                    break;
+                }
+                else
+                {
+                    // Should never get here, but just for safety,
+                    // move the cursor position back to the start and continue the loop
+                    ma_atomic_exchange_32(&audioBuffer->frameCursorPos, 0);
+                    continue;
+                }
+            }
+        }
+
+        // If for some reason we weren't able to read every frame we'll need to break from the loop
+        // Not doing this could theoretically put us into an infinite loop
+        if (framesToRead > 0) break;
+    }
+}
+
+// Compute audio buffer mixing levels for left/right output channels
+// NOTE: Panning is only considered for stereo output, otherwise both levels are the buffer volume
+static void GetAudioBufferMixLevels(AudioBuffer *buffer, ma_uint32 channels, float *levels)
+{
+    if (buffer->spatial)
+    {
+        // Spatial panning replaces buffer pan
+        levels[0] = buffer->volume*((channels == 2)? buffer->spatialLevels[0] : buffer->spatialGain);
+        levels[1] = buffer->volume*((channels == 2)? buffer->spatialLevels[1] : buffer->spatialGain);
+    }
+    else if (channels == 2)
+    {
+        const float left = buffer->pan;
+        const float right = 1.0f - left;
+
+        // Fast sine approximation in [0..1] for pan law: y = 0.5f*x*(3 - x*x);
+        levels[0] = buffer->volume*0.5f*left*(3.0f - left*left);
+        levels[1] = buffer->volume*0.5f*right*(3.0f - right*right);
+    }
+    else
+    {
+        levels[0] = buffer->volume;
+        levels[1] = buffer->volume;
+    }
+}
+
+// Mix interleaved samples with constant levels, even samples use levels[0] and odd samples levels[1]
+// NOTE: Output accumulates input multiplied by levels to provided output (usually 0)
+static void MixAudioSamples(float *samplesOut, const float *samplesIn, ma_uint32 sampleCount, const float *levels)
+{
+    ma_uint32 i = 0;
+
+#if defined(RAUDIO_MIX_SSE)
+    const __m128 gain = _mm_setr_ps(levels[0], levels[1], levels[0], levels[1]);
+
+    for (; (i + 8) <= sampleCount; i += 8)
+    {
+        __m128 out0 = _mm_add_ps(_mm_loadu_ps(samplesOut + i), _mm_mul_ps(_mm_loadu_ps(samplesIn + i), gain));
+        __m128 out1 = _mm_add_ps(_mm_loadu_ps(samplesOut + i + 4), _mm_mul_ps(_mm_loadu_ps(samplesIn + i + 4), gain));
+        _mm_storeu_ps(samplesOut + i, out0);
+        _mm_storeu_ps(samplesOut + i + 4, out1);
+    }
+#elif defined(RAUDIO_MIX_NEON)
+    const float gains[4] = { levels[0], levels[1], levels[0], levels[1] };
+    const float32x4_t gain = vld1q_f32(gains);
+
+    for (; (i + 8) <= sampleCount; i += 8)
+    {
+        vst1q_f32(samplesOut + i, vmlaq_f32(vld1q_f32(samplesOut + i), vld1q_f32(samplesIn + i), gain));
+        vst1q_f32(samplesOut + i + 4, vmlaq_f32(vld1q_f32(samplesOut + i + 4), vld1q_f32(samplesIn + i + 4), gain));
+    }
+#endif
+
+    for (; i < sampleCount; i++) samplesOut[i] += (samplesIn[i]*levels[i & 1]);
+}
+
+// Mix interleaved stereo frames ramping levels linearly, levels are updated to the last frame levels
+static void MixAudioFramesStereoRamp(float *framesOut, const float *framesIn, ma_uint32 frameCount, float *levels, const float *steps)
+{
+    ma_uint32 frame = 0;
+
+#if defined(RAUDIO_MIX_SSE)
+    __m128 gain = _mm_setr_ps(levels[0], levels[1], levels[0] + steps[0], levels[1] + steps[1]);
+    const __m128 step = _mm_setr_ps(2.0f*steps[0], 2.0f*steps[1], 2.0f*steps[0], 2.0f*steps[1]);
+
+    for (; (frame + 2) <= frameCount; frame += 2)
+    {
+        _mm_storeu_ps(framesOut + frame*2, _mm_add_ps(_mm_loadu_ps(framesOut + frame*2), _mm_mul_ps(_mm_loadu_ps(framesIn + frame*2), gain)));
+        gain = _mm_add_ps(gain, step);
+    }
+
+    float gains[4] = { 0 };
+    _mm_storeu_ps(gains, gain);
+    levels[0] = gains[0];
+    levels[1] = gains[1];
+#elif defined(RAUDIO_MIX_NEON)
+    const float initGains[4] = { levels[0], levels[1], levels[0] + steps[0], levels[1] + steps[1] };
+    const float initSteps[4] = { 2.0f*steps[0], 2.0f*steps[1], 2.0f*steps[0], 2.0f*steps[1] };
+    float32x4_t gain = vld1q_f32(initGains);
+    const float32x4_t step = vld1q_f32(initSteps);
+
+    for (; (frame + 2) <= frameCount; frame += 2)
+    {
+        vst1q_f32(framesOut + frame*2, vmlaq_f32(vld1q_f32(framesOut + frame*2), vld1q_f32(framesIn + frame*2), gain));
+        gain = vaddq_f32(gain, step);
+    }
+
+    levels[0] = vgetq_lane_f32(gain, 0);
+    levels[1] = vgetq_lane_f32(gain, 1);
+#endif
+
+    for (; frame < frameCount; frame++)
+    {
+        framesOut[frame*2] += (framesIn[frame*2]*levels[0]);
+        framesOut[frame*2 + 1] += (framesIn[frame*2 + 1]*levels[1]);
+
+        levels[0] += steps[0];
+        levels[1] += steps[1];
+    }
+}
+
+// Main mixing function, pretty simple in this project, just an accumulation
+// NOTE: framesOut is both an input and an output, it is initially filled with zeros outside of this function
+// Volume/pan changes are ramped linearly over AUDIO_VOLUME_RAMP_FRAMES to avoid zipper noise
+static void MixAudioFrames(float *framesOut, const float *framesIn, ma_uint32 frameCount, AudioBuffer *buffer)
+{
+    const ma_uint32 channels = AUDIO.System.device.playback.channels;
+
+    // Demoted voices keep their ramp to silence, see DemoteAudioVoice()
+    float levels[2] = { 0 };
+    if (!buffer->isVirtual) GetAudioBufferMixLevels(buffer, channels, levels);
+
+    // Levels changed, start a new linear ramp from current levels
+    if ((levels[0] != buffer->mixLevelsTarget[0]) || (levels[1] != buffer->mixLevelsTarget[1]))
+    {
+        for (int i = 0; i < 2; i++)
+        {
+            buffer->mixLevelsTarget[i] = levels[i];
+            buffer->mixLevelsStep[i] = (levels[i] - buffer->mixLevels[i])/AUDIO_VOLUME_RAMP_FRAMES;
+        }
+
+        buffer->mixRampFrames = AUDIO_VOLUME_RAMP_FRAMES;
+    }
+
+    ma_uint32 rampFrames = (buffer->mixRampFrames < frameCount)? buffer->mixRampFrames : frameCount;
+
+    if (rampFrames > 0)
+    {
+        if (channels == 2) MixAudioFramesStereoRamp(framesOut, framesIn, rampFrames, buffer->mixLevels, buffer->mixLevelsStep);
+        else
+        {
+            float level = buffer->mixLevels[0];
+
+            for (ma_uint32 frame = 0; frame < rampFrames; frame++)
+            {
+                float *frameOut = framesOut + (frame*channels);
+                const float *frameIn = framesIn + (frame*channels);
+
+                for (ma_uint32 c = 0; c < channels; c++) frameOut[c] += (frameIn[c]*level);
+
+                level += buffer->mixLevelsStep[0];
+            }
+
+            buffer->mixLevels[0] = level;
+            buffer->mixLevels[1] = level;
+        }
+
+        buffer->mixRampFrames -= rampFrames;
+
+        // Avoid accumulated float error once ramp is finished
+        if (buffer->mixRampFrames == 0)
+        {
+            buffer->mixLevels[0] = buffer->mixLevelsTarget[0];
+            buffer->mixLevels[1] = buffer->mixLevelsTarget[1];
+        }
+
+        framesOut += rampFrames*channels;
+        framesIn += rampFrames*channels;
+        frameCount -= rampFrames;
+    }
+
+    if (frameCount > 0) MixAudioSamples(framesOut, framesIn, frameCount*channels, buffer->mixLevels);
+}
+
+// Compare audio voices importance: priority first, then audibility
+static bool IsAudioVoiceMoreImportant(AudioBuffer *buffer, AudioBuffer *other)
+{
+    if (buffer->priority != other->priority) return (buffer->priority > other->priority);
+
+    return (buffer->audibility > other->audibility);
+}
+
+// Select real voices to be mixed, remaining playing sounds become virtual
+// NOTE: Only sounds (static buffers) are managed, audio streams are always mixed
+static void UpdateAudioVoices(void)
+{
+    AudioBuffer **voices = AUDIO.Voice.real;
+    int voiceCount = 0;
+    int weakest = -1;
+
+    for (AudioBuffer *buffer = AUDIO.Buffer.first; buffer != NULL; buffer = buffer->next)
+    {
+        buffer->isVirtual = false;
+
+        if (!buffer->playing || buffer->paused) continue;
+
+        // Spatial parameters are updated once per mixer callback, before voices audibility is computed
+        UpdateAudioBufferEmitter(buffer);
+        if (buffer->spatial) UpdateAudioBufferSpatial(buffer);
+
+        // Voices are not culled if they are not limited
+        if ((buffer->usage != AUDIO_BUFFER_USAGE_STATIC) || (AUDIO.Voice.maxReal == 0)) continue;
+
+        float levels[2] = { 0 };
+        GetAudioBufferMixLevels(buffer, AUDIO.System.device.playback.channels, levels);
+        buffer->audibility = (levels[0] > levels[1])? levels[0] : levels[1];
+
+        // Inaudible sounds are culled, they keep playing virtually
+        if (buffer->audibility < AUDIO_VOICE_CULL_LEVEL) buffer->isVirtual = true;
+        else if (voiceCount < AUDIO.Voice.maxReal) voices[voiceCount++] = buffer;
+        else
+        {
+            // Voices are full, find the least important one to be replaced
+            if (weakest < 0)
+            {
+                weakest = 0;
+                for (int i = 1; i < voiceCount; i++) if (IsAudioVoiceMoreImportant(voices[weakest], voices[i])) weakest = i;
+            }
+
+            if (IsAudioVoiceMoreImportant(buffer, voices[weakest]))
+            {
+                voices[weakest]->isVirtual = true;
+                voices[weakest] = buffer;
+                weakest = -1;
+            }
+            else buffer->isVirtual = true;
+        }
+    }
+}
+
+// Advance a virtual voice cursor the frames it would have been mixed, without reading its data
+static void UpdateAudioVoiceVirtual(AudioBuffer *buffer, ma_uint32 frameCount)
+{
+    // Fractional frames are kept, so cursor does not drift from a mixed voice at non-integer pitch
+    double framesIn = frameCount*GetAudioBufferResampleStep(buffer) + buffer->virtualFraction;
+    ma_uint64 cursor = buffer->frameCursorPos + (ma_uint64)framesIn;
+    buffer->virtualFraction = framesIn - (ma_uint64)framesIn;
+
+    if (cursor >= buffer->sizeInFrames)
+    {
+        if (!buffer->looping)
+        {
+            StopAudioBufferInMixer(buffer);
+            return;
+        }
+
+        cursor %= buffer->sizeInFrames;
+    }
+
+    ma_atomic_exchange_32(&buffer->frameCursorPos, (ma_uint32)cursor);
+    buffer->wasVirtual = true;
+}
+
+// Demote a real voice to virtual, fading it out to silence along the frames mixed
+static void DemoteAudioVoice(AudioBuffer *buffer, ma_uint32 frameCount)
+{
+    for (int i = 0; i < 2; i++)
+    {
+        buffer->mixLevelsTarget[i] = 0.0f;
+        buffer->mixLevelsStep[i] = -buffer->mixLevels[i]/frameCount;
+    }
+
+    buffer->mixRampFrames = frameCount;
+    buffer->virtualFraction = 0.0;
+    buffer->wasVirtual = true;
+}
+
+// Promote a virtual voice back to real, fading it in from silence
+static void PromoteAudioVoice(AudioBuffer *buffer)
+{
+    // Resampler frames are stale after skipping frames
+    ResetAudioResampler(buffer);
+
+    GetAudioBufferMixLevels(buffer, AUDIO.System.device.playback.channels, buffer->mixLevelsTarget);
+
+    for (int i = 0; i < 2; i++)
+    {
+        buffer->mixLevels[i] = 0.0f;
+        buffer->mixLevelsStep[i] = buffer->mixLevelsTarget[i]/AUDIO_VOLUME_RAMP_FRAMES;
+    }
+
+    buffer->mixRampFrames = AUDIO_VOLUME_RAMP_FRAMES;
+    buffer->wasVirtual = false;
+}
+
+#if defined(SUPPORT_FILEFORMAT_QOA)
+// Load sound QOA decoder, required to mix a QOA compressed sound
+static SoundQoaDecoder *LoadSoundQoaDecoder(const qoa_desc *desc, unsigned int dataSize)
+{
+    SoundQoaDecoder *decoder = (SoundQoaDecoder *)RL_CALLOC(1, sizeof(SoundQoaDecoder));
+
+    decoder->desc = *desc;
+    decoder->frameSize = qoa_max_frame_size(&decoder->desc);
+    decoder->dataSize = dataSize;
+    decoder->frameIndex = -1;
+    decoder->samples = (short *)RL_CALLOC(QOA_FRAME_LEN*desc->channels, sizeof(short));
+
+    return decoder;
+}
+
+// Read sound frames from QOA compressed data, decoding one QOA frame at a time, called from the mixer
+static void ReadSoundQoaFrames(AudioBuffer *audioBuffer, short *framesOut, unsigned int position, unsigned int frameCount)
+{
+    SoundQoaDecoder *decoder = audioBuffer->qoa;
+    unsigned int channels = decoder->desc.channels;
+
+    while (frameCount > 0)
+    {
+        int frameIndex = position/QOA_FRAME_LEN;
+
+        if (frameIndex != decoder->frameIndex)
+        {
+            // Every QOA frame has the same size (but the last one) and it contains its LMS state,
+            // so it can be decoded independently, just after the 8 bytes file header
+            unsigned int offset = 8 + frameIndex*decoder->frameSize;
+            unsigned int frameLen = 0;
+
+            qoa_decode_frame(audioBuffer->data + offset, decoder->dataSize - offset, &decoder->desc, decoder->samples, &frameLen);
+            decoder->frameIndex = frameIndex;
+        }
+
+        unsigned int frameOffset = position%QOA_FRAME_LEN;
+        unsigned int framesToCopy = QOA_FRAME_LEN - frameOffset;
+        if (framesToCopy > frameCount) framesToCopy = frameCount;
+
+        memcpy(framesOut, decoder->samples + frameOffset*channels, framesToCopy*channels*sizeof(short));
+
+        framesOut += framesToCopy*channels;
+        position += framesToCopy;
+        frameCount -= framesToCopy;
+    }
+}
+#endif
+
+// Check if the mixer is running on the audio device thread
+// NOTE: Emscripten mixer runs on the main thread, commands are always executed directly
+static bool IsAudioMixerRunning(void)
+{
+#if defined(__EMSCRIPTEN__)
+    return false;
+#else
+    return (ma_device_get_state(&AUDIO.System.device) == ma_device_state_started);
+#endif
+}
+
+// Wait for the mixer to execute some commands, executing them directly if mixer is not running
+static void WaitAudioMixer(void)
+{
+    if (!IsAudioMixerRunning()) ExecuteAudioCommands();
+#if !defined(__EMSCRIPTEN__)
+    else ma_sleep(1);
+#endif
+}
+
+// Push a command to the mixer commands queue, assuming the audio system mutex has been locked
+// NOTE: It only waits for the mixer if the queue is full
+static void PushAudioCommand(AudioCommand command)
+{
+    while ((ma_atomic_load_32(&AUDIO.Queue.head) - ma_atomic_load_32(&AUDIO.Queue.tail)) >= AUDIO_COMMAND_QUEUE_SIZE) WaitAudioMixer();
+
+    if ((command.buffer != NULL) && (command.type <= AUDIO_COMMAND_RESUME)) ma_atomic_fetch_add_32(&command.buffer->stateCommandsPending, 1);
+
+    ma_uint32 head = AUDIO.Queue.head;
+    AUDIO.Queue.commands[head & (AUDIO_COMMAND_QUEUE_SIZE - 1)] = command;
+    ma_atomic_exchange_32(&AUDIO.Queue.head, head + 1);     // Command is published to the mixer
+
+    if (!IsAudioMixerRunning()) ExecuteAudioCommands();
+}
+
+// Wait for the mixer to execute all queued commands, assuming the audio system mutex has been locked
+static void FlushAudioCommands(void)
+{
+    while (ma_atomic_load_32(&AUDIO.Queue.tail) != ma_atomic_load_32(&AUDIO.Queue.head)) WaitAudioMixer();
+}
+
+// Execute queued commands, called from the mixer at the start of every device callback
+// NOTE: Mixer is the only consumer of the queue, it is the only one modifying mixer state
+static void ExecuteAudioCommands(void)
+{
+    ma_uint32 tail = AUDIO.Queue.tail;
+    ma_uint32 head = ma_atomic_load_32(&AUDIO.Queue.head);
+
+    while (tail != head)
+    {
+        AudioCommand *command = &AUDIO.Queue.commands[tail & (AUDIO_COMMAND_QUEUE_SIZE - 1)];
+        AudioBuffer *buffer = command->buffer;
+
+        switch (command->type)
+        {
+            case AUDIO_COMMAND_PLAY:
+            {
+                buffer->playing = true;
+                buffer->paused = false;
+                ma_atomic_exchange_32(&buffer->frameCursorPos, 0);
+                ResetAudioResampler(buffer);
+
+                // Emitter written before playing is applied, so playing starts at its position
+                UpdateAudioBufferEmitter(buffer);
+                if (buffer->spatial) UpdateAudioBufferSpatial(buffer);
+
+                // Playing starts with current levels, no ramp required
+                GetAudioBufferMixLevels(buffer, AUDIO.System.device.playback.channels, buffer->mixLevelsTarget);
+                buffer->mixLevels[0] = buffer->mixLevelsTarget[0];
+                buffer->mixLevels[1] = buffer->mixLevelsTarget[1];
+                buffer->mixRampFrames = 0;
+                buffer->wasVirtual = false;
+                buffer->wasMixed = false;
+                buffer->virtualFraction = 0.0;
+            } break;
+            case AUDIO_COMMAND_STOP: StopAudioBufferInMixer(buffer); break;
+            case AUDIO_COMMAND_PAUSE: buffer->paused = true; break;
+            case AUDIO_COMMAND_RESUME: buffer->paused = false; break;
+            case AUDIO_COMMAND_VOLUME: buffer->volume = command->value; break;
+            case AUDIO_COMMAND_PITCH: buffer->pitch = command->value; break;     // Resampling step is updated on next mix
+            case AUDIO_COMMAND_PAN: buffer->pan = command->value; break;
+            case AUDIO_COMMAND_PRIORITY: buffer->priority = command->param; break;
+            case AUDIO_COMMAND_ALIAS:
+            {
+                buffer->volume = command->source->volume;
+                buffer->priority = command->source->priority;
+                buffer->attenuation = command->source->attenuation;
+                buffer->minDistance = command->source->minDistance;
+                buffer->maxDistance = command->source->maxDistance;
+                buffer->rolloff = command->source->rolloff;
+                buffer->bus = command->source->bus;
+            } break;
+            case AUDIO_COMMAND_MAX_VOICES:
+            {
+                AUDIO.Voice.maxReal = command->param;
+                AUDIO.Voice.real = command->voices;
+            } break;
+            case AUDIO_COMMAND_RESAMPLE_QUALITY: AUDIO.Resampler.quality = command->param; break;
+            case AUDIO_COMMAND_ATTENUATION:
+            {
+                buffer->attenuation = command->param;
+                buffer->minDistance = command->vectors[0][0];
+                buffer->maxDistance = command->vectors[0][1];
+                buffer->rolloff = command->vectors[0][2];
+            } break;
+            case AUDIO_COMMAND_LISTENER:
+            {
+                const float *forward = command->vectors[1];
+                const float *up = command->vectors[2];
+
+                // Listener right axis: forward x up
+                float right[3] = { forward[1]*up[2] - forward[2]*up[1], forward[2]*up[0] - forward[0]*up[2], forward[0]*up[1] - forward[1]*up[0] };
+                float length = sqrtf(right[0]*right[0] + right[1]*right[1] + right[2]*right[2]);
+
+                if (length > 0.0f) for (int i = 0; i < 3; i++) AUDIO.Listener.right[i] = right[i]/length;
+
+                memcpy(AUDIO.Listener.position, command->vectors[0], 3*sizeof(float));
+                memcpy(AUDIO.Listener.velocity, command->vectors[3], 3*sizeof(float));
+            } break;
+            case AUDIO_COMMAND_DOPPLER: AUDIO.Listener.dopplerFactor = command->value; break;
+            case AUDIO_COMMAND_BUS: buffer->bus = command->param; break;
+            case AUDIO_COMMAND_BUS_VOLUME:
+            {
+                rAudioBus *bus = &AUDIO.Bus.buses[command->param];
+                bus->volume = command->value;
+                bus->gainStep = (bus->volume - bus->gain)/AUDIO_VOLUME_RAMP_FRAMES;
+                bus->rampFrames = AUDIO_VOLUME_RAMP_FRAMES;
+            } break;
+            case AUDIO_COMMAND_BUS_FILTER:
+            {
+                rAudioBus *bus = &AUDIO.Bus.buses[command->param];
+                int filter = (int)command->vectors[0][0];
+                SetAudioBiquad((filter == AUDIO_FILTER_HIGHPASS)? &bus->highPass : &bus->lowPass, filter, command->value, command->vectors[0][1]);
+            } break;
+            case AUDIO_COMMAND_BUS_REVERB:
+            {
+                AudioReverb *reverb = command->reverb;
+
+                // Freeverb parameters scaling
+                reverb->feedback = command->vectors[0][0]*0.28f + 0.7f;
+                reverb->damping = command->vectors[0][1]*0.4f;
+                reverb->wet = command->value*3.0f;
+                reverb->dry = 1.0f - command->value;
+                reverb->enabled = (command->value > 0.0f);
+                AUDIO.Bus.buses[command->param].reverb = reverb;
+            } break;
+            case AUDIO_COMMAND_BUS_LIMITER:
+            {
+                AudioLimiter *limiter = &AUDIO.Bus.buses[command->param].limiter;
+                float release = command->vectors[0][0];
+
+                limiter->enabled = (command->value > 0.0f);
+                limiter->threshold = command->value;
+                limiter->release = (release > 0.0f)? expf(-1.0f/(release*AUDIO.System.device.sampleRate)) : 0.0f;
+            } break;
+            case AUDIO_COMMAND_TRACK:
+            {
+                if (AUDIO.Buffer.first == NULL) AUDIO.Buffer.first = buffer;
+                else
+                {
+                    AUDIO.Buffer.last->next = buffer;
+                    buffer->prev = AUDIO.Buffer.last;
+                }
+
+                AUDIO.Buffer.last = buffer;
+            } break;
+            case AUDIO_COMMAND_UNTRACK:
+            {
+                if (buffer->prev == NULL) AUDIO.Buffer.first = buffer->next;
+                else buffer->prev->next = buffer->next;
+
+                if (buffer->next == NULL) AUDIO.Buffer.last = buffer->prev;
+                else buffer->next->prev = buffer->prev;
+
+                buffer->prev = NULL;
+                buffer->next = NULL;
+            } break;
+            case AUDIO_COMMAND_CALLBACK: buffer->callback = command->callback; break;
+            case AUDIO_COMMAND_ATTACH_PROCESSOR:
+            {
+                // New processor is added at the end of the list, processors order is important
+                rAudioProcessor **first = (buffer != NULL)? &buffer->processor : &AUDIO.mixedProcessor;
+                rAudioProcessor *last = *first;
+
+                while (last && last->next) last = last->next;
+
+                if (last)
+                {
+                    command->processor->prev = last;
+                    last->next = command->processor;
+                }
+                else *first = command->processor;
+            } break;
+            case AUDIO_COMMAND_DETACH_PROCESSOR:
+            {
+                rAudioProcessor **first = (buffer != NULL)? &buffer->processor : &AUDIO.mixedProcessor;
+                rAudioProcessor *prev = command->processor->prev;
+                rAudioProcessor *next = command->processor->next;
+
+                if (*first == command->processor) *first = next;
+                if (prev) prev->next = next;
+                if (next) next->prev = prev;
+            } break;
+            case AUDIO_COMMAND_DECODER:
+            {
+                buffer->decoder = command->decoder;
+                ma_atomic_exchange_32(&buffer->framesProcessed, command->position);
+
+                // Back to polling, UpdateMusicStream() refills both sub-buffers from current position
+                if (buffer->decoder == NULL)
+                {
+                    ma_atomic_exchange_32(&buffer->frameCursorPos, 0);
+                    ma_atomic_exchange_32(&buffer->isSubBufferProcessed[0], 1);
+                    ma_atomic_exchange_32(&buffer->isSubBufferProcessed[1], 1);
+                }
+            } break;
+            default: break;
+        }
+
+        if ((buffer != NULL) && (command->type <= AUDIO_COMMAND_RESUME)) ma_atomic_fetch_sub_32(&buffer->stateCommandsPending, 1);
+
+        tail++;
+        ma_atomic_exchange_32(&AUDIO.Queue.tail, tail);     // Command slot is released to the program
+    }
+}
+
+// Free unloaded audio buffers once the mixer has untracked them, assuming the audio system mutex has been locked
+static void FreeRetiredAudioBuffers(bool force)
+{
+    ma_uint32 tail = ma_atomic_load_32(&AUDIO.Queue.tail);
+    AudioBuffer **link = &AUDIO.Queue.retired;
+
+    while (*link != NULL)
+    {
+        AudioBuffer *buffer = *link;
+
+        if (force || ((ma_int32)(tail - buffer->untrackCommand) >= 0))
+        {
+            *link = buffer->retiredNext;
+
+            ma_data_converter_uninit(&buffer->converter, NULL);
+            if (buffer->ownsData) RL_FREE(buffer->data);
+#if defined(SUPPORT_FILEFORMAT_QOA)
+            if (buffer->qoa != NULL)
+            {
+                RL_FREE(buffer->qoa->samples);
+                RL_FREE(buffer->qoa);
+            }
+#endif
+            RL_FREE(buffer);
+        }
+        else link = &buffer->retiredNext;
+    }
+}
+
+// Stop an audio buffer, called from the mixer
+static void StopAudioBufferInMixer(AudioBuffer *buffer)
+{
+    if (buffer != NULL)
+    {
+        if (buffer->playing && !buffer->paused)
+        {
+            buffer->playing = false;
+            buffer->paused = false;
+            ma_atomic_exchange_32(&buffer->frameCursorPos, 0);
+            ma_atomic_exchange_32(&buffer->framesProcessed, 0);
+            ma_atomic_exchange_32(&buffer->isSubBufferProcessed[0], 1);
+            ma_atomic_exchange_32(&buffer->isSubBufferProcessed[1], 1);
+        }
+    }
+}
+
+// Read music stream frames from the music context, rewinding it if end is reached
+// NOTE: Called from UpdateMusicStream() or from the music decoder thread, never from the mixer
+static void ReadMusicStreamFrames(Music music, void *framesOut, unsigned int framesToStream)
+{
+    int frameSize = music.stream.channels*music.stream.sampleSize/8;
+    int frameCountStillNeeded = framesToStream;
+    int frameCountReadTotal = 0;
+
+    switch (music.ctxType)
+    {
+    #if defined(SUPPORT_FILEFORMAT_WAV)
+        case MUSIC_AUDIO_WAV:
+        {
+            if (music.stream.sampleSize == 16)
+            {
+                while (true)
+                {
+                    int frameCountRead = (int)drwav_read_pcm_frames_s16((drwav *)music.ctxData, frameCountStillNeeded, (short *)((char *)framesOut + frameCountReadTotal*frameSize));
+                    frameCountReadTotal += frameCountRead;
+                    frameCountStillNeeded -= frameCountRead;
+                    if (frameCountStillNeeded == 0) break;
+                    else drwav_seek_to_first_pcm_frame((drwav *)music.ctxData);
+                }
+            }
+            else if (music.stream.sampleSize == 32)
+            {
+                while (true)
+                {
+                    int frameCountRead = (int)drwav_read_pcm_frames_f32((drwav *)music.ctxData, frameCountStillNeeded, (float *)((char *)framesOut + frameCountReadTotal*frameSize));
+                    frameCountReadTotal += frameCountRead;
+                    frameCountStillNeeded -= frameCountRead;
+                    if (frameCountStillNeeded == 0) break;
+                    else drwav_seek_to_first_pcm_frame((drwav *)music.ctxData);
+                }
+            }
+        } break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_OGG)
+        case MUSIC_AUDIO_OGG:
+        {
+            while (true)
+            {
+                int frameCountRead = stb_vorbis_get_samples_short_interleaved((stb_vorbis *)music.ctxData, music.stream.channels, (short *)((char *)framesOut + frameCountReadTotal*frameSize), frameCountStillNeeded*music.stream.channels);
+                frameCountReadTotal += frameCountRead;
+                frameCountStillNeeded -= frameCountRead;
+                if (frameCountStillNeeded == 0) break;
+                else stb_vorbis_seek_start((stb_vorbis *)music.ctxData);
+            }
+        } break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_MP3)
+        case MUSIC_AUDIO_MP3:
+        {
+            while (true)
+            {
+                int frameCountRead = (int)drmp3_read_pcm_frames_f32((drmp3 *)music.ctxData, frameCountStillNeeded, (float *)((char *)framesOut + frameCountReadTotal*frameSize));
+                frameCountReadTotal += frameCountRead;
+                frameCountStillNeeded -= frameCountRead;
+                if (frameCountStillNeeded == 0) break;
+                else drmp3_seek_to_start_of_stream((drmp3 *)music.ctxData);
+            }
+        } break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_QOA)
+        case MUSIC_AUDIO_QOA:
+        {
+            unsigned int frameCountRead = qoaplay_decode((qoaplay_desc *)music.ctxData, (float *)framesOut, framesToStream);
+            frameCountReadTotal += frameCountRead;
+            /*
+            while (true)
+            {
+                int frameCountRead = (int)qoaplay_decode((qoaplay_desc *)music.ctxData, (float *)((char *)framesOut + frameCountReadTotal*frameSize),  frameCountStillNeeded);
+                frameCountReadTotal += frameCountRead;
+                frameCountStillNeeded -= frameCountRead;
+                if (frameCountStillNeeded == 0) break;
+                else qoaplay_rewind((qoaplay_desc *)music.ctxData);
+            }
+            */
+        } break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_FLAC)
+        case MUSIC_AUDIO_FLAC:
+        {
+            while (true)
+            {
+                int frameCountRead = (int)drflac_read_pcm_frames_s16((drflac *)music.ctxData, frameCountStillNeeded, (short *)((char *)framesOut + frameCountReadTotal*frameSize));
+                frameCountReadTotal += frameCountRead;
+                frameCountStillNeeded -= frameCountRead;
+                if (frameCountStillNeeded == 0) break;
+                else drflac__seek_to_first_frame((drflac *)music.ctxData);
+            }
+        } break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_XM)
+        case MUSIC_MODULE_XM:
+        {
+            // NOTE: Internally we consider 2 channels generation, so sampleCount/2
+            if (AUDIO_DEVICE_FORMAT == ma_format_f32) jar_xm_generate_samples((jar_xm_context_t *)music.ctxData, (float *)framesOut, framesToStream);
+            else if (AUDIO_DEVICE_FORMAT == ma_format_s16) jar_xm_generate_samples_16bit((jar_xm_context_t *)music.ctxData, (short *)framesOut, framesToStream);
+            else if (AUDIO_DEVICE_FORMAT == ma_format_u8) jar_xm_generate_samples_8bit((jar_xm_context_t *)music.ctxData, (char *)framesOut, framesToStream);
+            //jar_xm_reset((jar_xm_context_t *)music.ctxData);
+
+        } break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_MOD)
+        case MUSIC_MODULE_MOD:
+        {
+            // NOTE: 3rd parameter (nbsample) specify the number of stereo 16bits samples you want, so sampleCount/2
+            jar_mod_fillbuffer((jar_mod_context_t *)music.ctxData, (short *)framesOut, framesToStream, 0);
+            //jar_mod_seek_start((jar_mod_context_t *)music.ctxData);
+
+        } break;
+    #endif
+        default: break;
+    }
+}
+
+// Read music stream frames from decoder ring buffer, called from the mixer
+// NOTE: It never blocks, on ring buffer underrun remaining frames are filled with silence
+static ma_uint32 ReadMusicStreamDecoderFrames(AudioBuffer *audioBuffer, void *framesOut, ma_uint32 frameCount)
+{
+    MusicStreamDecoder *decoder = audioBuffer->decoder;
+    ma_uint32 frameSizeInBytes = ma_get_bytes_per_frame(audioBuffer->converter.formatIn, audioBuffer->converter.channelsIn);
+    ma_uint32 framesRead = 0;
+
+    // Decoder thread has seeked music context, drop frames decoded before and let it continue decoding
+    ma_uint32 resetGeneration = ma_atomic_load_32(&decoder->resetGeneration);
+
+    if (resetGeneration != decoder->resetAck)
+    {
+        ma_pcm_rb_seek_read(&decoder->ring, ma_pcm_rb_available_read(&decoder->ring));
+        ma_atomic_exchange_32(&audioBuffer->framesProcessed, ma_atomic_load_32(&decoder->resetPosition));
+        ma_atomic_exchange_32(&decoder->state, MUSIC_DECODER_DECODING);
+        ma_atomic_exchange_32(&decoder->resetAck, resetGeneration);
+    }
+
+    // Seek request pending, frames on ring buffer are not valid anymore
+    if (ma_atomic_load_32(&decoder->seekGeneration) != decoder->resetAck)
+    {
+        memset(framesOut, 0, frameCount*frameSizeInBytes);
+        return frameCount;
+    }
+
+    // Ring buffer read region is contiguous, it could require two passes to wrap around
+    while (framesRead < frameCount)
+    {
+        ma_uint32 framesToRead = frameCount - framesRead;
+        void *frames = NULL;
+
+        ma_pcm_rb_acquire_read(&decoder->ring, &framesToRead, &frames);
+        if (framesToRead == 0) break;
+
+        memcpy((unsigned char *)framesOut + (framesRead*frameSizeInBytes), frames, framesToRead*frameSizeInBytes);
+        ma_pcm_rb_commit_read(&decoder->ring, framesToRead);
+        framesRead += framesToRead;
+    }
+
+    ma_atomic_exchange_32(&audioBuffer->framesProcessed, (audioBuffer->framesProcessed + framesRead)%decoder->music.frameCount);
+
+    if (framesRead < frameCount)
+    {
+        // Once decoder finished, all its frames are visible on the ring buffer: if it is empty, music has ended
+        if ((ma_atomic_load_32(&decoder->state) == MUSIC_DECODER_FINISHED) && (ma_pcm_rb_available_read(&decoder->ring) == 0))
+        {
+            StopAudioBufferInMixer(audioBuffer);
+            ma_atomic_exchange_32(&decoder->state, MUSIC_DECODER_DRAINED);
+        }
+
+        memset((unsigned char *)framesOut + (framesRead*frameSizeInBytes), 0, (frameCount - framesRead)*frameSizeInBytes);
+    }
+
+    return frameCount;
+}
+
+// Decode music stream frames into decoder ring buffer, called from the decoder thread
+static void UpdateMusicStreamDecoder(MusicStreamDecoder *decoder)
+{
+    Music music = decoder->music;
+
+    // Seek requested by the program, ring buffer is not written until the mixer drops frames decoded before it
+    ma_uint32 seekGeneration = ma_atomic_load_32(&decoder->seekGeneration);
+
+    if (seekGeneration != decoder->resetGeneration)
+    {
+        decoder->framesDecoded = SeekMusicStreamContext(music, ma_atomic_load_32(&decoder->seekPosition));
+        ma_atomic_exchange_32(&decoder->resetPosition, decoder->framesDecoded);
+        ma_atomic_exchange_32(&decoder->resetGeneration, seekGeneration);
+    }
+
+    if (ma_atomic_load_32(&decoder->resetAck) != decoder->resetGeneration) return;
+
+    ma_uint32 state = ma_atomic_load_32(&decoder->state);
+
+    if (state == MUSIC_DECODER_DRAINED)
+    {
+        // Music stream was stopped by the mixer after its last frame, rewind it for next play
+        SeekMusicStreamContext(music, 0);
+
+        decoder->framesDecoded = 0;
+        ma_atomic_exchange_32(&decoder->state, MUSIC_DECODER_DECODING);
+    }
+    else if (state == MUSIC_DECODER_FINISHED) return;
+
+    bool looping = (ma_atomic_load_32(&decoder->looping) != 0);
+    ma_uint32 framesToDecode = ma_pcm_rb_available_write(&decoder->ring);
+
+    // Ring buffer write region is contiguous, it could require two passes to wrap around
+    while (framesToDecode > 0)
+    {
+        ma_uint32 frameCount = framesToDecode;
+        void *frames = NULL;
+
+        ma_pcm_rb_acquire_write(&decoder->ring, &frameCount, &frames);
+        if (frameCount == 0) break;
+
+        unsigned int framesLeft = music.frameCount - decoder->framesDecoded;
+        if (!looping && (frameCount > framesLeft)) frameCount = framesLeft;
+
+        ReadMusicStreamFrames(music, frames, frameCount);
+        ma_pcm_rb_commit_write(&decoder->ring, frameCount);
+
+        framesToDecode -= frameCount;
+        decoder->framesDecoded += frameCount;
+
+        if (decoder->framesDecoded >= music.frameCount)
+        {
+            if (looping) decoder->framesDecoded %= music.frameCount;
+            else
+            {
+                ma_atomic_exchange_32(&decoder->state, MUSIC_DECODER_FINISHED);
+                break;
+            }
+        }
+    }
+}
+
+#if defined(SUPPORT_FILEFORMAT_MP3)
+// Get MP3 stream byte position of next frame to be decoded
+static drmp3_uint64 GetMusicMp3StreamPosition(drmp3 *mp3)
+{
+    if ((mp3->memory.pData != NULL) && (mp3->memory.dataSize > 0)) return mp3->memory.currentReadPos;
+    else return (mp3->streamCursor - mp3->dataSize);
+}
+
+// Load MP3 music stream seek index, mapping PCM frames to stream byte positions
+// NOTE: MP3 frames headers are scanned once, frames are not decoded
+static void LoadMusicMp3SeekIndex(MusicMp3 *ctxMp3, unsigned int frameCount)
+{
+    drmp3 *mp3 = &ctxMp3->mp3;
+    drmp3_uint64 interval = (drmp3_uint64)mp3->sampleRate*MUSIC_STREAM_SEEK_INTERVAL_MS/1000;
+    unsigned int capacity = (unsigned int)(frameCount/interval) + 1;
+
+    ctxMp3->seekPoints = (MusicMp3SeekPoint *)RL_CALLOC(capacity, sizeof(MusicMp3SeekPoint));
+    if (ctxMp3->seekPoints == NULL) return;
+
+    // Recent MP3 frames positions, to find lead frames of every seek point
+    drmp3_uint64 positions[MUSIC_MP3_SEEK_LEAD_FRAMES] = { 0 };
+    drmp3_uint64 frameIndex = 0;
+    drmp3_uint64 pcmFrameIndex = 0;
+    drmp3_uint64 nextSeekPoint = 0;
+
+    drmp3_seek_to_start_of_stream(mp3);
+
+    while (ctxMp3->seekPointCount < capacity)
+    {
+        drmp3_uint64 position = GetMusicMp3StreamPosition(mp3);
+        drmp3_uint32 framePcmFrames = drmp3_decode_next_frame_ex(mp3, NULL);
+        if (framePcmFrames == 0) break;
+
+        positions[frameIndex%MUSIC_MP3_SEEK_LEAD_FRAMES] = position;
+
+        if (pcmFrameIndex >= nextSeekPoint)
+        {
+            // Lead frame must be far enough for previous frame bit reservoir (up to 511 bytes) to be decoded
+            drmp3_uint64 lead = (frameIndex >= MUSIC_MP3_SEEK_LEAD_FRAMES)? frameIndex - MUSIC_MP3_SEEK_LEAD_FRAMES + 1 : 0;
+
+            if (frameIndex >= 2)
+            {
+                drmp3_uint64 previous = positions[(frameIndex - 1)%MUSIC_MP3_SEEK_LEAD_FRAMES];
+
+                for (drmp3_uint64 i = frameIndex - 2; (i > lead) && (i <= frameIndex); i--)
+                {
+                    if ((positions[i%MUSIC_MP3_SEEK_LEAD_FRAMES] + 1024) <= previous) { lead = i; break; }
+                }
+            }
+
+            MusicMp3SeekPoint *seekPoint = &ctxMp3->seekPoints[ctxMp3->seekPointCount++];
+            seekPoint->leadPosition = (frameIndex > 0)? positions[lead%MUSIC_MP3_SEEK_LEAD_FRAMES] : 0;
+            seekPoint->framePosition = position;
+            seekPoint->pcmFrameIndex = pcmFrameIndex;
+
+            nextSeekPoint += interval;
+        }
+
+        pcmFrameIndex += framePcmFrames;
+        frameIndex++;
+    }
+
+    drmp3_seek_to_start_of_stream(mp3);
+
+    TRACELOG(LOG_INFO, "STREAM: MP3 seek index loaded (%i seek points)", ctxMp3->seekPointCount);
+}
+
+// Seek MP3 music stream to a PCM frame using seek index
+// NOTE: Decoding restarts from seek point lead frames, so bit reservoir and synthesis filter state are rebuilt
+static void SeekMusicMp3(MusicMp3 *ctxMp3, unsigned int frameCount, unsigned int position)
+{
+    drmp3 *mp3 = &ctxMp3->mp3;
+
+    // Seek index is loaded on first seek
+    if (ctxMp3->seekPoints == NULL) LoadMusicMp3SeekIndex(ctxMp3, frameCount);
+
+    if (ctxMp3->seekPointCount == 0)
+    {
+        drmp3_seek_to_pcm_frame(mp3, position);
+        return;
+    }
+
+    // Find last seek point before position
+    unsigned int low = 0;
+    unsigned int high = ctxMp3->seekPointCount - 1;
+
+    while (low < high)
+    {
+        unsigned int middle = (low + high + 1)/2;
+
+        if (ctxMp3->seekPoints[middle].pcmFrameIndex <= position) low = middle;
+        else high = middle - 1;
+    }
+
+    MusicMp3SeekPoint seekPoint = ctxMp3->seekPoints[low];
+
+    drmp3__on_seek_64(mp3, seekPoint.leadPosition, drmp3_seek_origin_start);
+    drmp3_reset(mp3);
+
+    // Lead frames could fail to decode until bit reservoir is filled, frames are consumed anyway
+    while (GetMusicMp3StreamPosition(mp3) < seekPoint.framePosition)
+    {
+        if (drmp3_decode_next_frame_ex(mp3, (drmp3d_sample_t *)mp3->pcmFrames) == 0) break;
+    }
+
+    mp3->pcmFramesConsumedInMP3Frame = 0;
+    mp3->pcmFramesRemainingInMP3Frame = 0;
+    mp3->currentPCMFrame = seekPoint.pcmFrameIndex;
+
+    drmp3_seek_forward_by_pcm_frames__brute_force(mp3, position - seekPoint.pcmFrameIndex);
+}
+#endif
+
+// Update all threaded music streams decoders, from the decoder thread (or offline rendering)
+// NOTE: Decoders list is copied under the list lock and decoded without it, so the program
+// is never blocked by decoding; update lock keeps a single thread writing to the ring buffers
+static void UpdateMusicStreamDecoders(void)
+{
+    ma_mutex_lock(&AUDIO.Decoder.updateLock);
+
+    MusicStreamDecoder *first = NULL;
+
+    ma_mutex_lock(&AUDIO.Decoder.lock);
+    for (MusicStreamDecoder *decoder = AUDIO.Decoder.first; decoder != NULL; decoder = decoder->next)
+    {
+        decoder->updateNext = first;
+        first = decoder;
+    }
+    ma_mutex_unlock(&AUDIO.Decoder.lock);
+
+    for (MusicStreamDecoder *decoder = first; decoder != NULL; decoder = decoder->updateNext) UpdateMusicStreamDecoder(decoder);
+
+    ma_mutex_unlock(&AUDIO.Decoder.updateLock);
+}
+
+// Request music stream decoder to seek to a position, 0 rewinds the stream
+// NOTE: Mixer plays silence until the decoder thread has done it, so frames decoded before are never played
+static void RequestMusicStreamDecoderSeek(MusicStreamDecoder *decoder, unsigned int position)
+{
+    ma_atomic_exchange_32(&decoder->seekPosition, position);
+    ma_atomic_fetch_add_32(&decoder->seekGeneration, 1);
+}
+
+// Seek music stream context to a frame position, position 0 rewinds the stream (supported by modules)
+// NOTE: Returns the position reached, QOA streams can only be seeked to QOA frames
+static unsigned int SeekMusicStreamContext(Music music, unsigned int position)
+{
+    if (position == 0)
+    {
+        switch (music.ctxType)
+        {
+        #if defined(SUPPORT_FILEFORMAT_WAV)
+            case MUSIC_AUDIO_WAV: drwav_seek_to_first_pcm_frame((drwav *)music.ctxData); break;
+        #endif
+        #if defined(SUPPORT_FILEFORMAT_OGG)
+            case MUSIC_AUDIO_OGG: stb_vorbis_seek_start((stb_vorbis *)music.ctxData); break;
+        #endif
+        #if defined(SUPPORT_FILEFORMAT_MP3)
+            case MUSIC_AUDIO_MP3: drmp3_seek_to_start_of_stream((drmp3 *)music.ctxData); break;
+        #endif
+        #if defined(SUPPORT_FILEFORMAT_QOA)
+            case MUSIC_AUDIO_QOA: qoaplay_rewind((qoaplay_desc *)music.ctxData); break;
+        #endif
+        #if defined(SUPPORT_FILEFORMAT_FLAC)
+            case MUSIC_AUDIO_FLAC: drflac__seek_to_first_frame((drflac *)music.ctxData); break;
+        #endif
+        #if defined(SUPPORT_FILEFORMAT_XM)
+            case MUSIC_MODULE_XM: jar_xm_reset((jar_xm_context_t *)music.ctxData); break;
+        #endif
+        #if defined(SUPPORT_FILEFORMAT_MOD)
+            case MUSIC_MODULE_MOD: jar_mod_seek_start((jar_mod_context_t *)music.ctxData); break;
+        #endif
+            default: break;
+        }
+    }
+    else
+    {
+        switch (music.ctxType)
+        {
+        #if defined(SUPPORT_FILEFORMAT_WAV)
+            case MUSIC_AUDIO_WAV: drwav_seek_to_pcm_frame((drwav *)music.ctxData, position); break;
+        #endif
+        #if defined(SUPPORT_FILEFORMAT_OGG)
+            case MUSIC_AUDIO_OGG: stb_vorbis_seek_frame((stb_vorbis *)music.ctxData, position); break;
+        #endif
+        #if defined(SUPPORT_FILEFORMAT_MP3)
+            case MUSIC_AUDIO_MP3: SeekMusicMp3((MusicMp3 *)music.ctxData, music.frameCount, position); break;
+        #endif
+        #if defined(SUPPORT_FILEFORMAT_QOA)
+            case MUSIC_AUDIO_QOA:
+            {
+                int qoaFrame = position/QOA_FRAME_LEN;
+                qoaplay_seek_frame((qoaplay_desc *)music.ctxData, qoaFrame); // Seeks to QOA frame, not PCM frame
+
+                // We need to compute QOA frame number and update position
+                position = ((qoaplay_desc *)music.ctxData)->sample_position;
+            } break;
+        #endif
+        #if defined(SUPPORT_FILEFORMAT_FLAC)
+            case MUSIC_AUDIO_FLAC: drflac_seek_to_pcm_frame((drflac *)music.ctxData, position); break;
+        #endif
+            default: break;
+        }
+    }
+
+    return position;
+}
+
+#if !defined(__EMSCRIPTEN__)
+// Music streams decoder thread, keeps ring buffers of all threaded music streams filled
+static ma_thread_result MA_THREADCALL MusicStreamDecoderThread(void *userData)
+{
+    (void)userData;
+
+    while (ma_atomic_load_32(&AUDIO.Decoder.running))
+    {
+        UpdateMusicStreamDecoders();
+
+        ma_sleep(MUSIC_STREAM_DECODER_SLEEP_MS);
+    }
+
+    return (ma_thread_result)0;
+}
+#endif
+
 // Some required functions for audio standalone module version
 #if defined(RAUDIO_STANDALONE)
 // Check file extension
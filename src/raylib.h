@@ -306,16 +306,51 @@ typedef struct GlyphInfo {
     Image image;            // Character image data
 } GlyphInfo;
 
+// Opaque structs declaration
+// NOTE: Actual struct is defined internally in rtext module
+typedef struct rFontCache rFontCache;
+typedef struct rFontShaping rFontShaping;
+
 // Font, font texture and GlyphInfo array data
 typedef struct Font {
     int baseSize;           // Base size (default chars height)
     int glyphCount;         // Number of glyph characters
     int glyphPadding;       // Padding around the glyph characters
-    Texture2D texture;      // Texture atlas containing the glyphs
+    Texture2D texture;      // Texture atlas containing the glyphs (first cache page for dynamic fonts)
     Rectangle *recs;        // Rectangles in texture for the glyphs
     GlyphInfo *glyphs;      // Glyphs info data
+    rFontCache *cache;      // Glyphs cache for dynamic fonts, glyphs rasterized on first use (NULL for static fonts)
+    rFontShaping *shaping;  // Text shaping data: kerning pairs and ligatures (NULL if not available)
+    int type;               // Font type (FontType), FONT_MSDF fonts require MSDF shader: LoadShaderMSDF()
 } Font;
 
+// TextLayout, text glyphs quads precomputed for drawing
+typedef struct TextLayout {
+    Font font;              // Font used for the layout
+    int glyphCount;         // Number of glyphs quads
+    float *vertices;        // Glyphs quads vertex position (XY - 2 components per vertex, 4 vertex per quad), relative to layout position
+    float *texcoords;       // Glyphs quads texture coordinates (UV - 2 components per vertex, 4 vertex per quad)
+    int *glyphs;            // Glyphs index in font
+    int *codepoints;        // Glyphs codepoints, required to validate dynamic fonts glyphs
+    Rectangle bounds;       // Layout bounding box, relative to layout position
+} TextLayout;
+
+// TextDocument, long text indexed by lines for clipped drawing
+typedef struct TextDocument {
+    Font font;              // Font used for the document
+    float fontSize;         // Font size used for the document
+    float spacing;          // Characters spacing used for the document
+    float lineHeight;       // Distance between lines: font size + line spacing (set on load)
+    char *text;             // Document text (UTF-8, '\0' terminated)
+    int textLength;         // Document text length in bytes
+    int textCapacity;       // Document text allocated size in bytes
+    int *lineStarts;        // Lines start position in text (bytes)
+    float *lineWidths;      // Lines width
+    int lineCount;          // Number of lines (at least one)
+    int lineCapacity;       // Lines arrays allocated size
+    Vector2 size;           // Document size: longest line width and lines total height
+} TextDocument;
+
 // Camera, defines position/orientation in 3d space
 typedef struct Camera3D {
     Vector3 position;       // Camera position
@@ -418,6 +453,38 @@ typedef struct ModelAnimation {
     char name[32];          // Animation name
 } ModelAnimation;
 
+// CubicmapMesh, cubes-based map split in chunks meshes
+typedef struct CubicmapMesh {
+    int width;              // Map width in cells
+    int height;             // Map height in cells (along Z)
+    int chunkSize;          // Chunk size in cells (square chunks)
+    int chunksX;            // Number of chunks along X
+    int chunksZ;            // Number of chunks along Z
+    Vector3 cubeSize;       // Cube size
+    unsigned char *cells;   // Cells data: 0-empty, 1-cube (WHITE), 2-floor and ceiling (BLACK)
+    bool *dirty;            // Chunks requiring re-meshing
+    Mesh *chunks;           // Chunks meshes array (chunksX*chunksZ)
+} CubicmapMesh;
+
+// ModelNode, scene node with transform and linked meshes
+typedef struct ModelNode {
+    char name[32];          // Node name
+    int parent;             // Parent node index (-1 for root nodes)
+    Transform local;        // Local transform (relative to parent)
+    Matrix world;           // World transform (computed from hierarchy)
+    int meshFirst;          // First linked mesh index in scene model (-1 if no mesh linked)
+    int meshCount;          // Number of linked meshes (consecutive)
+} ModelNode;
+
+// ModelScene, unique meshes with nodes hierarchy and mesh instances
+typedef struct ModelScene {
+    Model model;            // Unique meshes and materials (nodes transforms not applied)
+    int nodeCount;          // Number of nodes
+    ModelNode *nodes;       // Nodes array
+    int *instanceCounts;    // Instances count by mesh (model.meshCount)
+    Matrix **instances;     // Instances world transforms by mesh (model.meshCount)
+} ModelScene;
+
 // Ray, ray for raycasting
 typedef struct Ray {
     Vector3 position;       // Ray position (origin)
@@ -438,6 +505,36 @@ typedef struct BoundingBox {
     Vector3 max;            // Maximum vertex box-corner
 } BoundingBox;
 
+// TerrainTile, terrain tile mesh and state
+typedef struct TerrainTile {
+    Mesh mesh;              // Tile mesh (vertex data, indices shared by LOD level)
+    BoundingBox bounds;     // Tile bounds (terrain space)
+    int lod;                // Current LOD level (0 = full detail)
+    bool loaded;            // Tile is loaded in GPU memory
+} TerrainTile;
+
+// Terrain, heightmap split in LOD tiles streamed in/out of GPU memory
+typedef struct Terrain {
+    int width;                  // Heightmap width in samples
+    int height;                 // Heightmap height in samples (along Z)
+    int tileSize;               // Tile size in quads (power of two)
+    int tilesX;                 // Number of tiles along X
+    int tilesZ;                 // Number of tiles along Z
+    int lodCount;               // Number of LOD levels
+    Vector3 size;               // Terrain size (world units)
+    unsigned short *heights;    // Normalized heights data (width*height, 16 bit)
+    TerrainTile *tiles;         // Tiles array (tilesX*tilesZ)
+
+    unsigned short **lodIndices;    // Indices shared by all tiles, by LOD level
+    int *lodIndexCounts;            // Indices count, by LOD level
+    unsigned int *lodIndexBuffers;  // Indices buffers (VBO element) shared by all tiles, by LOD level
+
+    float lodDistance;          // Distance to first LOD switch, doubled for every next level
+    float streamDistance;       // Tiles further than this distance are unloaded from GPU memory
+    int gpuBudget;              // GPU memory budget for tiles in bytes (0 = unlimited)
+    int gpuMemory;              // GPU memory currently used by tiles in bytes
+} Terrain;
+
 // Wave, audio wave data
 typedef struct Wave {
     unsigned int frameCount;    // Total number of frames (considering channels)
@@ -468,6 +565,13 @@ typedef struct Sound {
     unsigned int frameCount;    // Total number of frames (considering channels)
 } Sound;
 
+// SoundEmitter, sound 3d position and velocity
+typedef struct SoundEmitter {
+    Sound sound;                // Sound emitted
+    Vector3 position;           // Emitter position
+    Vector3 velocity;           // Emitter velocity (units per second), for doppler effect
+} SoundEmitter;
+
 // Music, audio stream, anything longer than ~10 seconds should be streamed
 typedef struct Music {
     AudioStream stream;         // Audio stream
@@ -880,7 +984,8 @@ typedef enum {
 typedef enum {
     FONT_DEFAULT = 0,               // Default font generation, anti-aliased
     FONT_BITMAP,                    // Bitmap font generation, no anti-aliasing
-    FONT_SDF                        // SDF font generation, requires external shader
+    FONT_SDF,                       // SDF font generation, requires external shader
+    FONT_MSDF                       // Multi-channel SDF font generation (RGB), requires MSDF shader: LoadShaderMSDF()
 } FontType;
 
 // Color blending modes (pre-defined)
@@ -933,6 +1038,42 @@ typedef enum {
     NPATCH_THREE_PATCH_HORIZONTAL   // Npatch layout: 3x1 tiles
 } NPatchLayout;
 
+// Sound storage format
+typedef enum {
+    SOUND_STORAGE_DEVICE = 0,       // Sound data converted to device format at loading (f32, device channels and sample rate)
+    SOUND_STORAGE_NATIVE,           // Sound data kept in wave format, converted at mixing time
+    SOUND_STORAGE_QOA               // Sound data compressed with QOA, decoded and converted at mixing time
+} SoundStorageFormat;
+
+// Audio resampling quality, used for sample rate conversion and pitching
+typedef enum {
+    AUDIO_RESAMPLE_LINEAR = 0,      // Linear interpolation (2 taps), fastest
+    AUDIO_RESAMPLE_SINC_MEDIUM,     // Windowed-sinc interpolation (8 taps)
+    AUDIO_RESAMPLE_SINC_HIGH        // Windowed-sinc interpolation (32 taps), highest quality
+} AudioResampleQuality;
+
+// Sound distance attenuation model, distance is clamped to [minDistance, maxDistance]
+typedef enum {
+    SOUND_ATTENUATION_NONE = 0,     // No distance attenuation
+    SOUND_ATTENUATION_INVERSE,      // Inverse distance: min/(min + rolloff*(distance - min)) (default)
+    SOUND_ATTENUATION_LINEAR,       // Linear distance: 1 - rolloff*(distance - min)/(max - min)
+    SOUND_ATTENUATION_EXPONENTIAL   // Exponential distance: (distance/min)^-rolloff
+} SoundAttenuation;
+
+// Audio mixing bus, sounds and streams are mixed into their bus, then buses into master bus
+typedef enum {
+    AUDIO_BUS_MASTER = 0,           // Master bus, all buses are mixed into it
+    AUDIO_BUS_MUSIC,                // Music bus (default for music and audio streams)
+    AUDIO_BUS_SFX,                  // Sound effects bus (default for sounds)
+    AUDIO_BUS_VOICE                 // Voice/dialog bus
+} AudioBus;
+
+// Audio bus filter type
+typedef enum {
+    AUDIO_FILTER_LOWPASS = 0,       // Low-pass filter, attenuates frequencies above cutoff
+    AUDIO_FILTER_HIGHPASS           // High-pass filter, attenuates frequencies below cutoff
+} AudioFilter;
+
 // Callbacks to hook some internal functions
 // WARNING: These callbacks are intended for advanced users
 typedef void (*TraceLogCallback)(int logLevel, const char *text, va_list args);  // Logging: Redirect trace log messages
@@ -1446,12 +1587,19 @@ RLAPI Font LoadFont(const char *fileName);
 RLAPI Font LoadFontEx(const char *fileName, int fontSize, int *codepoints, int codepointCount); // Load font from file with extended parameters, use NULL for codepoints and 0 for codepointCount to load the default character set, font size is provided in pixels height
 RLAPI Font LoadFontFromImage(Image image, Color key, int firstChar);                        // Load font from Image (XNA style)
 RLAPI Font LoadFontFromMemory(const char *fileType, const unsigned char *fileData, int dataSize, int fontSize, int *codepoints, int codepointCount); // Load font from memory buffer, fileType refers to extension: i.e. '.ttf'
+RLAPI Font LoadFontDynamic(const char *fileName, int fontSize);                             // Load font from file in dynamic mode, glyphs are rasterized on first use into a glyph cache atlas
+RLAPI Font LoadFontDynamicFromMemory(const char *fileType, const unsigned char *fileData, int dataSize, int fontSize); // Load font from memory buffer in dynamic mode, fileType refers to extension: i.e. '.ttf'
+RLAPI Font LoadFontMSDF(const char *fileName, int fontSize, int *codepoints, int codepointCount); // Load font from TTF file as multi-channel SDF atlas, drawn at any size with MSDF shader
+RLAPI Font LoadFontBinary(const char *fileName);                                           // Load font from binary file (.rfnt), atlas and metrics loaded with one file read
+RLAPI Shader LoadShaderMSDF(void);                                                          // Load built-in shader to draw multi-channel SDF fonts
 RLAPI bool IsFontReady(Font font);                                                          // Check if a font is ready
 RLAPI GlyphInfo *LoadFontData(const unsigned char *fileData, int dataSize, int fontSize, int *codepoints, int codepointCount, int type); // Load font data for further use
 RLAPI Image GenImageFontAtlas(const GlyphInfo *glyphs, Rectangle **glyphRecs, int glyphCount, int fontSize, int padding, int packMethod); // Generate image font atlas using chars info
 RLAPI void UnloadFontData(GlyphInfo *glyphs, int glyphCount);                               // Unload font chars info data (RAM)
 RLAPI void UnloadFont(Font font);                                                           // Unload font from GPU memory (VRAM)
 RLAPI bool ExportFontAsCode(Font font, const char *fileName);                               // Export font as code file, returns true on success
+RLAPI bool ExportFontAsBMFont(Font font, const char *fileName);                             // Export font as BMFont text file (.fnt) and atlas image (.png), returns true on success
+RLAPI bool ExportFontBinary(Font font, const char *fileName);                               // Export font as binary file (.rfnt): atlas, metrics, kerning and codepoints, returns true on success
 
 // Text drawing functions
 RLAPI void DrawFPS(int posX, int posY);                                                     // Draw current FPS
@@ -1461,13 +1609,29 @@ RLAPI void DrawTextPro(Font font, const char *text, Vector2 position, Vector2 or
 RLAPI void DrawTextCodepoint(Font font, int codepoint, Vector2 position, float fontSize, Color tint); // Draw one character (codepoint)
 RLAPI void DrawTextCodepoints(Font font, const int *codepoints, int codepointCount, Vector2 position, float fontSize, float spacing, Color tint); // Draw multiple character (codepoint)
 
+// Text layout functions
+RLAPI TextLayout LoadTextLayout(Font font, const char *text, float fontSize, float spacing); // Load text layout, glyphs quads precomputed for static text drawing
+RLAPI void UnloadTextLayout(TextLayout layout);                                             // Unload text layout data (RAM)
+RLAPI void DrawTextLayout(TextLayout layout, Vector2 position, Color tint);                  // Draw text layout, glyphs quads copied in bulk to the render batch
+
+// Text document functions
+RLAPI TextDocument LoadTextDocument(Font font, const char *text, float fontSize, float spacing); // Load text document, text lines indexed for clipped drawing of long texts
+RLAPI void UnloadTextDocument(TextDocument document);                                       // Unload text document data (RAM)
+RLAPI void AppendTextDocument(TextDocument *document, const char *text);                    // Append text to text document, only new lines are measured
+RLAPI int GetTextDocumentLine(TextDocument document, int position);                         // Get text document line containing a text byte position
+RLAPI void DrawTextDocument(TextDocument document, Vector2 position, Rectangle clip, Color tint); // Draw text document lines intersecting a clip rectangle
+
 // Text font info functions
 RLAPI void SetTextLineSpacing(int spacing);                                                 // Set vertical line spacing when drawing with line-breaks
+RLAPI void SetTextLigatures(bool enabled);                                                  // Set ligatures substitution when drawing and measuring text (fonts must contain ligature glyphs)
 RLAPI int MeasureText(const char *text, int fontSize);                                      // Measure string width for default font
 RLAPI Vector2 MeasureTextEx(Font font, const char *text, float fontSize, float spacing);    // Measure string size for Font
-RLAPI int GetGlyphIndex(Font font, int codepoint);                                          // Get glyph index position in font for a codepoint (unicode character), fallback to '?' if not found
+RLAPI int GetGlyphIndex(Font font, int codepoint);                                          // Get glyph index position in font for a codepoint (unicode character), fallback to '?' if not found (dynamic fonts could rasterize it)
 RLAPI GlyphInfo GetGlyphInfo(Font font, int codepoint);                                     // Get glyph font info data for a codepoint (unicode character), fallback to '?' if not found
 RLAPI Rectangle GetGlyphAtlasRec(Font font, int codepoint);                                 // Get glyph rectangle in font atlas for a codepoint (unicode character), fallback to '?' if not found
+RLAPI Texture2D GetGlyphAtlasTexture(Font font, int codepoint);                             // Get glyph atlas texture for a codepoint (unicode character), dynamic fonts use several atlas pages
+RLAPI float GetGlyphKerning(Font font, int codepoint, int nextCodepoint);                  // Get kerning advance adjustment between two codepoints (unicode characters), scaled to font base size
+RLAPI int GetGlyphCodepointNext(Font font, const char *text, int *codepointSize);         // Get next codepoint drawn for a font in a UTF-8 encoded string, ligatures substituted if enabled
 
 // Text codepoints management functions (unicode characters)
 RLAPI char *LoadUTF8(const int *codepoints, int length);                // Load UTF-8 text encoded from codepoints array
@@ -1499,6 +1663,20 @@ RLAPI const char *TextToPascal(const char *text);                     // Get Pas
 RLAPI const char *TextToSnake(const char *text);                      // Get Snake case notation version of provided string
 RLAPI const char *TextToCamel(const char *text);                      // Get Camel case notation version of provided string
 
+// Text strings management functions, reentrant versions writing into provided buffer (thread-safe)
+// NOTE: Text is truncated to fit bufferSize (including '\0'), required text length is returned
+RLAPI int TextFormatBuffer(char *buffer, int bufferSize, const char *text, ...);               // Text formatting with variables into buffer (snprintf() style)
+RLAPI int TextSubtextBuffer(char *buffer, int bufferSize, const char *text, int position, int length); // Get a piece of a text string into buffer
+RLAPI int TextReplaceBuffer(char *buffer, int bufferSize, const char *text, const char *replace, const char *by); // Replace text string into buffer
+RLAPI int TextInsertBuffer(char *buffer, int bufferSize, const char *text, const char *insert, int position); // Insert text in a position into buffer
+RLAPI int TextJoinBuffer(char *buffer, int bufferSize, const char **textList, int count, const char *delimiter); // Join text strings with delimiter into buffer
+RLAPI int TextSplitBuffer(char *buffer, int bufferSize, const char *text, char delimiter, const char **result, int maxCount); // Split text into buffer, returns substrings count
+RLAPI int TextToUpperBuffer(char *buffer, int bufferSize, const char *text);                   // Get upper case version of provided string into buffer
+RLAPI int TextToLowerBuffer(char *buffer, int bufferSize, const char *text);                   // Get lower case version of provided string into buffer
+RLAPI int TextToPascalBuffer(char *buffer, int bufferSize, const char *text);                  // Get Pascal case notation version of provided string into buffer
+RLAPI int TextToSnakeBuffer(char *buffer, int bufferSize, const char *text);                   // Get Snake case notation version of provided string into buffer
+RLAPI int TextToCamelBuffer(char *buffer, int bufferSize, const char *text);                   // Get Camel case notation version of provided string into buffer
+
 RLAPI int TextToInteger(const char *text);                            // Get integer value from text (negative values not supported)
 RLAPI float TextToFloat(const char *text);                            // Get float value from text (negative values not supported)
 
@@ -1539,6 +1717,12 @@ RLAPI Model LoadModelFromMesh(Mesh mesh);
 RLAPI bool IsModelReady(Model model);                                                       // Check if a model is ready
 RLAPI void UnloadModel(Model model);                                                        // Unload model (including meshes) from memory (RAM and/or VRAM)
 RLAPI BoundingBox GetModelBoundingBox(Model model);                                         // Compute model bounding box limits (considers all meshes)
+RLAPI bool ExportModelBinary(Model model, const ModelAnimation *animations, int animCount, const char *fileName); // Export model (and animations) to binary file, returns true on success
+RLAPI Model LoadModelBinary(const char *fileName);                                          // Load model from binary file, no parsing required
+RLAPI ModelAnimation *LoadModelAnimationsBinary(const char *fileName, int *animCount);      // Load model animations from binary file
+RLAPI ModelScene LoadModelScene(const char *fileName);                                      // Load model scene from file (glTF), keeping nodes hierarchy and mesh instances
+RLAPI void UpdateModelScene(ModelScene *scene);                                             // Update scene nodes world transforms and mesh instances (after changing nodes local transform)
+RLAPI void UnloadModelScene(ModelScene scene);                                              // Unload model scene (unique meshes, materials and nodes)
 
 // Model drawing functions
 RLAPI void DrawModel(Model model, Vector3 position, float scale, Color tint);               // Draw a model (with texture if set)
@@ -1547,6 +1731,8 @@ RLAPI void DrawModelWires(Model model, Vector3 position, float scale, Color tint
 RLAPI void DrawModelWiresEx(Model model, Vector3 position, Vector3 rotationAxis, float rotationAngle, Vector3 scale, Color tint); // Draw a model wires (with texture if set) with extended parameters
 RLAPI void DrawModelPoints(Model model, Vector3 position, float scale, Color tint); // Draw a model as points
 RLAPI void DrawModelPointsEx(Model model, Vector3 position, Vector3 rotationAxis, float rotationAngle, Vector3 scale, Color tint); // Draw a model as points with extended parameters
+RLAPI void DrawModelScene(ModelScene scene, Vector3 position, float scale, Color tint);    // Draw a model scene, one mesh draw per instance
+RLAPI void DrawModelSceneInstanced(ModelScene scene, Shader shader, Vector3 position, float scale, Color tint); // Draw a model scene using instancing shader for meshes with multiple instances
 RLAPI void DrawBoundingBox(BoundingBox box, Color color);                                   // Draw bounding box (wires)
 RLAPI void DrawBillboard(Camera camera, Texture2D texture, Vector3 position, float scale, Color tint);   // Draw a billboard texture
 RLAPI void DrawBillboardRec(Camera camera, Texture2D texture, Rectangle source, Vector3 position, Vector2 size, Color tint); // Draw a billboard texture defined by source
@@ -1575,6 +1761,16 @@ RLAPI Mesh GenMeshTorus(float radius, float size, int radSeg, int sides);
 RLAPI Mesh GenMeshKnot(float radius, float size, int radSeg, int sides);                    // Generate trefoil knot mesh
 RLAPI Mesh GenMeshHeightmap(Image heightmap, Vector3 size);                                 // Generate heightmap mesh from image data
 RLAPI Mesh GenMeshCubicmap(Image cubicmap, Vector3 cubeSize);                               // Generate cubes-based map mesh from image data
+RLAPI CubicmapMesh GenMeshCubicmapChunks(Image cubicmap, Vector3 cubeSize, int chunkSize);  // Generate cubes-based map chunks meshes from image data (greedy faces merging)
+RLAPI void SetCubicmapCell(CubicmapMesh *cubicmap, int x, int z, Color color);             // Set cubicmap cell (WHITE, BLACK or empty), marks affected chunks as dirty
+RLAPI void UpdateCubicmapMesh(CubicmapMesh *cubicmap);                                     // Re-mesh cubicmap dirty chunks and upload them to GPU
+RLAPI void UnloadCubicmapMesh(CubicmapMesh cubicmap);                                      // Unload cubicmap chunks meshes and cells data
+
+// Terrain management functions
+RLAPI Terrain LoadTerrain(Image heightmap, Vector3 size, int tileSize);                     // Load terrain from heightmap (GRAYSCALE, R16, R32 or color), tiles are streamed on update
+RLAPI void UpdateTerrain(Terrain *terrain, Vector3 viewPosition);                          // Update terrain tiles LOD and streaming for a view position (terrain space)
+RLAPI void DrawTerrain(Terrain terrain, Material material, Matrix transform);               // Draw terrain loaded tiles with material and transform
+RLAPI void UnloadTerrain(Terrain terrain);                                                  // Unload terrain tiles, shared indices and heights data
 
 // Material loading/unloading functions
 RLAPI Material *LoadMaterials(const char *fileName, int *materialCount);                    // Load materials from model file
@@ -1608,10 +1804,21 @@ typedef void (*AudioCallback)(void *bufferData, unsigned int frames);
 
 // Audio device management functions
 RLAPI void InitAudioDevice(void);                                     // Initialize audio device and context
+RLAPI void InitAudioDeviceOffline(int sampleRate);                    // Initialize audio device for offline rendering (no audio hardware)
+RLAPI void RenderAudioFrames(float *frames, int frameCount);          // Render audio frames offline, mixing playing sounds/streams/music (interleaved stereo float)
 RLAPI void CloseAudioDevice(void);                                    // Close the audio device and context
 RLAPI bool IsAudioDeviceReady(void);                                  // Check if audio device has been initialized successfully
 RLAPI void SetMasterVolume(float volume);                             // Set master volume (listener)
 RLAPI float GetMasterVolume(void);                                    // Get master volume (listener)
+RLAPI void SetSoundStorageFormat(int format);                         // Set storage format for sounds loaded afterwards (SoundStorageFormat)
+RLAPI void SetAudioListener(Vector3 position, Vector3 forward, Vector3 up, Vector3 velocity); // Set audio listener position, orientation and velocity for spatial sounds
+RLAPI void SetAudioDopplerFactor(float factor);                       // Set doppler effect factor for spatial sounds (1.0 is default, 0.0 disables it)
+RLAPI void SetAudioBusVolume(int bus, float volume);                  // Set audio bus volume (AudioBus)
+RLAPI void SetAudioBusFilter(int bus, int filter, float cutoff, float resonance); // Set audio bus low-pass/high-pass filter (AudioFilter), cutoff 0.0 disables it
+RLAPI void SetAudioBusReverb(int bus, float roomSize, float damping, float wet); // Set audio bus reverb, wet level 0.0 disables it
+RLAPI void SetAudioBusLimiter(int bus, float threshold, float release); // Set audio bus peak limiter (release in seconds), threshold 0.0 disables it
+RLAPI void SetAudioResampleQuality(int quality);                      // Set resampling quality for sample rate conversion and pitching (AudioResampleQuality)
+RLAPI void SetAudioMaxVoices(int maxVoices);                          // Set maximum number of sounds mixed at once, others keep playing virtually (0: no limit, default)
 
 // Wave/Sound loading/unloading functions
 RLAPI Wave LoadWave(const char *fileName);                            // Load wave data from file
@@ -1637,6 +1844,12 @@ RLAPI bool IsSoundPlaying(Sound sound);                               // Check i
 RLAPI void SetSoundVolume(Sound sound, float volume);                 // Set volume for a sound (1.0 is max level)
 RLAPI void SetSoundPitch(Sound sound, float pitch);                   // Set pitch for a sound (1.0 is base level)
 RLAPI void SetSoundPan(Sound sound, float pan);                       // Set pan for a sound (0.5 is center)
+RLAPI void SetSoundEmitter(Sound sound, Vector3 position, Vector3 velocity); // Set sound emitter position and velocity, enables spatialization
+RLAPI void UpdateSoundEmitters(const SoundEmitter *emitters, int count); // Update multiple sound emitters at once (batched, one lock)
+RLAPI void SetSoundSpatial(Sound sound, bool spatial);                // Set sound spatialization enabled/disabled (enabled by SetSoundEmitter())
+RLAPI void SetSoundAttenuation(Sound sound, int model, float minDistance, float maxDistance, float rolloff); // Set sound distance attenuation model (SoundAttenuation)
+RLAPI void SetSoundBus(Sound sound, int bus);                          // Set mixing bus for a sound (AudioBus), default: AUDIO_BUS_SFX
+RLAPI void SetSoundPriority(Sound sound, int priority);               // Set priority for a sound when voices are limited (0 is default, higher is more important)
 RLAPI Wave WaveCopy(Wave wave);                                       // Copy a wave to a new wave
 RLAPI void WaveCrop(Wave *wave, int initFrame, int finalFrame);       // Crop a wave to defined frames range
 RLAPI void WaveFormat(Wave *wave, int sampleRate, int sampleSize, int channels); // Convert wave data to desired format
@@ -1651,6 +1864,7 @@ RLAPI void UnloadMusicStream(Music music);                            // Unload
 RLAPI void PlayMusicStream(Music music);                              // Start music playing
 RLAPI bool IsMusicStreamPlaying(Music music);                         // Check if music is playing
 RLAPI void UpdateMusicStream(Music music);                            // Updates buffers for music streaming
+RLAPI void SetMusicStreamThreaded(Music music, bool threaded);        // Set music stream decoding on a background thread (UpdateMusicStream() only syncs looping)
 RLAPI void StopMusicStream(Music music);                              // Stop music playing
 RLAPI void PauseMusicStream(Music music);                             // Pause music playing
 RLAPI void ResumeMusicStream(Music music);                            // Resume playing paused music
@@ -1658,6 +1872,7 @@ RLAPI void SeekMusicStream(Music music, float position);              // Seek mu
 RLAPI void SetMusicVolume(Music music, float volume);                 // Set volume for music (1.0 is max level)
 RLAPI void SetMusicPitch(Music music, float pitch);                   // Set pitch for a music (1.0 is base level)
 RLAPI void SetMusicPan(Music music, float pan);                       // Set pan for a music (0.5 is center)
+RLAPI void SetMusicBus(Music music, int bus);                         // Set mixing bus for a music (AudioBus), default: AUDIO_BUS_MUSIC
 RLAPI float GetMusicTimeLength(Music music);                          // Get music time length (in seconds)
 RLAPI float GetMusicTimePlayed(Music music);                          // Get current music time played (in seconds)
 
@@ -1675,6 +1890,7 @@ RLAPI void StopAudioStream(AudioStream stream);                       // Stop au
 RLAPI void SetAudioStreamVolume(AudioStream stream, float volume);    // Set volume for audio stream (1.0 is max level)
 RLAPI void SetAudioStreamPitch(AudioStream stream, float pitch);      // Set pitch for audio stream (1.0 is base level)
 RLAPI void SetAudioStreamPan(AudioStream stream, float pan);          // Set pan for audio stream (0.5 is centered)
+RLAPI void SetAudioStreamBus(AudioStream stream, int bus);            // Set mixing bus for audio stream (AudioBus), default: AUDIO_BUS_MUSIC
 RLAPI void SetAudioStreamBufferSizeDefault(int size);                 // Default size for new audio streams
 RLAPI void SetAudioStreamCallback(AudioStream stream, AudioCallback callback); // Audio thread callback to request new data
 
@@ -901,6 +901,8 @@ void EndDrawing(void)
     if (automationEventRecording) RecordAutomationEvent();    // Event recording
 #endif
 
+    rlResetRenderStats();       // Store current frame render stats, available with rlGetRenderStats()
+
 #if !defined(SUPPORT_CUSTOM_FRAME_CONTROL)
     SwapScreenBuffer();                  // Copy back buffer to front buffer (screen)
 
@@ -20,6 +20,10 @@
 *
 *       Internal buffer (and resources) must be manually unloaded calling rlglClose().
 *
+*       A GL state cache keeps track of bound shader program, textures per slot, vertex array and
+*       uniform values uploaded (by shader and location), redundant GL calls are skipped.
+*       WARNING: If OpenGL state is modified directly (not using rlgl), rlResetStateCache() must be called
+*
 *   CONFIGURATION:
 *       #define GRAPHICS_API_OPENGL_11
 *       #define GRAPHICS_API_OPENGL_21
@@ -56,6 +60,8 @@
 *
 *       #define RL_MAX_MATRIX_STACK_SIZE             32    // Maximum size of internal Matrix stack
 *       #define RL_MAX_SHADER_LOCATIONS              32    // Maximum number of shader locations supported
+*       #define RL_MAX_STATE_CACHE_TEXTURE_SLOTS     16    // Maximum number of texture slots tracked by state cache
+*       #define RL_MAX_STATE_CACHE_UNIFORMS         256    // Maximum number of uniform values tracked by state cache (power of 2)
 *       #define RL_CULL_DISTANCE_NEAR              0.01    // Default projection matrix near cull distance
 *       #define RL_CULL_DISTANCE_FAR             1000.0    // Default projection matrix far cull distance
 *
@@ -229,6 +235,14 @@
     #define RL_MAX_SHADER_LOCATIONS                 32      // Maximum number of shader locations supported
 #endif
 
+// State cache limits
+#ifndef RL_MAX_STATE_CACHE_TEXTURE_SLOTS
+    #define RL_MAX_STATE_CACHE_TEXTURE_SLOTS        16      // Maximum number of texture slots tracked by state cache
+#endif
+#ifndef RL_MAX_STATE_CACHE_UNIFORMS
+    #define RL_MAX_STATE_CACHE_UNIFORMS            256      // Maximum number of uniform values tracked by state cache (power of 2)
+#endif
+
 // Projection matrix culling
 #ifndef RL_CULL_DISTANCE_NEAR
     #define RL_CULL_DISTANCE_NEAR                 0.01      // Default near cull distance
@@ -408,6 +422,13 @@ typedef struct rlRenderBatch {
     float currentDepth;         // Current depth value for next draw
 } rlRenderBatch;
 
+// Render stats, GL calls issued and skipped by state cache
+typedef struct rlRenderStats {
+    unsigned int drawCalls;     // Number of draw calls issued
+    unsigned int callsIssued;   // Number of GL state/uniform calls issued
+    unsigned int callsSkipped;  // Number of GL state/uniform calls skipped (redundant, state already set)
+} rlRenderStats;
+
 // OpenGL version
 typedef enum {
     RL_OPENGL_11 = 1,           // OpenGL 1.1
@@ -611,6 +632,7 @@ RLAPI void rlNormal3f(float x, float y, float z);       // Define one vertex (no
 RLAPI void rlColor4ub(unsigned char r, unsigned char g, unsigned char b, unsigned char a); // Define one vertex (color) - 4 byte
 RLAPI void rlColor3f(float x, float y, float z);        // Define one vertex (color) - 3 float
 RLAPI void rlColor4f(float x, float y, float z, float w); // Define one vertex (color) - 4 float
+RLAPI void rlVertexQuads2f(const float *vertices, const float *texcoords, int quadCount, float offsetX, float offsetY); // Define multiple quads (position and texture coordinates) - 2 float, 4 vertex per quad
 
 //------------------------------------------------------------------------------------
 // Functions Declaration - OpenGL style functions (common to 1.1, 3.3+, ES2)
@@ -638,6 +660,7 @@ RLAPI void rlEnableTexture(unsigned int id);            // Enable texture
 RLAPI void rlDisableTexture(void);                      // Disable texture
 RLAPI void rlEnableTextureCubemap(unsigned int id);     // Enable texture cubemap
 RLAPI void rlDisableTextureCubemap(void);               // Disable texture cubemap
+RLAPI void rlDisableTextureSlots(int slot, int count);  // Disable textures for a range of slots (only slots with textures bound)
 RLAPI void rlTextureParameters(unsigned int id, int param, int value); // Set texture parameters (filter, wrap)
 RLAPI void rlCubemapParameters(unsigned int id, int param, int value); // Set cubemap parameters (filter, wrap)
 
@@ -698,6 +721,10 @@ RLAPI int rlGetFramebufferWidth(void);                  // Get default framebuff
 RLAPI void rlSetFramebufferHeight(int height);          // Set current framebuffer height
 RLAPI int rlGetFramebufferHeight(void);                 // Get default framebuffer height
 
+RLAPI void rlResetStateCache(void);                     // Reset GL state cache (required after direct OpenGL state changes)
+RLAPI rlRenderStats rlGetRenderStats(void);             // Get render stats for last completed frame
+RLAPI void rlResetRenderStats(void);                    // Reset render stats, current frame stats are stored as last completed frame
+
 RLAPI unsigned int rlGetTextureIdDefault(void);         // Get default texture id
 RLAPI unsigned int rlGetShaderIdDefault(void);          // Get default shader id
 RLAPI int *rlGetShaderLocsDefault(void);                // Get default shader locations
@@ -886,6 +913,8 @@ RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
     #define RAD2DEG (180.0f/PI)
 #endif
 
+#define RL_STATE_CACHE_UNKNOWN          0xFFFFFFFF  // State cache value not known, next GL call can not be skipped
+
 #ifndef GL_SHADING_LANGUAGE_VERSION
     #define GL_SHADING_LANGUAGE_VERSION         0x8B8C
 #endif
@@ -1010,6 +1039,14 @@ RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+// Uniform value uploaded to a shader location, tracked by state cache
+typedef struct rlUniformCacheEntry {
+    unsigned int shaderId;              // Shader program id the value was uploaded to
+    int locIndex;                       // Shader uniform location
+    int size;                           // Value data size in bytes
+    float value[16];                    // Value data (up to a matrix 4x4)
+} rlUniformCacheEntry;
+
 typedef struct rlglData {
     rlRenderBatch *currentBatch;            // Current render batch
     rlRenderBatch defaultBatch;             // Default internal render batch
@@ -1059,6 +1096,17 @@ typedef struct rlglData {
         int framebufferHeight;              // Current framebuffer height
 
     } State;            // Renderer state
+    struct {
+        unsigned int shaderId;              // Shader program currently bound
+        int textureSlot;                    // Texture slot currently active
+        unsigned int textureId[RL_MAX_STATE_CACHE_TEXTURE_SLOTS];   // Texture 2d currently bound per slot
+        unsigned int cubemapId[RL_MAX_STATE_CACHE_TEXTURE_SLOTS];   // Texture cubemap currently bound per slot
+        unsigned int vaoId;                 // Vertex array currently bound
+        rlUniformCacheEntry uniforms[RL_MAX_STATE_CACHE_UNIFORMS];  // Uniform values uploaded (by shader and location)
+
+        rlRenderStats stats;                // Render stats for current frame
+        rlRenderStats lastStats;            // Render stats for last completed frame
+    } StateCache;       // GL state cache, avoid redundant GL calls
     struct {
         bool vao;                           // VAO support (OpenGL ES2 could not support VAO extension) (GL_ARB_vertex_array_object)
         bool instancing;                    // Instancing supported (GL_ANGLE_instanced_arrays, GL_EXT_draw_instanced + GL_EXT_instanced_arrays)
@@ -1115,12 +1163,15 @@ static PFNGLVERTEXATTRIBDIVISOREXTPROC glVertexAttribDivisor = NULL;
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
 static void rlLoadShaderDefault(void);      // Load default shader
 static void rlUnloadShaderDefault(void);    // Unload default shader
+static bool rlCheckStateCacheUniform(int locIndex, const void *value, int size); // Check uniform value already uploaded, register it otherwise
+static void rlResetStateCacheUniforms(unsigned int shaderId); // Reset uniform values registered for a shader
 #if defined(RLGL_SHOW_GL_DETAILS_INFO)
 static const char *rlGetCompressedFormatName(int format); // Get compressed format official GL identifier name
 #endif  // RLGL_SHOW_GL_DETAILS_INFO
 #endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
 
 static int rlGetPixelDataSize(int width, int height, int format);   // Get pixel data size in bytes (image or texture)
+static void rlSetStateCacheTexture(unsigned int target, unsigned int id); // Register texture bound on active slot into state cache
 
 // Auxiliar matrix math functions
 typedef struct rl_float16 {
@@ -1419,6 +1470,14 @@ void rlNormal3f(float x, float y, float z) { glNormal3f(x, y, z); }
 void rlColor4ub(unsigned char r, unsigned char g, unsigned char b, unsigned char a) { glColor4ub(r, g, b, a); }
 void rlColor3f(float x, float y, float z) { glColor3f(x, y, z); }
 void rlColor4f(float x, float y, float z, float w) { glColor4f(x, y, z, w); }
+void rlVertexQuads2f(const float *vertices, const float *texcoords, int quadCount, float offsetX, float offsetY)
+{
+    for (int i = 0; i < quadCount*4; i++)
+    {
+        glTexCoord2f(texcoords[2*i], texcoords[2*i + 1]);
+        glVertex2f(vertices[2*i] + offsetX, vertices[2*i + 1] + offsetY);
+    }
+}
 #endif
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
 // Initialize drawing mode (how to organize vertex)
@@ -1595,6 +1654,67 @@ void rlColor3f(float x, float y, float z)
     rlColor4ub((unsigned char)(x*255), (unsigned char)(y*255), (unsigned char)(z*255), 255);
 }
 
+// Define multiple quads (position and texture coordinates), copied in bulk to the internal vertex buffer
+// NOTE: Requires rlBegin(RL_QUADS), current color and normal are used for all vertex
+void rlVertexQuads2f(const float *vertices, const float *texcoords, int quadCount, float offsetX, float offsetY)
+{
+    int quadsAdded = 0;
+
+    while (quadsAdded < quadCount)
+    {
+        rlVertexBuffer *buffer = &RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer];
+
+        // Quads are copied in chunks fitting the vertex buffer, batch is drawn when it is full
+        // NOTE: We keep one quad free for security, same as rlVertex3f()
+        int count = (buffer->elementCount*4 - RLGL.State.vertexCounter)/4 - 1;
+
+        if (count <= 0)
+        {
+            rlCheckRenderBatchLimit(2*4);
+            continue;
+        }
+
+        if (count > (quadCount - quadsAdded)) count = quadCount - quadsAdded;
+
+        const float *quadVertices = vertices + quadsAdded*8;
+        float depth = RLGL.currentBatch->currentDepth;
+
+        for (int i = 0, v = RLGL.State.vertexCounter; i < count*4; i++, v++)
+        {
+            float x = quadVertices[2*i] + offsetX;
+            float y = quadVertices[2*i + 1] + offsetY;
+
+            if (RLGL.State.transformRequired)
+            {
+                buffer->vertices[3*v] = RLGL.State.transform.m0*x + RLGL.State.transform.m4*y + RLGL.State.transform.m8*depth + RLGL.State.transform.m12;
+                buffer->vertices[3*v + 1] = RLGL.State.transform.m1*x + RLGL.State.transform.m5*y + RLGL.State.transform.m9*depth + RLGL.State.transform.m13;
+                buffer->vertices[3*v + 2] = RLGL.State.transform.m2*x + RLGL.State.transform.m6*y + RLGL.State.transform.m10*depth + RLGL.State.transform.m14;
+            }
+            else
+            {
+                buffer->vertices[3*v] = x;
+                buffer->vertices[3*v + 1] = y;
+                buffer->vertices[3*v + 2] = depth;
+            }
+
+            buffer->normals[3*v] = RLGL.State.normalx;
+            buffer->normals[3*v + 1] = RLGL.State.normaly;
+            buffer->normals[3*v + 2] = RLGL.State.normalz;
+
+            buffer->colors[4*v] = RLGL.State.colorr;
+            buffer->colors[4*v + 1] = RLGL.State.colorg;
+            buffer->colors[4*v + 2] = RLGL.State.colorb;
+            buffer->colors[4*v + 3] = RLGL.State.colora;
+        }
+
+        memcpy(&buffer->texcoords[2*RLGL.State.vertexCounter], texcoords + quadsAdded*8, count*8*sizeof(float));
+
+        RLGL.State.vertexCounter += count*4;
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount += count*4;
+        quadsAdded += count;
+    }
+}
+
 #endif
 
 //--------------------------------------------------------------------------------------
@@ -1656,7 +1776,13 @@ void rlSetTexture(unsigned int id)
 void rlActiveTextureSlot(int slot)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glActiveTexture(GL_TEXTURE0 + slot);
+    if (RLGL.StateCache.textureSlot != slot)
+    {
+        glActiveTexture(GL_TEXTURE0 + slot);
+        RLGL.StateCache.textureSlot = slot;
+        RLGL.StateCache.stats.callsIssued++;
+    }
+    else RLGL.StateCache.stats.callsSkipped++;
 #endif
 }
 
@@ -1665,8 +1791,19 @@ void rlEnableTexture(unsigned int id)
 {
 #if defined(GRAPHICS_API_OPENGL_11)
     glEnable(GL_TEXTURE_2D);
-#endif
     glBindTexture(GL_TEXTURE_2D, id);
+#endif
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    int slot = RLGL.StateCache.textureSlot;
+
+    if ((slot >= 0) && (slot < RL_MAX_STATE_CACHE_TEXTURE_SLOTS) && (RLGL.StateCache.textureId[slot] == id)) RLGL.StateCache.stats.callsSkipped++;
+    else
+    {
+        glBindTexture(GL_TEXTURE_2D, id);
+        rlSetStateCacheTexture(GL_TEXTURE_2D, id);
+        RLGL.StateCache.stats.callsIssued++;
+    }
+#endif
 }
 
 // Disable texture
@@ -1674,15 +1811,26 @@ void rlDisableTexture(void)
 {
 #if defined(GRAPHICS_API_OPENGL_11)
     glDisable(GL_TEXTURE_2D);
-#endif
     glBindTexture(GL_TEXTURE_2D, 0);
+#endif
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    rlEnableTexture(0);
+#endif
 }
 
 // Enable texture cubemap
 void rlEnableTextureCubemap(unsigned int id)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glBindTexture(GL_TEXTURE_CUBE_MAP, id);
+    int slot = RLGL.StateCache.textureSlot;
+
+    if ((slot >= 0) && (slot < RL_MAX_STATE_CACHE_TEXTURE_SLOTS) && (RLGL.StateCache.cubemapId[slot] == id)) RLGL.StateCache.stats.callsSkipped++;
+    else
+    {
+        glBindTexture(GL_TEXTURE_CUBE_MAP, id);
+        rlSetStateCacheTexture(GL_TEXTURE_CUBE_MAP, id);
+        RLGL.StateCache.stats.callsIssued++;
+    }
 #endif
 }
 
@@ -1690,7 +1838,29 @@ void rlEnableTextureCubemap(unsigned int id)
 void rlDisableTextureCubemap(void)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glBindTexture(GL_TEXTURE_CUBE_MAP, 0);
+    rlEnableTextureCubemap(0);
+#endif
+}
+
+// Disable textures for a range of slots
+// NOTE: Only slots with textures bound (or unknown to state cache) are selected and unbound
+void rlDisableTextureSlots(int slot, int count)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    for (int i = slot; (i < slot + count) && (i < RL_MAX_STATE_CACHE_TEXTURE_SLOTS); i++)
+    {
+        if (RLGL.StateCache.textureId[i] != 0)
+        {
+            rlActiveTextureSlot(i);
+            rlDisableTexture();
+        }
+
+        if (RLGL.StateCache.cubemapId[i] != 0)
+        {
+            rlActiveTextureSlot(i);
+            rlDisableTextureCubemap();
+        }
+    }
 #endif
 }
 
@@ -1740,6 +1910,7 @@ void rlTextureParameters(unsigned int id, int param, int value)
     }
 
     glBindTexture(GL_TEXTURE_2D, 0);
+    rlSetStateCacheTexture(GL_TEXTURE_2D, 0);
 }
 
 // Set cubemap parameters (wrap mode/filter mode)
@@ -1783,6 +1954,7 @@ void rlCubemapParameters(unsigned int id, int param, int value)
     }
 
     glBindTexture(GL_TEXTURE_CUBE_MAP, 0);
+    rlSetStateCacheTexture(GL_TEXTURE_CUBE_MAP, 0);
 #endif
 }
 
@@ -1790,7 +1962,13 @@ void rlCubemapParameters(unsigned int id, int param, int value)
 void rlEnableShader(unsigned int id)
 {
 #if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2))
-    glUseProgram(id);
+    if (RLGL.StateCache.shaderId != id)
+    {
+        glUseProgram(id);
+        RLGL.StateCache.shaderId = id;
+        RLGL.StateCache.stats.callsIssued++;
+    }
+    else RLGL.StateCache.stats.callsSkipped++;
 #endif
 }
 
@@ -1798,7 +1976,7 @@ void rlEnableShader(unsigned int id)
 void rlDisableShader(void)
 {
 #if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2))
-    glUseProgram(0);
+    rlEnableShader(0);
 #endif
 }
 
@@ -2228,6 +2406,9 @@ void rlglInit(int width, int height)
 #endif
 
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // Init GL state cache, nothing assumed to be bound
+    rlResetStateCache();
+
     // Init default white texture
     unsigned char pixels[4] = { 255, 255, 255, 255 };   // 1 pixel RGBA (4 bytes)
     RLGL.State.defaultTextureId = rlLoadTexture(pixels, 1, 1, RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, 1);
@@ -2641,6 +2822,48 @@ int rlGetFramebufferHeight(void)
     return height;
 }
 
+// Reset GL state cache
+// NOTE: Required if OpenGL state (program, textures, vao, uniforms) is changed without using rlgl,
+// next rlgl calls will be issued without checking previous state
+void rlResetStateCache(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.StateCache.shaderId = RL_STATE_CACHE_UNKNOWN;
+    RLGL.StateCache.textureSlot = -1;
+    RLGL.StateCache.vaoId = RL_STATE_CACHE_UNKNOWN;
+
+    for (int i = 0; i < RL_MAX_STATE_CACHE_TEXTURE_SLOTS; i++)
+    {
+        RLGL.StateCache.textureId[i] = RL_STATE_CACHE_UNKNOWN;
+        RLGL.StateCache.cubemapId[i] = RL_STATE_CACHE_UNKNOWN;
+    }
+
+    rlResetStateCacheUniforms(0);
+#endif
+}
+
+// Get render stats for last completed frame
+rlRenderStats rlGetRenderStats(void)
+{
+    rlRenderStats stats = { 0 };
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    stats = RLGL.StateCache.lastStats;
+#endif
+    return stats;
+}
+
+// Reset render stats, current frame stats are stored as last completed frame
+// NOTE: Called once per frame by raylib on EndDrawing()
+void rlResetRenderStats(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.StateCache.lastStats = RLGL.StateCache.stats;
+    RLGL.StateCache.stats.drawCalls = 0;
+    RLGL.StateCache.stats.callsIssued = 0;
+    RLGL.StateCache.stats.callsSkipped = 0;
+#endif
+}
+
 // Get default internal texture (white texture)
 // NOTE: Default texture is a 1x1 pixel UNCOMPRESSED_R8G8B8A8
 unsigned int rlGetTextureIdDefault(void)
@@ -2733,7 +2956,7 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
         {
             // Initialize Quads VAO
             glGenVertexArrays(1, &batch.vertexBuffer[i].vaoId);
-            glBindVertexArray(batch.vertexBuffer[i].vaoId);
+            rlEnableVertexArray(batch.vertexBuffer[i].vaoId);
         }
 
         // Quads - Vertex buffers binding and attributes enable
@@ -2779,7 +3002,7 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
     TRACELOG(RL_LOG_INFO, "RLGL: Render batch vertex buffers loaded successfully in VRAM (GPU)");
 
     // Unbind the current VAO
-    if (RLGL.ExtSupported.vao) glBindVertexArray(0);
+    rlDisableVertexArray();
     //--------------------------------------------------------------------------------------------
 
     // Init draw calls tracking system
@@ -2821,12 +3044,12 @@ void rlUnloadRenderBatch(rlRenderBatch batch)
         // Unbind VAO attribs data
         if (RLGL.ExtSupported.vao)
         {
-            glBindVertexArray(batch.vertexBuffer[i].vaoId);
+            rlEnableVertexArray(batch.vertexBuffer[i].vaoId);
             glDisableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION);
             glDisableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD);
             glDisableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL);
             glDisableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_COLOR);
-            glBindVertexArray(0);
+            rlDisableVertexArray();
         }
 
         // Delete VBOs from GPU (VRAM)
@@ -2865,7 +3088,7 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
     if (RLGL.State.vertexCounter > 0)
     {
         // Activate elements VAO
-        if (RLGL.ExtSupported.vao) glBindVertexArray(batch->vertexBuffer[batch->currentBuffer].vaoId);
+        rlEnableVertexArray(batch->vertexBuffer[batch->currentBuffer].vaoId);
 
         // Vertex positions buffer
         glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[0]);
@@ -2903,7 +3126,7 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
         // glUnmapBuffer(GL_ARRAY_BUFFER);
 
         // Unbind the current VAO
-        if (RLGL.ExtSupported.vao) glBindVertexArray(0);
+        rlDisableVertexArray();
     }
     //------------------------------------------------------------------------------------------------------------
 
@@ -2932,7 +3155,10 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
         if (RLGL.State.vertexCounter > 0)
         {
             // Set current shader and upload current MVP matrix
-            glUseProgram(RLGL.State.currentShaderId);
+            rlEnableShader(RLGL.State.currentShaderId);
+
+            // Matrices and default values are uploaded directly, not registered by state cache
+            rlResetStateCacheUniforms(RLGL.State.currentShaderId);
 
             // Create modelview-projection matrix and upload to shader
             Matrix matMVP = rlMatrixMultiply(RLGL.State.modelview, RLGL.State.projection);
@@ -2961,8 +3187,7 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
                 glUniformMatrix4fv(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_NORMAL], 1, false, rlMatrixToFloat(rlMatrixTranspose(rlMatrixInvert(RLGL.State.transform))));
             }
 
-            if (RLGL.ExtSupported.vao) glBindVertexArray(batch->vertexBuffer[batch->currentBuffer].vaoId);
-            else
+            if (!rlEnableVertexArray(batch->vertexBuffer[batch->currentBuffer].vaoId))
             {
                 // Bind vertex attrib: position (shader-location = 0)
                 glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[0]);
@@ -2997,19 +3222,19 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
             {
                 if (RLGL.State.activeTextureId[i] > 0)
                 {
-                    glActiveTexture(GL_TEXTURE0 + 1 + i);
-                    glBindTexture(GL_TEXTURE_2D, RLGL.State.activeTextureId[i]);
+                    rlActiveTextureSlot(1 + i);
+                    rlEnableTexture(RLGL.State.activeTextureId[i]);
                 }
             }
 
             // Activate default sampler2D texture0 (one texture is always active for default batch shader)
             // NOTE: Batch system accumulates calls by texture0 changes, additional textures are enabled for all the draw calls
-            glActiveTexture(GL_TEXTURE0);
+            rlActiveTextureSlot(0);
 
             for (int i = 0, vertexOffset = 0; i < batch->drawCounter; i++)
             {
                 // Bind current draw call texture, activated as GL_TEXTURE0 and Bound to sampler2D texture0 by default
-                glBindTexture(GL_TEXTURE_2D, batch->draws[i].textureId);
+                rlEnableTexture(batch->draws[i].textureId);
 
                 if ((batch->draws[i].mode == RL_LINES) || (batch->draws[i].mode == RL_TRIANGLES)) glDrawArrays(batch->draws[i].mode, vertexOffset, batch->draws[i].vertexCount);
                 else
@@ -3025,6 +3250,8 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
 #endif
                 }
 
+                RLGL.StateCache.stats.drawCalls++;
+
                 vertexOffset += (batch->draws[i].vertexCount + batch->draws[i].vertexAlignment);
             }
 
@@ -3034,12 +3261,12 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
                 glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
             }
 
-            glBindTexture(GL_TEXTURE_2D, 0);    // Unbind textures
+            rlDisableTexture();     // Unbind textures
         }
 
-        if (RLGL.ExtSupported.vao) glBindVertexArray(0); // Unbind VAO
+        rlDisableVertexArray(); // Unbind VAO
 
-        glUseProgram(0);    // Unbind shader program
+        rlDisableShader();      // Unbind shader program
     }
 
     // Restore viewport to default measures
@@ -3273,6 +3500,7 @@ unsigned int rlLoadTexture(const void *data, int width, int height, int format,
 
     // Unbind current texture
     glBindTexture(GL_TEXTURE_2D, 0);
+    rlSetStateCacheTexture(GL_TEXTURE_2D, 0);
 
     if (id > 0) TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Texture loaded successfully (%ix%i | %s | %i mipmaps)", id, width, height, rlGetPixelFormatName(format), mipmapCount);
     else TRACELOG(RL_LOG_WARNING, "TEXTURE: Failed to load texture");
@@ -3317,6 +3545,7 @@ unsigned int rlLoadTextureDepth(int width, int height, bool useRenderBuffer)
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
 
         glBindTexture(GL_TEXTURE_2D, 0);
+        rlSetStateCacheTexture(GL_TEXTURE_2D, 0);
 
         TRACELOG(RL_LOG_INFO, "TEXTURE: Depth texture loaded successfully");
     }
@@ -3404,6 +3633,7 @@ unsigned int rlLoadTextureCubemap(const void *data, int size, int format)
 #endif
 
     glBindTexture(GL_TEXTURE_CUBE_MAP, 0);
+    rlSetStateCacheTexture(GL_TEXTURE_CUBE_MAP, 0);
 #endif
 
     if (id > 0) TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Cubemap texture loaded successfully (%ix%i)", id, size, size);
@@ -3417,6 +3647,7 @@ unsigned int rlLoadTextureCubemap(const void *data, int size, int format)
 void rlUpdateTexture(unsigned int id, int offsetX, int offsetY, int width, int height, int format, const void *data)
 {
     glBindTexture(GL_TEXTURE_2D, id);
+    rlSetStateCacheTexture(GL_TEXTURE_2D, id);
 
     unsigned int glInternalFormat, glFormat, glType;
     rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
@@ -3505,6 +3736,15 @@ void rlGetGlTextureFormats(int format, unsigned int *glInternalFormat, unsigned
 void rlUnloadTexture(unsigned int id)
 {
     glDeleteTextures(1, &id);
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // NOTE: Deleted textures are unbound from all slots
+    for (int i = 0; i < RL_MAX_STATE_CACHE_TEXTURE_SLOTS; i++)
+    {
+        if (RLGL.StateCache.textureId[i] == id) RLGL.StateCache.textureId[i] = 0;
+        if (RLGL.StateCache.cubemapId[i] == id) RLGL.StateCache.cubemapId[i] = 0;
+    }
+#endif
 }
 
 // Generate mipmap data for selected texture
@@ -3534,6 +3774,7 @@ void rlGenTextureMipmaps(unsigned int id, int width, int height, int format, int
     else TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Failed to generate mipmaps", id);
 
     glBindTexture(GL_TEXTURE_2D, 0);
+    rlSetStateCacheTexture(GL_TEXTURE_2D, 0);
 #else
     TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] GPU mipmap generation not supported", id);
 #endif
@@ -3572,6 +3813,7 @@ void *rlReadTexturePixels(unsigned int id, int width, int height, int format)
     else TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Data retrieval not suported for pixel format (%i)", id, format);
 
     glBindTexture(GL_TEXTURE_2D, 0);
+    rlSetStateCacheTexture(GL_TEXTURE_2D, 0);
 #endif
 
 #if defined(GRAPHICS_API_OPENGL_ES2)
@@ -3586,6 +3828,7 @@ void *rlReadTexturePixels(unsigned int id, int width, int height, int format)
 
     glBindFramebuffer(GL_FRAMEBUFFER, fboId);
     glBindTexture(GL_TEXTURE_2D, 0);
+    rlSetStateCacheTexture(GL_TEXTURE_2D, 0);
 
     // Attach our texture to FBO
     glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, id, 0);
@@ -3739,7 +3982,7 @@ void rlUnloadFramebuffer(unsigned int id)
 
     unsigned int depthIdU = (unsigned int)depthId;
     if (depthType == GL_RENDERBUFFER) glDeleteRenderbuffers(1, &depthIdU);
-    else if (depthType == GL_TEXTURE) glDeleteTextures(1, &depthIdU);
+    else if (depthType == GL_TEXTURE) rlUnloadTexture(depthIdU);
 
     // NOTE: If a texture object is deleted while its image is attached to the *currently bound* framebuffer,
     // the texture image is automatically detached from the currently bound framebuffer.
@@ -3840,7 +4083,14 @@ bool rlEnableVertexArray(unsigned int vaoId)
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     if (RLGL.ExtSupported.vao)
     {
-        glBindVertexArray(vaoId);
+        if (RLGL.StateCache.vaoId != vaoId)
+        {
+            glBindVertexArray(vaoId);
+            RLGL.StateCache.vaoId = vaoId;
+            RLGL.StateCache.stats.callsIssued++;
+        }
+        else RLGL.StateCache.stats.callsSkipped++;
+
         result = true;
     }
 #endif
@@ -3851,7 +4101,7 @@ bool rlEnableVertexArray(unsigned int vaoId)
 void rlDisableVertexArray(void)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    if (RLGL.ExtSupported.vao) glBindVertexArray(0);
+    rlEnableVertexArray(0);
 #endif
 }
 
@@ -3875,6 +4125,9 @@ void rlDisableVertexAttribute(unsigned int index)
 void rlDrawVertexArray(int offset, int count)
 {
     glDrawArrays(GL_TRIANGLES, offset, count);
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.StateCache.stats.drawCalls++;
+#endif
 }
 
 // Draw vertex array elements
@@ -3885,6 +4138,9 @@ void rlDrawVertexArrayElements(int offset, int count, const void *buffer)
     if (offset > 0) bufferPtr += offset;
 
     glDrawElements(GL_TRIANGLES, count, GL_UNSIGNED_SHORT, (const unsigned short *)bufferPtr);
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.StateCache.stats.drawCalls++;
+#endif
 }
 
 // Draw vertex array instanced
@@ -3892,6 +4148,7 @@ void rlDrawVertexArrayInstanced(int offset, int count, int instances)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     glDrawArraysInstanced(GL_TRIANGLES, 0, count, instances);
+    RLGL.StateCache.stats.drawCalls++;
 #endif
 }
 
@@ -3904,6 +4161,7 @@ void rlDrawVertexArrayElementsInstanced(int offset, int count, const void *buffe
     if (offset > 0) bufferPtr += offset;
 
     glDrawElementsInstanced(GL_TRIANGLES, count, GL_UNSIGNED_SHORT, (const unsigned short *)bufferPtr, instances);
+    RLGL.StateCache.stats.drawCalls++;
 #endif
 }
 
@@ -3971,7 +4229,7 @@ void rlUnloadVertexArray(unsigned int vaoId)
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     if (RLGL.ExtSupported.vao)
     {
-        glBindVertexArray(0);
+        rlDisableVertexArray();
         glDeleteVertexArrays(1, &vaoId);
         TRACELOG(RL_LOG_INFO, "VAO: [ID %i] Unloaded vertex array data from VRAM (GPU)", vaoId);
     }
@@ -4184,6 +4442,9 @@ unsigned int rlLoadShaderProgram(unsigned int vShaderId, unsigned int fShaderId)
         //GLint binarySize = 0;
         //glGetProgramiv(id, GL_PROGRAM_BINARY_LENGTH, &binarySize);
 
+        // NOTE: Program ids could be reused, make sure no previous uniform values are registered
+        rlResetStateCacheUniforms(program);
+
         TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Program shader loaded successfully", program);
     }
 #endif
@@ -4196,6 +4457,10 @@ void rlUnloadShaderProgram(unsigned int id)
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     glDeleteProgram(id);
 
+    // NOTE: A program deleted while in use is kept bound until a new one is enabled
+    rlResetStateCacheUniforms(id);
+    if (RLGL.StateCache.shaderId == id) RLGL.StateCache.shaderId = RL_STATE_CACHE_UNKNOWN;
+
     TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Unloaded shader program data from VRAM (GPU)", id);
 #endif
 }
@@ -4230,6 +4495,29 @@ int rlGetLocationAttrib(unsigned int shaderId, const char *attribName)
 void rlSetUniform(int locIndex, const void *value, int uniformType, int count)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // Check if same value has already been uploaded to current shader
+    // NOTE: All supported uniform types use 4 bytes per component
+    int size = 0;
+    switch (uniformType)
+    {
+        case RL_SHADER_UNIFORM_FLOAT:
+        case RL_SHADER_UNIFORM_INT:
+        case RL_SHADER_UNIFORM_UINT:
+        case RL_SHADER_UNIFORM_SAMPLER2D: size = 4*count; break;
+        case RL_SHADER_UNIFORM_VEC2:
+        case RL_SHADER_UNIFORM_IVEC2:
+        case RL_SHADER_UNIFORM_UIVEC2: size = 8*count; break;
+        case RL_SHADER_UNIFORM_VEC3:
+        case RL_SHADER_UNIFORM_IVEC3:
+        case RL_SHADER_UNIFORM_UIVEC3: size = 12*count; break;
+        case RL_SHADER_UNIFORM_VEC4:
+        case RL_SHADER_UNIFORM_IVEC4:
+        case RL_SHADER_UNIFORM_UIVEC4: size = 16*count; break;
+        default: break;
+    }
+
+    if ((size > 0) && rlCheckStateCacheUniform(locIndex, value, size)) return;
+
     switch (uniformType)
     {
         case RL_SHADER_UNIFORM_FLOAT: glUniform1fv(locIndex, count, (float *)value); break;
@@ -4279,6 +4567,9 @@ void rlSetUniformMatrix(int locIndex, Matrix mat)
         mat.m8, mat.m9, mat.m10, mat.m11,
         mat.m12, mat.m13, mat.m14, mat.m15
     };
+
+    if (rlCheckStateCacheUniform(locIndex, matfloat, sizeof(matfloat))) return;
+
     glUniformMatrix4fv(locIndex, 1, false, matfloat);
 #endif
 }
@@ -4292,7 +4583,8 @@ void rlSetUniformSampler(int locIndex, unsigned int textureId)
     {
         if (RLGL.State.activeTextureId[i] == textureId)
         {
-            glUniform1i(locIndex, 1 + i);
+            int slot = 1 + i;
+            if (!rlCheckStateCacheUniform(locIndex, &slot, sizeof(int))) glUniform1i(locIndex, slot);
             return;
         }
     }
@@ -4303,7 +4595,8 @@ void rlSetUniformSampler(int locIndex, unsigned int textureId)
     {
         if (RLGL.State.activeTextureId[i] == 0)
         {
-            glUniform1i(locIndex, 1 + i);              // Activate new texture unit
+            int slot = 1 + i;
+            if (!rlCheckStateCacheUniform(locIndex, &slot, sizeof(int))) glUniform1i(locIndex, slot); // Activate new texture unit
             RLGL.State.activeTextureId[i] = textureId; // Save texture id for binding on drawing
             break;
         }
@@ -4366,6 +4659,8 @@ unsigned int rlLoadComputeShaderProgram(unsigned int shaderId)
         //GLint binarySize = 0;
         //glGetProgramiv(id, GL_PROGRAM_BINARY_LENGTH, &binarySize);
 
+        rlResetStateCacheUniforms(program);
+
         TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Compute shader program loaded successfully", program);
     }
 #else
@@ -4619,7 +4914,7 @@ void rlLoadDrawQuad(void)
 
     // Gen VAO to contain VBO
     glGenVertexArrays(1, &quadVAO);
-    glBindVertexArray(quadVAO);
+    rlEnableVertexArray(quadVAO);
 
     // Gen and fill vertex buffer (VBO)
     glGenBuffers(1, &quadVBO);
@@ -4633,9 +4928,10 @@ void rlLoadDrawQuad(void)
     glVertexAttribPointer(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD, 2, GL_FLOAT, GL_FALSE, 5*sizeof(float), (void *)(3*sizeof(float))); // Texcoords
 
     // Draw quad
-    glBindVertexArray(quadVAO);
+    rlEnableVertexArray(quadVAO);
     glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
-    glBindVertexArray(0);
+    RLGL.StateCache.stats.drawCalls++;
+    rlDisableVertexArray();
 
     // Delete buffers (VBO and VAO)
     glDeleteBuffers(1, &quadVBO);
@@ -4692,7 +4988,7 @@ void rlLoadDrawCube(void)
 
     // Gen VAO to contain VBO
     glGenVertexArrays(1, &cubeVAO);
-    glBindVertexArray(cubeVAO);
+    rlEnableVertexArray(cubeVAO);
 
     // Gen and fill vertex buffer (VBO)
     glGenBuffers(1, &cubeVBO);
@@ -4700,7 +4996,7 @@ void rlLoadDrawCube(void)
     glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
 
     // Bind vertex attributes (position, normals, texcoords)
-    glBindVertexArray(cubeVAO);
+    rlEnableVertexArray(cubeVAO);
     glEnableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION);
     glVertexAttribPointer(RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION, 3, GL_FLOAT, GL_FALSE, 8*sizeof(float), (void *)0); // Positions
     glEnableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL);
@@ -4708,12 +5004,13 @@ void rlLoadDrawCube(void)
     glEnableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD);
     glVertexAttribPointer(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD, 2, GL_FLOAT, GL_FALSE, 8*sizeof(float), (void *)(6*sizeof(float))); // Texcoords
     glBindBuffer(GL_ARRAY_BUFFER, 0);
-    glBindVertexArray(0);
+    rlDisableVertexArray();
 
     // Draw cube
-    glBindVertexArray(cubeVAO);
+    rlEnableVertexArray(cubeVAO);
     glDrawArrays(GL_TRIANGLES, 0, 36);
-    glBindVertexArray(0);
+    RLGL.StateCache.stats.drawCalls++;
+    rlDisableVertexArray();
 
     // Delete VBO and VAO
     glDeleteBuffers(1, &cubeVBO);
@@ -4894,7 +5191,7 @@ static void rlLoadShaderDefault(void)
 // NOTE: Unloads: RLGL.State.defaultShaderId, RLGL.State.defaultShaderLocs
 static void rlUnloadShaderDefault(void)
 {
-    glUseProgram(0);
+    rlDisableShader();
 
     glDetachShader(RLGL.State.defaultShaderId, RLGL.State.defaultVShaderId);
     glDetachShader(RLGL.State.defaultShaderId, RLGL.State.defaultFShaderId);
@@ -4902,12 +5199,53 @@ static void rlUnloadShaderDefault(void)
     glDeleteShader(RLGL.State.defaultFShaderId);
 
     glDeleteProgram(RLGL.State.defaultShaderId);
+    rlResetStateCacheUniforms(RLGL.State.defaultShaderId);
 
     RL_FREE(RLGL.State.defaultShaderLocs);
 
     TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Default shader unloaded successfully", RLGL.State.defaultShaderId);
 }
 
+// Check uniform value already uploaded to current shader location, register it otherwise
+// NOTE: Only values up to a matrix 4x4 (64 bytes) are tracked, one entry per hashed shader/location
+static bool rlCheckStateCacheUniform(int locIndex, const void *value, int size)
+{
+    unsigned int shaderId = RLGL.StateCache.shaderId;
+
+    if ((locIndex < 0) || (size > (int)sizeof(RLGL.StateCache.uniforms[0].value)) ||
+        (shaderId == 0) || (shaderId == RL_STATE_CACHE_UNKNOWN))
+    {
+        RLGL.StateCache.stats.callsIssued++;
+        return false;
+    }
+
+    rlUniformCacheEntry *entry = &RLGL.StateCache.uniforms[(shaderId*31 + (unsigned int)locIndex)&(RL_MAX_STATE_CACHE_UNIFORMS - 1)];
+
+    if ((entry->shaderId == shaderId) && (entry->locIndex == locIndex) &&
+        (entry->size == size) && (memcmp(entry->value, value, size) == 0))
+    {
+        RLGL.StateCache.stats.callsSkipped++;
+        return true;
+    }
+
+    entry->shaderId = shaderId;
+    entry->locIndex = locIndex;
+    entry->size = size;
+    memcpy(entry->value, value, size);
+
+    RLGL.StateCache.stats.callsIssued++;
+    return false;
+}
+
+// Reset uniform values registered for a shader (0 for all shaders)
+static void rlResetStateCacheUniforms(unsigned int shaderId)
+{
+    for (int i = 0; i < RL_MAX_STATE_CACHE_UNIFORMS; i++)
+    {
+        if ((shaderId == 0) || (RLGL.StateCache.uniforms[i].shaderId == shaderId)) RLGL.StateCache.uniforms[i].shaderId = 0;
+    }
+}
+
 #if defined(RLGL_SHOW_GL_DETAILS_INFO)
 // Get compressed format official GL identifier name
 static const char *rlGetCompressedFormatName(int format)
@@ -4986,6 +5324,21 @@ static const char *rlGetCompressedFormatName(int format)
 
 #endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
 
+// Register texture bound on active slot into state cache
+// NOTE: Required after any direct glBindTexture() call (textures loading/update)
+static void rlSetStateCacheTexture(unsigned int target, unsigned int id)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    int slot = RLGL.StateCache.textureSlot;
+
+    if ((slot >= 0) && (slot < RL_MAX_STATE_CACHE_TEXTURE_SLOTS))
+    {
+        if (target == GL_TEXTURE_CUBE_MAP) RLGL.StateCache.cubemapId[slot] = id;
+        else RLGL.StateCache.textureId[slot] = id;
+    }
+#endif
+}
+
 // Get pixel data size in bytes (image or texture)
 // NOTE: Size depends on pixel format
 static int rlGetPixelDataSize(int width, int height, int format)
@@ -132,11 +132,96 @@
 #ifndef MAX_MESH_VERTEX_BUFFERS
     #define MAX_MESH_VERTEX_BUFFERS  7    // Maximum vertex buffers (VBO) per mesh
 #endif
+#ifndef TERRAIN_MAX_TILE_SIZE
+    #define TERRAIN_MAX_TILE_SIZE  128    // Maximum terrain tile size in quads, tile vertex must fit 16 bit indices
+#endif
+#ifndef TERRAIN_MAX_LODS
+    #define TERRAIN_MAX_LODS         6    // Maximum terrain LOD levels
+#endif
+#ifndef TERRAIN_MAX_TILE_LOADS
+    #define TERRAIN_MAX_TILE_LOADS   4    // Maximum terrain tiles loaded by UpdateTerrain() call, avoids frame spikes
+#endif
+
+#define MODEL_BINARY_VERSION         1    // Model binary file format version
+#define MODEL_BINARY_ALIGNMENT      16    // Model binary file blocks alignment in bytes
+#define MODEL_BINARY_MESH_ATTRIBS    9    // Model binary mesh attributes: vertices, texcoords, texcoords2, normals, tangents, colors, indices, boneIds, boneWeights
+#define MODEL_BINARY_MATERIAL_MAPS  12    // Model binary material maps stored, independent of MAX_MATERIAL_MAPS
+#define MODEL_BINARY_ALIGN(offset) (((offset) + MODEL_BINARY_ALIGNMENT - 1) & ~(MODEL_BINARY_ALIGNMENT - 1))
+
+#define CUBICMAP_MAX_CHUNK_SIZE     52    // Maximum cubicmap chunk size, worst case 52*52 cells*24 vertex fits 16 bit indices
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// ...
+#if defined(SUPPORT_MESH_GENERATION)
+// Cubicmap chunk builder, temporary buffers reused for all chunks
+typedef struct CubicmapChunkBuilder {
+    float *vertices;            // Vertex position buffer (worst-case sized)
+    float *texcoords;           // Vertex texcoords buffer (worst-case sized)
+    float *normals;             // Vertex normals buffer (worst-case sized)
+    unsigned short *indices;    // Indices buffer (worst-case sized)
+    unsigned char *merged;      // Chunk cells already merged into a rectangle
+    int vertexCount;            // Current vertex count
+    int indexCount;             // Current index count
+} CubicmapChunkBuilder;
+#endif
+
+// Model binary file header
+// NOTE: All blocks are referenced by offset from file start and aligned to MODEL_BINARY_ALIGNMENT,
+// data is stored in the same layout used by Mesh arrays (little-endian), so it can be copied (or mapped) as is
+typedef struct ModelBinaryHeader {
+    char id[4];                     // File identifier: "rMDB"
+    unsigned int version;           // File format version
+    unsigned int fileSize;          // File size in bytes, used for validation
+    unsigned int meshCount;         // Number of meshes
+    unsigned int materialCount;     // Number of materials
+    unsigned int textureCount;      // Number of textures (shared by materials maps)
+    unsigned int boneCount;         // Number of bones
+    unsigned int animationCount;    // Number of animations
+    unsigned int meshesOffset;      // Meshes descriptors offset (ModelBinaryMesh)
+    unsigned int meshMaterialOffset;    // Mesh material indices offset (int)
+    unsigned int materialsOffset;   // Materials descriptors offset (ModelBinaryMaterial)
+    unsigned int texturesOffset;    // Textures descriptors offset (ModelBinaryTexture)
+    unsigned int bonesOffset;       // Bones offset (BoneInfo)
+    unsigned int bindPoseOffset;    // Bind pose offset (Transform)
+    unsigned int animationsOffset;  // Animations descriptors offset (ModelBinaryAnimation)
+    unsigned int reserved;          // Reserved for future use
+    Matrix transform;               // Model transform
+} ModelBinaryHeader;
+
+// Model binary mesh descriptor
+typedef struct ModelBinaryMesh {
+    int vertexCount;                // Number of vertices
+    int triangleCount;              // Number of triangles
+    unsigned int offsets[MODEL_BINARY_MESH_ATTRIBS];    // Vertex attributes blocks offsets (0 if not available)
+} ModelBinaryMesh;
+
+// Model binary material descriptor
+typedef struct ModelBinaryMaterial {
+    int textures[MODEL_BINARY_MATERIAL_MAPS];   // Maps texture index (-1 for default texture)
+    Color colors[MODEL_BINARY_MATERIAL_MAPS];   // Maps color
+    float values[MODEL_BINARY_MATERIAL_MAPS];   // Maps value
+    float params[4];                            // Material generic parameters
+} ModelBinaryMaterial;
+
+// Model binary texture descriptor
+typedef struct ModelBinaryTexture {
+    int width;                      // Texture width
+    int height;                     // Texture height
+    int mipmaps;                    // Mipmap levels
+    int format;                     // Pixel data format (PixelFormat)
+    unsigned int dataOffset;        // Pixel data offset
+    unsigned int dataSize;          // Pixel data size in bytes (all mipmap levels)
+} ModelBinaryTexture;
+
+// Model binary animation descriptor
+typedef struct ModelBinaryAnimation {
+    char name[32];                  // Animation name
+    int boneCount;                  // Number of bones
+    int frameCount;                 // Number of frames
+    unsigned int bonesOffset;       // Bones offset (BoneInfo)
+    unsigned int posesOffset;       // Frame poses offset (Transform, frameCount*boneCount)
+} ModelBinaryAnimation;
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
@@ -154,7 +239,7 @@ static Model LoadIQM(const char *fileName);     // Load IQM mesh data
 static ModelAnimation *LoadModelAnimationsIQM(const char *fileName, int *animCount);   // Load IQM animation data
 #endif
 #if defined(SUPPORT_FILEFORMAT_GLTF)
-static Model LoadGLTF(const char *fileName);    // Load GLTF mesh data
+static Model LoadGLTF(const char *fileName, ModelScene *scene);   // Load GLTF mesh data, optionally keeping nodes hierarchy and mesh instances
 static ModelAnimation *LoadModelAnimationsGLTF(const char *fileName, int *animCount);  // Load GLTF animation data
 #endif
 #if defined(SUPPORT_FILEFORMAT_VOX)
@@ -167,6 +252,24 @@ static ModelAnimation *LoadModelAnimationsM3D(const char *fileName, int *animCou
 #if defined(SUPPORT_FILEFORMAT_OBJ) || defined(SUPPORT_FILEFORMAT_MTL)
 static void ProcessMaterialsOBJ(Material *rayMaterials, tinyobj_material_t *materials, int materialCount);  // Process obj materials
 #endif
+#if defined(SUPPORT_MESH_GENERATION)
+static unsigned char GetCubicmapCellType(Color color);          // Get cubicmap cell type from pixel color
+static Mesh GenCubicmapChunkMesh(const CubicmapMesh *cubicmap, int chunkX, int chunkZ, CubicmapChunkBuilder *builder);  // Generate one cubicmap chunk mesh
+#endif
+
+static unsigned short *LoadTerrainHeights(Image heightmap);    // Load terrain heights from heightmap as 16 bit normalized values
+static unsigned short *GenTerrainLodIndices(int tileSize, int lod, int *indexCount);   // Generate terrain tile indices for a LOD level
+static int GetTerrainTileVertexCount(int tileSize);             // Get terrain tile vertex count (grid and skirts)
+static float GetTerrainTileDistance(BoundingBox bounds, Vector3 position);    // Get distance from a point to a terrain tile bounds
+static int GetTerrainTileLod(const Terrain *terrain, float distance);        // Get terrain LOD level for a distance
+static void SetTerrainTileLod(const Terrain *terrain, TerrainTile *tile, int lod);     // Set terrain tile LOD level (shared indices)
+static void LoadTerrainTile(Terrain *terrain, int tileX, int tileZ);          // Load terrain tile vertex data and upload it to GPU
+static void UnloadTerrainTile(Terrain *terrain, TerrainTile *tile);           // Unload terrain tile from GPU and CPU memory
+
+static void **GetModelBinaryMeshAttrib(Mesh *mesh, int attrib, unsigned int *size);    // Get mesh attribute data pointer and size (model binary)
+static unsigned int GetModelBinaryImageSize(Image image);       // Get image pixel data size, considering mipmaps (model binary)
+static bool IsModelBinaryValid(const unsigned char *fileData, int dataSize);   // Check model binary file data is valid
+static bool IsModelBinaryBlockValid(const ModelBinaryHeader *header, unsigned int offset, unsigned long long size);   // Check model binary block is aligned and in file data range
 
 //----------------------------------------------------------------------------------
 // Module Functions Definition
@@ -1099,7 +1202,7 @@ Model LoadModel(const char *fileName)
     if (IsFileExtension(fileName, ".iqm")) model = LoadIQM(fileName);
 #endif
 #if defined(SUPPORT_FILEFORMAT_GLTF)
-    if (IsFileExtension(fileName, ".gltf") || IsFileExtension(fileName, ".glb")) model = LoadGLTF(fileName);
+    if (IsFileExtension(fileName, ".gltf") || IsFileExtension(fileName, ".glb")) model = LoadGLTF(fileName, NULL);
 #endif
 #if defined(SUPPORT_FILEFORMAT_VOX)
     if (IsFileExtension(fileName, ".vox")) model = LoadVOX(fileName);
@@ -1233,6 +1336,475 @@ BoundingBox GetModelBoundingBox(Model model)
     return bounds;
 }
 
+// Export model data to binary file (meshes, materials, textures, skeleton and animations)
+// NOTE: Shaders are not exported, materials are loaded with default shader
+// NOTE: Textures pixel data is read back from GPU and stored uncompressed/as-is, no decoding required on load
+bool ExportModelBinary(Model model, const ModelAnimation *animations, int animCount, const char *fileName)
+{
+    bool success = false;
+
+    if ((model.meshCount <= 0) || (model.meshes == NULL)) return success;
+    if (animations == NULL) animCount = 0;
+
+    ModelBinaryHeader header = { 0 };
+    memcpy(header.id, "rMDB", 4);
+    header.version = MODEL_BINARY_VERSION;
+    header.meshCount = model.meshCount;
+    header.materialCount = model.materialCount;
+    header.boneCount = model.boneCount;
+    header.animationCount = animCount;
+    header.transform = model.transform;
+
+    ModelBinaryMesh *meshes = (ModelBinaryMesh *)RL_CALLOC(model.meshCount, sizeof(ModelBinaryMesh));
+    ModelBinaryMaterial *materials = (ModelBinaryMaterial *)RL_CALLOC((model.materialCount > 0)? model.materialCount : 1, sizeof(ModelBinaryMaterial));
+    ModelBinaryAnimation *anims = (ModelBinaryAnimation *)RL_CALLOC((animCount > 0)? animCount : 1, sizeof(ModelBinaryAnimation));
+
+    // Gather textures used by materials maps, shared textures are stored once
+    int maxTextures = model.materialCount*MODEL_BINARY_MATERIAL_MAPS;
+    unsigned int *textureIds = (unsigned int *)RL_CALLOC((maxTextures > 0)? maxTextures : 1, sizeof(unsigned int));
+    Image *images = (Image *)RL_CALLOC((maxTextures > 0)? maxTextures : 1, sizeof(Image));
+    ModelBinaryTexture *textures = (ModelBinaryTexture *)RL_CALLOC((maxTextures > 0)? maxTextures : 1, sizeof(ModelBinaryTexture));
+
+    for (int m = 0; m < model.materialCount; m++)
+    {
+        for (int i = 0; i < MODEL_BINARY_MATERIAL_MAPS; i++)
+        {
+            materials[m].textures[i] = -1;
+            if ((model.materials[m].maps == NULL) || (i >= MAX_MATERIAL_MAPS)) continue;
+
+            MaterialMap map = model.materials[m].maps[i];
+            materials[m].colors[i] = map.color;
+            materials[m].values[i] = map.value;
+
+            if ((map.texture.id == 0) || (map.texture.id == rlGetTextureIdDefault())) continue;
+
+            int index = -1;
+            for (unsigned int t = 0; t < header.textureCount; t++)
+            {
+                if (textureIds[t] == map.texture.id) { index = t; break; }
+            }
+
+            if (index == -1)
+            {
+                Image image = LoadImageFromTexture(map.texture);
+                if (image.data == NULL) continue;
+
+                index = header.textureCount;
+                textureIds[index] = map.texture.id;
+                images[index] = image;
+                textures[index].width = image.width;
+                textures[index].height = image.height;
+                textures[index].mipmaps = image.mipmaps;
+                textures[index].format = image.format;
+                textures[index].dataSize = GetModelBinaryImageSize(image);
+                header.textureCount++;
+            }
+
+            materials[m].textures[i] = index;
+        }
+
+        for (int p = 0; p < 4; p++) materials[m].params[p] = model.materials[m].params[p];
+    }
+
+    // Compute blocks layout, every block aligned
+    unsigned int offset = MODEL_BINARY_ALIGN(sizeof(ModelBinaryHeader));
+    header.meshesOffset = offset;
+    offset = MODEL_BINARY_ALIGN(offset + model.meshCount*sizeof(ModelBinaryMesh));
+    header.meshMaterialOffset = offset;
+    offset = MODEL_BINARY_ALIGN(offset + model.meshCount*sizeof(int));
+    header.materialsOffset = offset;
+    offset = MODEL_BINARY_ALIGN(offset + header.materialCount*sizeof(ModelBinaryMaterial));
+    header.texturesOffset = offset;
+    offset = MODEL_BINARY_ALIGN(offset + header.textureCount*sizeof(ModelBinaryTexture));
+    header.bonesOffset = offset;
+    offset = MODEL_BINARY_ALIGN(offset + header.boneCount*sizeof(BoneInfo));
+    header.bindPoseOffset = offset;
+    offset = MODEL_BINARY_ALIGN(offset + header.boneCount*sizeof(Transform));
+    header.animationsOffset = offset;
+    offset = MODEL_BINARY_ALIGN(offset + animCount*sizeof(ModelBinaryAnimation));
+
+    for (int m = 0; m < model.meshCount; m++)
+    {
+        meshes[m].vertexCount = model.meshes[m].vertexCount;
+        meshes[m].triangleCount = model.meshes[m].triangleCount;
+
+        for (int a = 0; a < MODEL_BINARY_MESH_ATTRIBS; a++)
+        {
+            unsigned int size = 0;
+            void **data = GetModelBinaryMeshAttrib(&model.meshes[m], a, &size);
+
+            if (*data != NULL)
+            {
+                meshes[m].offsets[a] = offset;
+                offset = MODEL_BINARY_ALIGN(offset + size);
+            }
+        }
+    }
+
+    for (unsigned int t = 0; t < header.textureCount; t++)
+    {
+        textures[t].dataOffset = offset;
+        offset = MODEL_BINARY_ALIGN(offset + textures[t].dataSize);
+    }
+
+    for (int a = 0; a < animCount; a++)
+    {
+        strncpy(anims[a].name, animations[a].name, sizeof(anims[a].name) - 1);
+        anims[a].boneCount = animations[a].boneCount;
+        anims[a].frameCount = animations[a].frameCount;
+        anims[a].bonesOffset = offset;
+        offset = MODEL_BINARY_ALIGN(offset + anims[a].boneCount*sizeof(BoneInfo));
+        anims[a].posesOffset = offset;
+        offset = MODEL_BINARY_ALIGN(offset + anims[a].frameCount*anims[a].boneCount*sizeof(Transform));
+    }
+
+    header.fileSize = offset;
+
+    // Copy all blocks into file data
+    unsigned char *fileData = (unsigned char *)RL_CALLOC(header.fileSize, 1);
+
+    memcpy(fileData, &header, sizeof(ModelBinaryHeader));
+    memcpy(fileData + header.meshesOffset, meshes, model.meshCount*sizeof(ModelBinaryMesh));
+    if (model.meshMaterial != NULL) memcpy(fileData + header.meshMaterialOffset, model.meshMaterial, model.meshCount*sizeof(int));
+    memcpy(fileData + header.materialsOffset, materials, header.materialCount*sizeof(ModelBinaryMaterial));
+    memcpy(fileData + header.texturesOffset, textures, header.textureCount*sizeof(ModelBinaryTexture));
+    if (model.bones != NULL) memcpy(fileData + header.bonesOffset, model.bones, header.boneCount*sizeof(BoneInfo));
+    if (model.bindPose != NULL) memcpy(fileData + header.bindPoseOffset, model.bindPose, header.boneCount*sizeof(Transform));
+    memcpy(fileData + header.animationsOffset, anims, animCount*sizeof(ModelBinaryAnimation));
+
+    for (int m = 0; m < model.meshCount; m++)
+    {
+        for (int a = 0; a < MODEL_BINARY_MESH_ATTRIBS; a++)
+        {
+            unsigned int size = 0;
+            void **data = GetModelBinaryMeshAttrib(&model.meshes[m], a, &size);
+
+            if (*data != NULL) memcpy(fileData + meshes[m].offsets[a], *data, size);
+        }
+    }
+
+    for (unsigned int t = 0; t < header.textureCount; t++) memcpy(fileData + textures[t].dataOffset, images[t].data, textures[t].dataSize);
+
+    for (int a = 0; a < animCount; a++)
+    {
+        if (animations[a].bones != NULL) memcpy(fileData + anims[a].bonesOffset, animations[a].bones, anims[a].boneCount*sizeof(BoneInfo));
+
+        // NOTE: Frame poses are stored contiguous, frame by frame
+        for (int f = 0; f < anims[a].frameCount; f++)
+        {
+            memcpy(fileData + anims[a].posesOffset + f*anims[a].boneCount*sizeof(Transform), animations[a].framePoses[f], anims[a].boneCount*sizeof(Transform));
+        }
+    }
+
+    success = SaveFileData(fileName, fileData, header.fileSize);
+
+    RL_FREE(fileData);
+    for (unsigned int t = 0; t < header.textureCount; t++) UnloadImage(images[t]);
+    RL_FREE(images);
+    RL_FREE(textureIds);
+    RL_FREE(textures);
+    RL_FREE(anims);
+    RL_FREE(materials);
+    RL_FREE(meshes);
+
+    if (success) TRACELOG(LOG_INFO, "FILEIO: [%s] Model binary exported successfully", fileName);
+    else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to export model binary", fileName);
+
+    return success;
+}
+
+// Load model from binary file (exported with ExportModelBinary())
+// NOTE: Vertex data blocks are copied directly into mesh arrays and uploaded to GPU, no parsing required
+Model LoadModelBinary(const char *fileName)
+{
+    Model model = { 0 };
+
+    int dataSize = 0;
+    unsigned char *fileData = LoadFileData(fileName, &dataSize);
+
+    if (!IsModelBinaryValid(fileData, dataSize))
+    {
+        TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to load model binary, invalid file", fileName);
+        UnloadFileData(fileData);
+        return model;
+    }
+
+    ModelBinaryHeader *header = (ModelBinaryHeader *)fileData;
+
+    model.transform = header->transform;
+
+    // Load meshes
+    model.meshCount = header->meshCount;
+    model.meshes = (Mesh *)RL_CALLOC(model.meshCount, sizeof(Mesh));
+    model.meshMaterial = (int *)RL_CALLOC(model.meshCount, sizeof(int));
+    memcpy(model.meshMaterial, fileData + header->meshMaterialOffset, model.meshCount*sizeof(int));
+
+    ModelBinaryMesh *meshes = (ModelBinaryMesh *)(fileData + header->meshesOffset);
+
+    for (int m = 0; m < model.meshCount; m++)
+    {
+        Mesh *mesh = &model.meshes[m];
+        mesh->vertexCount = meshes[m].vertexCount;
+        mesh->triangleCount = meshes[m].triangleCount;
+
+        for (int a = 0; a < MODEL_BINARY_MESH_ATTRIBS; a++)
+        {
+            if (meshes[m].offsets[a] == 0) continue;
+
+            // NOTE: Attributes blocks range already checked by IsModelBinaryValid()
+            unsigned int size = 0;
+            void **data = GetModelBinaryMeshAttrib(mesh, a, &size);
+
+            *data = RL_MALLOC(size);
+            memcpy(*data, fileData + meshes[m].offsets[a], size);
+        }
+
+        // Animated vertex data is initialized with base pose, required by UpdateModelAnimation()
+        if ((mesh->boneIds != NULL) && (mesh->boneWeights != NULL))
+        {
+            mesh->animVertices = (float *)RL_MALLOC(mesh->vertexCount*3*sizeof(float));
+            memcpy(mesh->animVertices, mesh->vertices, mesh->vertexCount*3*sizeof(float));
+
+            if (mesh->normals != NULL)
+            {
+                mesh->animNormals = (float *)RL_MALLOC(mesh->vertexCount*3*sizeof(float));
+                memcpy(mesh->animNormals, mesh->normals, mesh->vertexCount*3*sizeof(float));
+            }
+        }
+
+        // Upload vertex data to GPU (static mesh)
+        UploadMesh(mesh, false);
+    }
+
+    // Load textures, pixel data is uploaded directly from file data
+    ModelBinaryTexture *textures = (ModelBinaryTexture *)(fileData + header->texturesOffset);
+    Texture2D *loadedTextures = (Texture2D *)RL_CALLOC((header->textureCount > 0)? header->textureCount : 1, sizeof(Texture2D));
+
+    for (unsigned int t = 0; t < header->textureCount; t++)
+    {
+        Image image = { 0 };
+        image.data = fileData + textures[t].dataOffset;
+        image.width = textures[t].width;
+        image.height = textures[t].height;
+        image.mipmaps = textures[t].mipmaps;
+        image.format = textures[t].format;
+
+        loadedTextures[t] = LoadTextureFromImage(image);
+    }
+
+    // Load materials (default shader)
+    ModelBinaryMaterial *materials = (ModelBinaryMaterial *)(fileData + header->materialsOffset);
+    model.materialCount = header->materialCount;
+
+    if (model.materialCount > 0)
+    {
+        model.materials = (Material *)RL_CALLOC(model.materialCount, sizeof(Material));
+
+        for (int m = 0; m < model.materialCount; m++)
+        {
+            model.materials[m] = LoadMaterialDefault();
+
+            for (int i = 0; (i < MODEL_BINARY_MATERIAL_MAPS) && (i < MAX_MATERIAL_MAPS); i++)
+            {
+                model.materials[m].maps[i].color = materials[m].colors[i];
+                model.materials[m].maps[i].value = materials[m].values[i];
+
+                int index = materials[m].textures[i];
+                if ((index >= 0) && (index < (int)header->textureCount) && (loadedTextures[index].id > 0)) model.materials[m].maps[i].texture = loadedTextures[index];
+            }
+
+            for (int p = 0; p < 4; p++) model.materials[m].params[p] = materials[m].params[p];
+        }
+    }
+    else
+    {
+        model.materialCount = 1;
+        model.materials = (Material *)RL_CALLOC(model.materialCount, sizeof(Material));
+        model.materials[0] = LoadMaterialDefault();
+        for (int m = 0; m < model.meshCount; m++) model.meshMaterial[m] = 0;
+    }
+
+    RL_FREE(loadedTextures);
+
+    // Load skeleton and bind pose
+    model.boneCount = header->boneCount;
+
+    if (model.boneCount > 0)
+    {
+        model.bones = (BoneInfo *)RL_MALLOC(model.boneCount*sizeof(BoneInfo));
+        model.bindPose = (Transform *)RL_MALLOC(model.boneCount*sizeof(Transform));
+        memcpy(model.bones, fileData + header->bonesOffset, model.boneCount*sizeof(BoneInfo));
+        memcpy(model.bindPose, fileData + header->bindPoseOffset, model.boneCount*sizeof(Transform));
+    }
+
+    UnloadFileData(fileData);
+
+    TRACELOG(LOG_INFO, "MODEL: [%s] Model binary loaded successfully (%i meshes, %i materials, %i bones)", fileName, model.meshCount, model.materialCount, model.boneCount);
+
+    return model;
+}
+
+// Load model animations from binary file (exported with ExportModelBinary())
+ModelAnimation *LoadModelAnimationsBinary(const char *fileName, int *animCount)
+{
+    ModelAnimation *animations = NULL;
+    *animCount = 0;
+
+    int dataSize = 0;
+    unsigned char *fileData = LoadFileData(fileName, &dataSize);
+
+    if (!IsModelBinaryValid(fileData, dataSize))
+    {
+        TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to load model binary animations, invalid file", fileName);
+        UnloadFileData(fileData);
+        return animations;
+    }
+
+    ModelBinaryHeader *header = (ModelBinaryHeader *)fileData;
+    ModelBinaryAnimation *anims = (ModelBinaryAnimation *)(fileData + header->animationsOffset);
+
+    if (header->animationCount > 0)
+    {
+        animations = (ModelAnimation *)RL_CALLOC(header->animationCount, sizeof(ModelAnimation));
+
+        for (unsigned int a = 0; a < header->animationCount; a++)
+        {
+            ModelAnimation *anim = &animations[a];
+            memcpy(anim->name, anims[a].name, sizeof(anim->name));
+            anim->name[sizeof(anim->name) - 1] = '\0';
+            anim->boneCount = anims[a].boneCount;
+            anim->frameCount = anims[a].frameCount;
+
+            anim->bones = (BoneInfo *)RL_MALLOC(anim->boneCount*sizeof(BoneInfo));
+            memcpy(anim->bones, fileData + anims[a].bonesOffset, anim->boneCount*sizeof(BoneInfo));
+
+            anim->framePoses = (Transform **)RL_MALLOC(anim->frameCount*sizeof(Transform *));
+            for (int f = 0; f < anim->frameCount; f++)
+            {
+                anim->framePoses[f] = (Transform *)RL_MALLOC(anim->boneCount*sizeof(Transform));
+                memcpy(anim->framePoses[f], fileData + anims[a].posesOffset + f*anim->boneCount*sizeof(Transform), anim->boneCount*sizeof(Transform));
+            }
+        }
+
+        *animCount = header->animationCount;
+    }
+
+    UnloadFileData(fileData);
+
+    return animations;
+}
+
+// Load model scene from file, keeping nodes hierarchy and mesh instances
+// NOTE: Only glTF (.gltf/.glb) supported, every unique mesh is loaded once and uploaded to GPU,
+// nodes linking the same mesh become instances of it
+ModelScene LoadModelScene(const char *fileName)
+{
+    ModelScene scene = { 0 };
+
+#if defined(SUPPORT_FILEFORMAT_GLTF)
+    if (IsFileExtension(fileName, ".gltf") || IsFileExtension(fileName, ".glb")) scene.model = LoadGLTF(fileName, &scene);
+#endif
+
+    // Make sure model transform is set to identity matrix!
+    scene.model.transform = MatrixIdentity();
+
+    if ((scene.model.meshCount != 0) && (scene.model.meshes != NULL))
+    {
+        // Upload vertex data to GPU (static meshes)
+        for (int i = 0; i < scene.model.meshCount; i++) UploadMesh(&scene.model.meshes[i], false);
+    }
+    else
+    {
+        TRACELOG(LOG_WARNING, "MESH: [%s] Failed to load model scene mesh(es) data", fileName);
+        return scene;
+    }
+
+    if (scene.model.materialCount == 0)
+    {
+        scene.model.materialCount = 1;
+        scene.model.materials = (Material *)RL_CALLOC(scene.model.materialCount, sizeof(Material));
+        scene.model.materials[0] = LoadMaterialDefault();
+
+        if (scene.model.meshMaterial == NULL) scene.model.meshMaterial = (int *)RL_CALLOC(scene.model.meshCount, sizeof(int));
+    }
+
+    // Allocate instances by mesh, nodes-meshes links do not change after loading
+    scene.instanceCounts = (int *)RL_CALLOC(scene.model.meshCount, sizeof(int));
+    scene.instances = (Matrix **)RL_CALLOC(scene.model.meshCount, sizeof(Matrix *));
+
+    for (int n = 0; n < scene.nodeCount; n++)
+    {
+        for (int m = 0; m < scene.nodes[n].meshCount; m++) scene.instanceCounts[scene.nodes[n].meshFirst + m]++;
+    }
+
+    int instanceCount = 0;
+    for (int i = 0; i < scene.model.meshCount; i++)
+    {
+        if (scene.instanceCounts[i] > 0) scene.instances[i] = (Matrix *)RL_MALLOC(scene.instanceCounts[i]*sizeof(Matrix));
+        instanceCount += scene.instanceCounts[i];
+    }
+
+    UpdateModelScene(&scene);
+
+    TRACELOG(LOG_INFO, "MODEL: [%s] Model scene loaded successfully (%i nodes, %i unique meshes, %i instances)", fileName, scene.nodeCount, scene.model.meshCount, instanceCount);
+
+    return scene;
+}
+
+// Update scene nodes world transforms and mesh instances
+// NOTE: Required after changing any node local transform
+void UpdateModelScene(ModelScene *scene)
+{
+    if ((scene == NULL) || (scene->nodes == NULL)) return;
+
+    for (int n = 0; n < scene->nodeCount; n++)
+    {
+        // World transform: node local transform followed by all its parents local transforms
+        Matrix world = MatrixIdentity();
+
+        int current = n;
+        for (int depth = 0; (current >= 0) && (depth < scene->nodeCount); depth++)
+        {
+            Transform local = scene->nodes[current].local;
+            Matrix matLocal = MatrixMultiply(MatrixMultiply(MatrixScale(local.scale.x, local.scale.y, local.scale.z),
+                QuaternionToMatrix(local.rotation)), MatrixTranslate(local.translation.x, local.translation.y, local.translation.z));
+
+            world = MatrixMultiply(world, matLocal);
+            current = scene->nodes[current].parent;
+        }
+
+        scene->nodes[n].world = world;
+    }
+
+    // Rebuild instances lists, following nodes order
+    for (int i = 0; i < scene->model.meshCount; i++) scene->instanceCounts[i] = 0;
+
+    for (int n = 0; n < scene->nodeCount; n++)
+    {
+        for (int m = 0; m < scene->nodes[n].meshCount; m++)
+        {
+            int meshIndex = scene->nodes[n].meshFirst + m;
+            scene->instances[meshIndex][scene->instanceCounts[meshIndex]] = scene->nodes[n].world;
+            scene->instanceCounts[meshIndex]++;
+        }
+    }
+}
+
+// Unload model scene (unique meshes, materials and nodes)
+void UnloadModelScene(ModelScene scene)
+{
+    if (scene.instances != NULL)
+    {
+        for (int i = 0; i < scene.model.meshCount; i++) RL_FREE(scene.instances[i]);
+    }
+
+    RL_FREE(scene.instances);
+    RL_FREE(scene.instanceCounts);
+    RL_FREE(scene.nodes);
+
+    UnloadModel(scene.model);
+}
+
 // Upload vertex data into a VAO (if supported) and VBO
 void UploadMesh(Mesh *mesh, bool dynamic)
 {
@@ -1454,10 +2026,14 @@ void DrawMesh(Mesh mesh, Material material, Matrix transform)
     //-----------------------------------------------------
 
     // Bind active texture maps (if available)
+    int mapCount = 0;
+
     for (int i = 0; i < MAX_MATERIAL_MAPS; i++)
     {
         if (material.maps[i].texture.id > 0)
         {
+            mapCount = i + 1;
+
             // Select current shader texture slot
             rlActiveTextureSlot(i);
 
@@ -1471,6 +2047,9 @@ void DrawMesh(Mesh mesh, Material material, Matrix transform)
         }
     }
 
+    // Unbind texture maps left bound by previous materials in slots above current material maps
+    rlDisableTextureSlots(mapCount, MAX_MATERIAL_MAPS - mapCount);
+
     // Try binding vertex array objects (VAO) or use VBOs if not possible
     // WARNING: UploadMesh() enables all vertex attributes available in mesh and sets default attribute values
     // for shader expected vertex attributes that are not provided by the mesh (i.e. colors)
@@ -1556,30 +2135,14 @@ void DrawMesh(Mesh mesh, Material material, Matrix transform)
         else rlDrawVertexArray(0, mesh.vertexCount);
     }
 
-    // Unbind all bound texture maps
-    for (int i = 0; i < MAX_MATERIAL_MAPS; i++)
-    {
-        if (material.maps[i].texture.id > 0)
-        {
-            // Select current shader texture slot
-            rlActiveTextureSlot(i);
-
-            // Disable texture for active slot
-            if ((i == MATERIAL_MAP_IRRADIANCE) ||
-                (i == MATERIAL_MAP_PREFILTER) ||
-                (i == MATERIAL_MAP_CUBEMAP)) rlDisableTextureCubemap();
-            else rlDisableTexture();
-        }
-    }
+    // NOTE: Shader program and texture maps are kept bound, next draw with the same material
+    // skips rebinding them through rlgl state cache, rlgl batch system sets its own shader and textures
 
     // Disable all possible vertex array objects (or VBOs)
     rlDisableVertexArray();
     rlDisableVertexBuffer();
     rlDisableVertexBufferElement();
 
-    // Disable shader program
-    rlDisableShader();
-
     // Restore rlgl internal modelview and projection matrices
     rlSetMatrixModelview(matView);
     rlSetMatrixProjection(matProjection);
@@ -3431,25 +3994,324 @@ Mesh GenMeshCubicmap(Image cubicmap, Vector3 cubeSize)
 
     return mesh;
 }
-#endif      // SUPPORT_MESH_GENERATION
 
-// Compute mesh bounding box limits
-// NOTE: minVertex and maxVertex should be transformed by model transform matrix
-BoundingBox GetMeshBoundingBox(Mesh mesh)
+// Generate cubes-based map chunks meshes from pixel data
+// NOTE: Same cells rules than GenMeshCubicmap(): WHITE pixels generate cubes and BLACK pixels generate floor and ceiling,
+// but coplanar faces are greedily merged and every chunk is an independent indexed mesh, uploaded to GPU
+// NOTE: Texture coordinates are defined in cells units, a tiling texture (TEXTURE_WRAP_REPEAT) is expected
+CubicmapMesh GenMeshCubicmapChunks(Image cubicmap, Vector3 cubeSize, int chunkSize)
 {
-    // Get min and max vertex to construct bounds (AABB)
-    Vector3 minVertex = { 0 };
-    Vector3 maxVertex = { 0 };
+    CubicmapMesh map = { 0 };
 
-    if (mesh.vertices != NULL)
-    {
-        minVertex = (Vector3){ mesh.vertices[0], mesh.vertices[1], mesh.vertices[2] };
-        maxVertex = (Vector3){ mesh.vertices[0], mesh.vertices[1], mesh.vertices[2] };
+    if ((cubicmap.data == NULL) || (cubicmap.width <= 0) || (cubicmap.height <= 0)) return map;
 
-        for (int i = 1; i < mesh.vertexCount; i++)
-        {
-            minVertex = Vector3Min(minVertex, (Vector3){ mesh.vertices[i*3], mesh.vertices[i*3 + 1], mesh.vertices[i*3 + 2] });
-            maxVertex = Vector3Max(maxVertex, (Vector3){ mesh.vertices[i*3], mesh.vertices[i*3 + 1], mesh.vertices[i*3 + 2] });
+    // NOTE: Mesh indices are 16 bit, chunk size is limited to keep worst-case vertex count under 65536
+    if (chunkSize < 1) chunkSize = 1;
+    else if (chunkSize > CUBICMAP_MAX_CHUNK_SIZE) chunkSize = CUBICMAP_MAX_CHUNK_SIZE;
+
+    map.width = cubicmap.width;
+    map.height = cubicmap.height;
+    map.chunkSize = chunkSize;
+    map.chunksX = (map.width + chunkSize - 1)/chunkSize;
+    map.chunksZ = (map.height + chunkSize - 1)/chunkSize;
+    map.cubeSize = cubeSize;
+
+    map.cells = (unsigned char *)RL_MALLOC(map.width*map.height*sizeof(unsigned char));
+    map.dirty = (bool *)RL_CALLOC(map.chunksX*map.chunksZ, sizeof(bool));
+    map.chunks = (Mesh *)RL_CALLOC(map.chunksX*map.chunksZ, sizeof(Mesh));
+
+    Color *pixels = LoadImageColors(cubicmap);
+    for (int i = 0; i < map.width*map.height; i++) map.cells[i] = GetCubicmapCellType(pixels[i]);
+    UnloadImageColors(pixels);
+
+    for (int i = 0; i < map.chunksX*map.chunksZ; i++) map.dirty[i] = true;
+
+    UpdateCubicmapMesh(&map);
+
+    return map;
+}
+
+// Set cubicmap cell, marks affected chunks as dirty
+// NOTE: Cells on a chunk border also affect the side faces of the neighbour chunk
+void SetCubicmapCell(CubicmapMesh *cubicmap, int x, int z, Color color)
+{
+    if ((cubicmap == NULL) || (cubicmap->cells == NULL)) return;
+    if ((x < 0) || (x >= cubicmap->width) || (z < 0) || (z >= cubicmap->height)) return;
+
+    unsigned char type = GetCubicmapCellType(color);
+    if (cubicmap->cells[z*cubicmap->width + x] == type) return;
+
+    cubicmap->cells[z*cubicmap->width + x] = type;
+
+    int cs = cubicmap->chunkSize;
+    int chunkX = x/cs;
+    int chunkZ = z/cs;
+
+    cubicmap->dirty[chunkZ*cubicmap->chunksX + chunkX] = true;
+    if (((x%cs) == 0) && (chunkX > 0)) cubicmap->dirty[chunkZ*cubicmap->chunksX + chunkX - 1] = true;
+    if (((x%cs) == (cs - 1)) && (chunkX < (cubicmap->chunksX - 1))) cubicmap->dirty[chunkZ*cubicmap->chunksX + chunkX + 1] = true;
+    if (((z%cs) == 0) && (chunkZ > 0)) cubicmap->dirty[(chunkZ - 1)*cubicmap->chunksX + chunkX] = true;
+    if (((z%cs) == (cs - 1)) && (chunkZ < (cubicmap->chunksZ - 1))) cubicmap->dirty[(chunkZ + 1)*cubicmap->chunksX + chunkX] = true;
+}
+
+// Re-mesh cubicmap dirty chunks and upload them to GPU
+// NOTE: Empty chunks are left with vertexCount = 0 and not uploaded
+void UpdateCubicmapMesh(CubicmapMesh *cubicmap)
+{
+    if ((cubicmap == NULL) || (cubicmap->chunks == NULL)) return;
+
+    CubicmapChunkBuilder builder = { 0 };
+    int cs = cubicmap->chunkSize;
+
+    for (int i = 0; i < cubicmap->chunksX*cubicmap->chunksZ; i++)
+    {
+        if (!cubicmap->dirty[i]) continue;
+
+        // Temporary buffers are only allocated if some chunk requires re-meshing, and reused for all chunks
+        if (builder.vertices == NULL)
+        {
+            // NOTE: Worst case is 6 quads (4 vertex, 6 indices) by cell, greedy merging can not reduce a checkerboard
+            builder.vertices = (float *)RL_MALLOC(cs*cs*24*3*sizeof(float));
+            builder.texcoords = (float *)RL_MALLOC(cs*cs*24*2*sizeof(float));
+            builder.normals = (float *)RL_MALLOC(cs*cs*24*3*sizeof(float));
+            builder.indices = (unsigned short *)RL_MALLOC(cs*cs*36*sizeof(unsigned short));
+            builder.merged = (unsigned char *)RL_MALLOC(cs*cs*sizeof(unsigned char));
+        }
+
+        UnloadMesh(cubicmap->chunks[i]);
+        cubicmap->chunks[i] = GenCubicmapChunkMesh(cubicmap, i%cubicmap->chunksX, i/cubicmap->chunksX, &builder);
+        cubicmap->dirty[i] = false;
+    }
+
+    RL_FREE(builder.vertices);
+    RL_FREE(builder.texcoords);
+    RL_FREE(builder.normals);
+    RL_FREE(builder.indices);
+    RL_FREE(builder.merged);
+}
+
+// Unload cubicmap chunks meshes and cells data
+void UnloadCubicmapMesh(CubicmapMesh cubicmap)
+{
+    if (cubicmap.chunks != NULL)
+    {
+        for (int i = 0; i < cubicmap.chunksX*cubicmap.chunksZ; i++) UnloadMesh(cubicmap.chunks[i]);
+    }
+
+    RL_FREE(cubicmap.chunks);
+    RL_FREE(cubicmap.dirty);
+    RL_FREE(cubicmap.cells);
+}
+#endif      // SUPPORT_MESH_GENERATION
+
+// Load terrain from heightmap image data
+// NOTE: Heights are stored as 16 bit normalized values, tiles vertex data is generated and uploaded on UpdateTerrain()
+// NOTE: For exact tiles coverage, (heightmap.width - 1) and (heightmap.height - 1) should be multiple of tileSize
+Terrain LoadTerrain(Image heightmap, Vector3 size, int tileSize)
+{
+    Terrain terrain = { 0 };
+
+    if ((heightmap.data == NULL) || (heightmap.width < 2) || (heightmap.height < 2)) return terrain;
+
+    // Tile size must be a power of two to allow LOD levels
+    int pot = 2;
+    while (((pot*2) <= tileSize) && ((pot*2) <= TERRAIN_MAX_TILE_SIZE)) pot *= 2;
+    tileSize = pot;
+
+    terrain.width = heightmap.width;
+    terrain.height = heightmap.height;
+    terrain.tileSize = tileSize;
+    terrain.tilesX = (terrain.width - 1 + tileSize - 1)/tileSize;
+    terrain.tilesZ = (terrain.height - 1 + tileSize - 1)/tileSize;
+    terrain.size = size;
+
+    terrain.lodCount = 1;
+    while (((1 << terrain.lodCount) <= tileSize) && (terrain.lodCount < TERRAIN_MAX_LODS)) terrain.lodCount++;
+
+    terrain.heights = LoadTerrainHeights(heightmap);
+
+    // Generate indices shared by all tiles, one set by LOD level
+    terrain.lodIndices = (unsigned short **)RL_CALLOC(terrain.lodCount, sizeof(unsigned short *));
+    terrain.lodIndexCounts = (int *)RL_CALLOC(terrain.lodCount, sizeof(int));
+    terrain.lodIndexBuffers = (unsigned int *)RL_CALLOC(terrain.lodCount, sizeof(unsigned int));
+
+    for (int lod = 0; lod < terrain.lodCount; lod++)
+    {
+        terrain.lodIndices[lod] = GenTerrainLodIndices(tileSize, lod, &terrain.lodIndexCounts[lod]);
+        terrain.lodIndexBuffers[lod] = rlLoadVertexBufferElement(terrain.lodIndices[lod], terrain.lodIndexCounts[lod]*sizeof(unsigned short), false);
+    }
+
+    // Compute tiles bounds, required for LOD selection and streaming
+    terrain.tiles = (TerrainTile *)RL_CALLOC(terrain.tilesX*terrain.tilesZ, sizeof(TerrainTile));
+
+    float scaleX = size.x/(terrain.width - 1);
+    float scaleZ = size.z/(terrain.height - 1);
+
+    for (int tz = 0; tz < terrain.tilesZ; tz++)
+    {
+        for (int tx = 0; tx < terrain.tilesX; tx++)
+        {
+            int startX = tx*tileSize;
+            int startZ = tz*tileSize;
+            int endX = ((startX + tileSize) < terrain.width)? (startX + tileSize) : (terrain.width - 1);
+            int endZ = ((startZ + tileSize) < terrain.height)? (startZ + tileSize) : (terrain.height - 1);
+
+            unsigned short minHeight = 65535;
+            unsigned short maxHeight = 0;
+
+            for (int z = startZ; z <= endZ; z++)
+            {
+                for (int x = startX; x <= endX; x++)
+                {
+                    unsigned short value = terrain.heights[z*terrain.width + x];
+                    if (value < minHeight) minHeight = value;
+                    if (value > maxHeight) maxHeight = value;
+                }
+            }
+
+            TerrainTile *tile = &terrain.tiles[tz*terrain.tilesX + tx];
+            tile->bounds.min = (Vector3){ startX*scaleX, minHeight/65535.0f*size.y, startZ*scaleZ };
+            tile->bounds.max = (Vector3){ endX*scaleX, maxHeight/65535.0f*size.y, endZ*scaleZ };
+        }
+    }
+
+    // Default LOD and streaming parameters: LOD switch every two tiles, all tiles streamed, unlimited budget
+    terrain.lodDistance = 2.0f*tileSize*((scaleX > scaleZ)? scaleX : scaleZ);
+    terrain.streamDistance = sqrtf(size.x*size.x + size.y*size.y + size.z*size.z);
+    terrain.gpuBudget = 0;
+
+    TRACELOG(LOG_INFO, "MODEL: Terrain loaded successfully (%ix%i samples, %ix%i tiles, %i LODs)", terrain.width, terrain.height, terrain.tilesX, terrain.tilesZ, terrain.lodCount);
+
+    return terrain;
+}
+
+// Update terrain tiles LOD and streaming for a view position
+// NOTE: Tiles further than streamDistance are unloaded, nearest missing tiles are loaded (TERRAIN_MAX_TILE_LOADS per update)
+// and, if gpuBudget is exceeded, the furthest loaded tile is evicted to make room for a nearer one
+void UpdateTerrain(Terrain *terrain, Vector3 viewPosition)
+{
+    if ((terrain == NULL) || (terrain->tiles == NULL)) return;
+
+    int tileCount = terrain->tilesX*terrain->tilesZ;
+
+    // Unload tiles out of stream distance and update LOD of loaded tiles
+    for (int i = 0; i < tileCount; i++)
+    {
+        TerrainTile *tile = &terrain->tiles[i];
+        if (!tile->loaded) continue;
+
+        float distance = GetTerrainTileDistance(tile->bounds, viewPosition);
+
+        if (distance > terrain->streamDistance) UnloadTerrainTile(terrain, tile);
+        else
+        {
+            int lod = GetTerrainTileLod(terrain, distance);
+            if (lod != tile->lod) SetTerrainTileLod(terrain, tile, lod);
+        }
+    }
+
+    // Stream in nearest missing tiles, within budget
+    for (int n = 0; n < TERRAIN_MAX_TILE_LOADS; n++)
+    {
+        int nearest = -1;
+        float nearestDistance = terrain->streamDistance;
+
+        for (int i = 0; i < tileCount; i++)
+        {
+            if (terrain->tiles[i].loaded) continue;
+
+            float distance = GetTerrainTileDistance(terrain->tiles[i].bounds, viewPosition);
+            if (distance <= nearestDistance)
+            {
+                nearest = i;
+                nearestDistance = distance;
+            }
+        }
+
+        if (nearest == -1) break;
+
+        int tileBytes = GetTerrainTileVertexCount(terrain->tileSize)*(3 + 3 + 2)*sizeof(float);
+
+        if ((terrain->gpuBudget > 0) && ((terrain->gpuMemory + tileBytes) > terrain->gpuBudget))
+        {
+            int furthest = -1;
+            float furthestDistance = nearestDistance;
+
+            for (int i = 0; i < tileCount; i++)
+            {
+                if (!terrain->tiles[i].loaded) continue;
+
+                float distance = GetTerrainTileDistance(terrain->tiles[i].bounds, viewPosition);
+                if (distance > furthestDistance)
+                {
+                    furthest = i;
+                    furthestDistance = distance;
+                }
+            }
+
+            // Budget full with nearer tiles, nothing else to stream in
+            if (furthest == -1) break;
+
+            UnloadTerrainTile(terrain, &terrain->tiles[furthest]);
+        }
+
+        LoadTerrainTile(terrain, nearest % terrain->tilesX, nearest/terrain->tilesX);
+        SetTerrainTileLod(terrain, &terrain->tiles[nearest], GetTerrainTileLod(terrain, nearestDistance));
+    }
+}
+
+// Draw terrain loaded tiles with material and transform
+void DrawTerrain(Terrain terrain, Material material, Matrix transform)
+{
+    if (terrain.tiles == NULL) return;
+
+    for (int i = 0; i < terrain.tilesX*terrain.tilesZ; i++)
+    {
+        if (terrain.tiles[i].loaded) DrawMesh(terrain.tiles[i].mesh, material, transform);
+    }
+}
+
+// Unload terrain tiles, shared indices and heights data
+void UnloadTerrain(Terrain terrain)
+{
+    if (terrain.tiles != NULL)
+    {
+        for (int i = 0; i < terrain.tilesX*terrain.tilesZ; i++)
+        {
+            if (terrain.tiles[i].loaded) UnloadTerrainTile(&terrain, &terrain.tiles[i]);
+        }
+    }
+
+    for (int lod = 0; lod < terrain.lodCount; lod++)
+    {
+        if (terrain.lodIndexBuffers != NULL) rlUnloadVertexBuffer(terrain.lodIndexBuffers[lod]);
+        if (terrain.lodIndices != NULL) RL_FREE(terrain.lodIndices[lod]);
+    }
+
+    RL_FREE(terrain.lodIndices);
+    RL_FREE(terrain.lodIndexCounts);
+    RL_FREE(terrain.lodIndexBuffers);
+    RL_FREE(terrain.tiles);
+    RL_FREE(terrain.heights);
+}
+
+// Compute mesh bounding box limits
+// NOTE: minVertex and maxVertex should be transformed by model transform matrix
+BoundingBox GetMeshBoundingBox(Mesh mesh)
+{
+    // Get min and max vertex to construct bounds (AABB)
+    Vector3 minVertex = { 0 };
+    Vector3 maxVertex = { 0 };
+
+    if (mesh.vertices != NULL)
+    {
+        minVertex = (Vector3){ mesh.vertices[0], mesh.vertices[1], mesh.vertices[2] };
+        maxVertex = (Vector3){ mesh.vertices[0], mesh.vertices[1], mesh.vertices[2] };
+
+        for (int i = 1; i < mesh.vertexCount; i++)
+        {
+            minVertex = Vector3Min(minVertex, (Vector3){ mesh.vertices[i*3], mesh.vertices[i*3 + 1], mesh.vertices[i*3 + 2] });
+            maxVertex = Vector3Max(maxVertex, (Vector3){ mesh.vertices[i*3], mesh.vertices[i*3 + 1], mesh.vertices[i*3 + 2] });
         }
     }
 
@@ -3657,6 +4519,70 @@ void DrawModelPointsEx(Model model, Vector3 position, Vector3 rotationAxis, floa
     rlDisableWireMode();
 }
 
+// Draw a model scene, one mesh draw per instance
+// NOTE: Meshes data is shared by all instances, only transforms differ
+void DrawModelScene(ModelScene scene, Vector3 position, float scale, Color tint)
+{
+    Matrix matTransform = MatrixMultiply(MatrixMultiply(scene.model.transform, MatrixScale(scale, scale, scale)), MatrixTranslate(position.x, position.y, position.z));
+
+    for (int i = 0; i < scene.model.meshCount; i++)
+    {
+        if (scene.instanceCounts[i] == 0) continue;
+
+        Material *material = &scene.model.materials[scene.model.meshMaterial[i]];
+        Color color = material->maps[MATERIAL_MAP_DIFFUSE].color;
+
+        Color colorTint = WHITE;
+        colorTint.r = (unsigned char)(((int)color.r*(int)tint.r)/255);
+        colorTint.g = (unsigned char)(((int)color.g*(int)tint.g)/255);
+        colorTint.b = (unsigned char)(((int)color.b*(int)tint.b)/255);
+        colorTint.a = (unsigned char)(((int)color.a*(int)tint.a)/255);
+
+        material->maps[MATERIAL_MAP_DIFFUSE].color = colorTint;
+        for (int k = 0; k < scene.instanceCounts[i]; k++) DrawMesh(scene.model.meshes[i], *material, MatrixMultiply(scene.instances[i][k], matTransform));
+        material->maps[MATERIAL_MAP_DIFFUSE].color = color;
+    }
+}
+
+// Draw a model scene using instancing shader for meshes with multiple instances
+// NOTE: Shader must provide instances transform attribute at shader.locs[SHADER_LOC_MATRIX_MODEL],
+// materials maps are used but materials shaders are replaced by the provided one
+void DrawModelSceneInstanced(ModelScene scene, Shader shader, Vector3 position, float scale, Color tint)
+{
+    Matrix matTransform = MatrixMultiply(MatrixMultiply(scene.model.transform, MatrixScale(scale, scale, scale)), MatrixTranslate(position.x, position.y, position.z));
+
+    int maxInstances = 0;
+    for (int i = 0; i < scene.model.meshCount; i++) if (scene.instanceCounts[i] > maxInstances) maxInstances = scene.instanceCounts[i];
+    if (maxInstances == 0) return;
+
+    Matrix *transforms = (Matrix *)RL_MALLOC(maxInstances*sizeof(Matrix));
+
+    for (int i = 0; i < scene.model.meshCount; i++)
+    {
+        if (scene.instanceCounts[i] == 0) continue;
+
+        Material material = scene.model.materials[scene.model.meshMaterial[i]];
+        material.shader = shader;
+
+        Color color = material.maps[MATERIAL_MAP_DIFFUSE].color;
+
+        Color colorTint = WHITE;
+        colorTint.r = (unsigned char)(((int)color.r*(int)tint.r)/255);
+        colorTint.g = (unsigned char)(((int)color.g*(int)tint.g)/255);
+        colorTint.b = (unsigned char)(((int)color.b*(int)tint.b)/255);
+        colorTint.a = (unsigned char)(((int)color.a*(int)tint.a)/255);
+
+        material.maps[MATERIAL_MAP_DIFFUSE].color = colorTint;
+
+        for (int k = 0; k < scene.instanceCounts[i]; k++) transforms[k] = MatrixMultiply(scene.instances[i][k], matTransform);
+        DrawMeshInstanced(scene.model.meshes[i], material, transforms, scene.instanceCounts[i]);
+
+        material.maps[MATERIAL_MAP_DIFFUSE].color = color;
+    }
+
+    RL_FREE(transforms);
+}
+
 // Draw a billboard
 void DrawBillboard(Camera camera, Texture2D texture, Vector3 position, float scale, Color tint)
 {
@@ -4043,6 +4969,697 @@ RayCollision GetRayCollisionQuad(Ray ray, Vector3 p1, Vector3 p2, Vector3 p3, Ve
 //----------------------------------------------------------------------------------
 // Module specific Functions Definition
 //----------------------------------------------------------------------------------
+#if defined(SUPPORT_MESH_GENERATION)
+// Get cubicmap cell type from pixel color: 0-empty, 1-cube (WHITE), 2-floor and ceiling (BLACK)
+static unsigned char GetCubicmapCellType(Color color)
+{
+    unsigned char type = 0;
+
+    if ((color.r == 255) && (color.g == 255) && (color.b == 255) && (color.a == 255)) type = 1;
+    else if ((color.r == 0) && (color.g == 0) && (color.b == 0) && (color.a == 255)) type = 2;
+
+    return type;
+}
+
+// Check if a cube side face is visible toward a cubicmap cell (out of map or floor/ceiling cell)
+static bool IsCubicmapSideVisible(const CubicmapMesh *cubicmap, int x, int z)
+{
+    if ((x < 0) || (x >= cubicmap->width) || (z < 0) || (z >= cubicmap->height)) return true;
+
+    return (cubicmap->cells[z*cubicmap->width + x] == 2);
+}
+
+// Add a quad (2 triangles) to cubicmap chunk builder
+// NOTE: Quad corners are provided in counter-clockwise order
+static void AddCubicmapChunkQuad(CubicmapChunkBuilder *builder, const Vector3 *corners, const Vector2 *uvs, Vector3 normal)
+{
+    int base = builder->vertexCount;
+
+    for (int i = 0; i < 4; i++)
+    {
+        int v = base + i;
+        builder->vertices[v*3] = corners[i].x;
+        builder->vertices[v*3 + 1] = corners[i].y;
+        builder->vertices[v*3 + 2] = corners[i].z;
+        builder->texcoords[v*2] = uvs[i].x;
+        builder->texcoords[v*2 + 1] = uvs[i].y;
+        builder->normals[v*3] = normal.x;
+        builder->normals[v*3 + 1] = normal.y;
+        builder->normals[v*3 + 2] = normal.z;
+    }
+
+    builder->indices[builder->indexCount] = (unsigned short)base;
+    builder->indices[builder->indexCount + 1] = (unsigned short)(base + 1);
+    builder->indices[builder->indexCount + 2] = (unsigned short)(base + 2);
+    builder->indices[builder->indexCount + 3] = (unsigned short)base;
+    builder->indices[builder->indexCount + 4] = (unsigned short)(base + 2);
+    builder->indices[builder->indexCount + 5] = (unsigned short)(base + 3);
+
+    builder->vertexCount += 4;
+    builder->indexCount += 6;
+}
+
+// Generate one cubicmap chunk mesh, merging coplanar faces
+// NOTE: Horizontal faces are merged into rectangles, side faces are merged into runs along the chunk rows/columns
+static Mesh GenCubicmapChunkMesh(const CubicmapMesh *cubicmap, int chunkX, int chunkZ, CubicmapChunkBuilder *builder)
+{
+    Mesh mesh = { 0 };
+
+    int cs = cubicmap->chunkSize;
+    int startX = chunkX*cs;
+    int startZ = chunkZ*cs;
+    int endX = ((startX + cs) < cubicmap->width)? (startX + cs) : cubicmap->width;
+    int endZ = ((startZ + cs) < cubicmap->height)? (startZ + cs) : cubicmap->height;
+    int sizeX = endX - startX;
+
+    float w = cubicmap->cubeSize.x;
+    float h = cubicmap->cubeSize.z;
+    float h2 = cubicmap->cubeSize.y;
+
+    const unsigned char *cells = cubicmap->cells;
+    int width = cubicmap->width;
+
+    builder->vertexCount = 0;
+    builder->indexCount = 0;
+    memset(builder->merged, 0, cs*cs);
+
+    Vector3 corners[4] = { 0 };
+    Vector2 uvs[4] = { 0 };
+
+    // Horizontal faces: greedy rectangles of same type cells
+    // WHITE cells generate top (y = h2, facing up) and bottom (y = 0, facing down) faces
+    // BLACK cells generate floor (y = 0, facing up) and ceiling (y = h2, facing down) faces
+    for (int z = startZ; z < endZ; z++)
+    {
+        for (int x = startX; x < endX; x++)
+        {
+            unsigned char type = cells[z*width + x];
+            if ((type == 0) || builder->merged[(z - startZ)*sizeX + (x - startX)]) continue;
+
+            // Extend rectangle along X
+            int x1 = x + 1;
+            while ((x1 < endX) && (cells[z*width + x1] == type) && !builder->merged[(z - startZ)*sizeX + (x1 - startX)]) x1++;
+
+            // Extend rectangle along Z while full row matches
+            int z1 = z + 1;
+            while (z1 < endZ)
+            {
+                bool rowMatch = true;
+                for (int k = x; k < x1; k++)
+                {
+                    if ((cells[z1*width + k] != type) || builder->merged[(z1 - startZ)*sizeX + (k - startX)]) { rowMatch = false; break; }
+                }
+
+                if (!rowMatch) break;
+                z1++;
+            }
+
+            for (int j = z; j < z1; j++)
+            {
+                for (int k = x; k < x1; k++) builder->merged[(j - startZ)*sizeX + (k - startX)] = 1;
+            }
+
+            float px0 = w*(x - 0.5f);
+            float px1 = w*(x1 - 0.5f);
+            float pz0 = h*(z - 0.5f);
+            float pz1 = h*(z1 - 0.5f);
+            float upY = (type == 1)? h2 : 0.0f;
+            float downY = (type == 1)? 0.0f : h2;
+
+            // Face facing up
+            corners[0] = (Vector3){ px0, upY, pz0 };
+            corners[1] = (Vector3){ px0, upY, pz1 };
+            corners[2] = (Vector3){ px1, upY, pz1 };
+            corners[3] = (Vector3){ px1, upY, pz0 };
+            uvs[0] = (Vector2){ (float)x, (float)z };
+            uvs[1] = (Vector2){ (float)x, (float)z1 };
+            uvs[2] = (Vector2){ (float)x1, (float)z1 };
+            uvs[3] = (Vector2){ (float)x1, (float)z };
+            AddCubicmapChunkQuad(builder, corners, uvs, (Vector3){ 0.0f, 1.0f, 0.0f });
+
+            // Face facing down
+            corners[0] = (Vector3){ px0, downY, pz0 };
+            corners[1] = (Vector3){ px1, downY, pz0 };
+            corners[2] = (Vector3){ px1, downY, pz1 };
+            corners[3] = (Vector3){ px0, downY, pz1 };
+            uvs[0] = (Vector2){ (float)x, (float)z };
+            uvs[1] = (Vector2){ (float)x1, (float)z };
+            uvs[2] = (Vector2){ (float)x1, (float)z1 };
+            uvs[3] = (Vector2){ (float)x, (float)z1 };
+            AddCubicmapChunkQuad(builder, corners, uvs, (Vector3){ 0.0f, -1.0f, 0.0f });
+        }
+    }
+
+    // Side faces along X (facing +Z and -Z): runs of WHITE cells with visible neighbour
+    for (int z = startZ; z < endZ; z++)
+    {
+        for (int side = 0; side < 2; side++)
+        {
+            int nz = (side == 0)? (z + 1) : (z - 1);
+
+            for (int x = startX; x < endX; x++)
+            {
+                if ((cells[z*width + x] != 1) || !IsCubicmapSideVisible(cubicmap, x, nz)) continue;
+
+                int x1 = x + 1;
+                while ((x1 < endX) && (cells[z*width + x1] == 1) && IsCubicmapSideVisible(cubicmap, x1, nz)) x1++;
+
+                float px0 = w*(x - 0.5f);
+                float px1 = w*(x1 - 0.5f);
+
+                if (side == 0)
+                {
+                    float pz = h*(z + 0.5f);
+                    corners[0] = (Vector3){ px0, h2, pz };
+                    corners[1] = (Vector3){ px0, 0.0f, pz };
+                    corners[2] = (Vector3){ px1, 0.0f, pz };
+                    corners[3] = (Vector3){ px1, h2, pz };
+                    uvs[0] = (Vector2){ (float)x, 0.0f };
+                    uvs[1] = (Vector2){ (float)x, 1.0f };
+                    uvs[2] = (Vector2){ (float)x1, 1.0f };
+                    uvs[3] = (Vector2){ (float)x1, 0.0f };
+                    AddCubicmapChunkQuad(builder, corners, uvs, (Vector3){ 0.0f, 0.0f, 1.0f });
+                }
+                else
+                {
+                    float pz = h*(z - 0.5f);
+                    corners[0] = (Vector3){ px0, h2, pz };
+                    corners[1] = (Vector3){ px1, h2, pz };
+                    corners[2] = (Vector3){ px1, 0.0f, pz };
+                    corners[3] = (Vector3){ px0, 0.0f, pz };
+                    uvs[0] = (Vector2){ (float)x1, 0.0f };
+                    uvs[1] = (Vector2){ (float)x, 0.0f };
+                    uvs[2] = (Vector2){ (float)x, 1.0f };
+                    uvs[3] = (Vector2){ (float)x1, 1.0f };
+                    AddCubicmapChunkQuad(builder, corners, uvs, (Vector3){ 0.0f, 0.0f, -1.0f });
+                }
+
+                x = x1 - 1;
+            }
+        }
+    }
+
+    // Side faces along Z (facing +X and -X): runs of WHITE cells with visible neighbour
+    for (int x = startX; x < endX; x++)
+    {
+        for (int side = 0; side < 2; side++)
+        {
+            int nx = (side == 0)? (x + 1) : (x - 1);
+
+            for (int z = startZ; z < endZ; z++)
+            {
+                if ((cells[z*width + x] != 1) || !IsCubicmapSideVisible(cubicmap, nx, z)) continue;
+
+                int z1 = z + 1;
+                while ((z1 < endZ) && (cells[z1*width + x] == 1) && IsCubicmapSideVisible(cubicmap, nx, z1)) z1++;
+
+                float pz0 = h*(z - 0.5f);
+                float pz1 = h*(z1 - 0.5f);
+
+                if (side == 0)
+                {
+                    float px = w*(x + 0.5f);
+                    corners[0] = (Vector3){ px, h2, pz1 };
+                    corners[1] = (Vector3){ px, 0.0f, pz1 };
+                    corners[2] = (Vector3){ px, 0.0f, pz0 };
+                    corners[3] = (Vector3){ px, h2, pz0 };
+                    uvs[0] = (Vector2){ (float)z1, 0.0f };
+                    uvs[1] = (Vector2){ (float)z1, 1.0f };
+                    uvs[2] = (Vector2){ (float)z, 1.0f };
+                    uvs[3] = (Vector2){ (float)z, 0.0f };
+                    AddCubicmapChunkQuad(builder, corners, uvs, (Vector3){ 1.0f, 0.0f, 0.0f });
+                }
+                else
+                {
+                    float px = w*(x - 0.5f);
+                    corners[0] = (Vector3){ px, h2, pz0 };
+                    corners[1] = (Vector3){ px, 0.0f, pz0 };
+                    corners[2] = (Vector3){ px, 0.0f, pz1 };
+                    corners[3] = (Vector3){ px, h2, pz1 };
+                    uvs[0] = (Vector2){ (float)z, 0.0f };
+                    uvs[1] = (Vector2){ (float)z, 1.0f };
+                    uvs[2] = (Vector2){ (float)z1, 1.0f };
+                    uvs[3] = (Vector2){ (float)z1, 0.0f };
+                    AddCubicmapChunkQuad(builder, corners, uvs, (Vector3){ -1.0f, 0.0f, 0.0f });
+                }
+
+                z = z1 - 1;
+            }
+        }
+    }
+
+    if (builder->vertexCount > 0)
+    {
+        mesh.vertexCount = builder->vertexCount;
+        mesh.triangleCount = builder->indexCount/3;
+
+        mesh.vertices = (float *)RL_MALLOC(mesh.vertexCount*3*sizeof(float));
+        mesh.texcoords = (float *)RL_MALLOC(mesh.vertexCount*2*sizeof(float));
+        mesh.normals = (float *)RL_MALLOC(mesh.vertexCount*3*sizeof(float));
+        mesh.indices = (unsigned short *)RL_MALLOC(builder->indexCount*sizeof(unsigned short));
+
+        memcpy(mesh.vertices, builder->vertices, mesh.vertexCount*3*sizeof(float));
+        memcpy(mesh.texcoords, builder->texcoords, mesh.vertexCount*2*sizeof(float));
+        memcpy(mesh.normals, builder->normals, mesh.vertexCount*3*sizeof(float));
+        memcpy(mesh.indices, builder->indices, builder->indexCount*sizeof(unsigned short));
+
+        // Upload vertex data to GPU (static mesh)
+        UploadMesh(&mesh, false);
+    }
+
+    return mesh;
+}
+#endif      // SUPPORT_MESH_GENERATION
+
+// Convert half-float (stored as unsigned short) to float
+// NOTE: Bits are reinterpreted through a union to avoid strict-aliasing issues
+static float HalfToFloat(unsigned short x)
+{
+    union { float f; unsigned int u; } bits = { 0 };
+
+    unsigned int sign = (x & 0x8000u) << 16;
+    unsigned int exponent = (x & 0x7C00u) >> 10;
+    unsigned int mantissa = (x & 0x03FFu);
+
+    if (exponent == 0x1F) bits.u = sign | 0x7F800000u | (mantissa << 13);     // Infinity/NaN
+    else if (exponent != 0) bits.u = sign | ((exponent + 112) << 23) | (mantissa << 13);     // Normalized
+    else if (mantissa != 0)
+    {
+        // Denormalized, shift mantissa until it gets normalized
+        exponent = 113;
+        while ((mantissa & 0x0400u) == 0) { mantissa <<= 1; exponent--; }
+        bits.u = sign | (exponent << 23) | ((mantissa & 0x03FFu) << 13);
+    }
+    else bits.u = sign;     // Zero
+
+    return bits.f;
+}
+
+// Load terrain heights from heightmap as 16 bit normalized values
+// NOTE: GRAYSCALE, R16 (half-float) and R32 formats are read directly, other formats use the average of color channels
+static unsigned short *LoadTerrainHeights(Image heightmap)
+{
+    int count = heightmap.width*heightmap.height;
+    unsigned short *heights = (unsigned short *)RL_MALLOC(count*sizeof(unsigned short));
+
+    switch (heightmap.format)
+    {
+        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
+        {
+            for (int i = 0; i < count; i++) heights[i] = ((unsigned char *)heightmap.data)[i]*257;
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R16:
+        case PIXELFORMAT_UNCOMPRESSED_R32:
+        {
+            for (int i = 0; i < count; i++)
+            {
+                float value = (heightmap.format == PIXELFORMAT_UNCOMPRESSED_R16)? HalfToFloat(((unsigned short *)heightmap.data)[i]) : ((float *)heightmap.data)[i];
+
+                if (value < 0.0f) value = 0.0f;
+                else if (value > 1.0f) value = 1.0f;
+
+                heights[i] = (unsigned short)(value*65535.0f + 0.5f);
+            }
+        } break;
+        default:
+        {
+            Color *pixels = LoadImageColors(heightmap);
+            for (int i = 0; i < count; i++) heights[i] = (unsigned short)((pixels[i].r + pixels[i].g + pixels[i].b)*257/3);
+            UnloadImageColors(pixels);
+        } break;
+    }
+
+    return heights;
+}
+
+// Get terrain tile vertex count: (tileSize + 1)^2 grid vertex plus skirt vertex on the 4 edges
+static int GetTerrainTileVertexCount(int tileSize)
+{
+    return (tileSize + 1)*(tileSize + 1) + 4*(tileSize + 1);
+}
+
+// Generate terrain tile indices for a LOD level
+// NOTE: Every LOD level skips (1 << lod) grid vertex, edges are closed with skirts to hide cracks between LOD levels
+static unsigned short *GenTerrainLodIndices(int tileSize, int lod, int *indexCount)
+{
+    #define TERRAIN_GRID(x, z) (unsigned short)((z)*(tileSize + 1) + (x))
+    #define TERRAIN_SKIRT(edge, k) (unsigned short)((tileSize + 1)*(tileSize + 1) + (edge)*(tileSize + 1) + (k))
+
+    int step = 1 << lod;
+    int quads = tileSize/step;
+
+    *indexCount = quads*quads*6 + 4*quads*6;
+    unsigned short *indices = (unsigned short *)RL_MALLOC(*indexCount*sizeof(unsigned short));
+
+    int i = 0;
+
+    for (int z = 0; z < tileSize; z += step)
+    {
+        for (int x = 0; x < tileSize; x += step)
+        {
+            indices[i] = TERRAIN_GRID(x, z);
+            indices[i + 1] = TERRAIN_GRID(x, z + step);
+            indices[i + 2] = TERRAIN_GRID(x + step, z);
+            indices[i + 3] = TERRAIN_GRID(x + step, z);
+            indices[i + 4] = TERRAIN_GRID(x, z + step);
+            indices[i + 5] = TERRAIN_GRID(x + step, z + step);
+            i += 6;
+        }
+    }
+
+    // Skirts, facing outwards: edge 0 (z = 0), edge 1 (z = tileSize), edge 2 (x = 0), edge 3 (x = tileSize)
+    for (int k = 0; k < tileSize; k += step)
+    {
+        unsigned short a = TERRAIN_GRID(k, 0), b = TERRAIN_GRID(k + step, 0);
+        unsigned short sa = TERRAIN_SKIRT(0, k), sb = TERRAIN_SKIRT(0, k + step);
+        indices[i] = a; indices[i + 1] = b; indices[i + 2] = sb;
+        indices[i + 3] = a; indices[i + 4] = sb; indices[i + 5] = sa;
+        i += 6;
+
+        a = TERRAIN_GRID(k, tileSize); b = TERRAIN_GRID(k + step, tileSize);
+        sa = TERRAIN_SKIRT(1, k); sb = TERRAIN_SKIRT(1, k + step);
+        indices[i] = a; indices[i + 1] = sa; indices[i + 2] = sb;
+        indices[i + 3] = a; indices[i + 4] = sb; indices[i + 5] = b;
+        i += 6;
+
+        a = TERRAIN_GRID(0, k); b = TERRAIN_GRID(0, k + step);
+        sa = TERRAIN_SKIRT(2, k); sb = TERRAIN_SKIRT(2, k + step);
+        indices[i] = a; indices[i + 1] = sa; indices[i + 2] = sb;
+        indices[i + 3] = a; indices[i + 4] = sb; indices[i + 5] = b;
+        i += 6;
+
+        a = TERRAIN_GRID(tileSize, k); b = TERRAIN_GRID(tileSize, k + step);
+        sa = TERRAIN_SKIRT(3, k); sb = TERRAIN_SKIRT(3, k + step);
+        indices[i] = b; indices[i + 1] = sb; indices[i + 2] = sa;
+        indices[i + 3] = b; indices[i + 4] = sa; indices[i + 5] = a;
+        i += 6;
+    }
+
+    #undef TERRAIN_GRID
+    #undef TERRAIN_SKIRT
+
+    return indices;
+}
+
+// Get distance from a point to a terrain tile bounds
+static float GetTerrainTileDistance(BoundingBox bounds, Vector3 position)
+{
+    float dx = (position.x < bounds.min.x)? (bounds.min.x - position.x) : ((position.x > bounds.max.x)? (position.x - bounds.max.x) : 0.0f);
+    float dy = (position.y < bounds.min.y)? (bounds.min.y - position.y) : ((position.y > bounds.max.y)? (position.y - bounds.max.y) : 0.0f);
+    float dz = (position.z < bounds.min.z)? (bounds.min.z - position.z) : ((position.z > bounds.max.z)? (position.z - bounds.max.z) : 0.0f);
+
+    return sqrtf(dx*dx + dy*dy + dz*dz);
+}
+
+// Get terrain LOD level for a distance, every level range doubles the previous one
+static int GetTerrainTileLod(const Terrain *terrain, float distance)
+{
+    int lod = 0;
+    float range = terrain->lodDistance;
+
+    while ((distance >= range) && (lod < (terrain->lodCount - 1)))
+    {
+        range *= 2.0f;
+        lod++;
+    }
+
+    return lod;
+}
+
+// Set terrain tile LOD level, tile mesh points to the shared indices of that level
+static void SetTerrainTileLod(const Terrain *terrain, TerrainTile *tile, int lod)
+{
+    tile->lod = lod;
+    tile->mesh.indices = terrain->lodIndices[lod];
+    tile->mesh.triangleCount = terrain->lodIndexCounts[lod]/3;
+
+    if (tile->mesh.vboId != NULL)
+    {
+        tile->mesh.vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_INDICES] = terrain->lodIndexBuffers[lod];
+
+        // NOTE: Element buffer binding is part of the VAO state
+        if (rlEnableVertexArray(tile->mesh.vaoId))
+        {
+            rlEnableVertexBufferElement(terrain->lodIndexBuffers[lod]);
+            rlDisableVertexArray();
+        }
+    }
+}
+
+// Load terrain tile: generate vertex data from heights and upload it to GPU
+static void LoadTerrainTile(Terrain *terrain, int tileX, int tileZ)
+{
+    TerrainTile *tile = &terrain->tiles[tileZ*terrain->tilesX + tileX];
+    int n = terrain->tileSize;
+
+    Mesh mesh = { 0 };
+    mesh.vertexCount = GetTerrainTileVertexCount(n);
+    mesh.vertices = (float *)RL_MALLOC(mesh.vertexCount*3*sizeof(float));
+    mesh.normals = (float *)RL_MALLOC(mesh.vertexCount*3*sizeof(float));
+    mesh.texcoords = (float *)RL_MALLOC(mesh.vertexCount*2*sizeof(float));
+
+    float scaleX = terrain->size.x/(terrain->width - 1);
+    float scaleY = terrain->size.y/65535.0f;
+    float scaleZ = terrain->size.z/(terrain->height - 1);
+
+    // Skirts depth covers the tile height range, enough to hide any crack with neighbour tiles
+    float skirtDepth = (tile->bounds.max.y - tile->bounds.min.y) + terrain->size.y*0.01f;
+
+    for (int z = 0; z <= n; z++)
+    {
+        for (int x = 0; x <= n; x++)
+        {
+            // NOTE: Samples out of the heightmap (last tiles) are clamped to the border
+            int sx = tileX*n + x;
+            int sz = tileZ*n + z;
+            if (sx > (terrain->width - 1)) sx = terrain->width - 1;
+            if (sz > (terrain->height - 1)) sz = terrain->height - 1;
+
+            int v = z*(n + 1) + x;
+
+            mesh.vertices[v*3] = sx*scaleX;
+            mesh.vertices[v*3 + 1] = terrain->heights[sz*terrain->width + sx]*scaleY;
+            mesh.vertices[v*3 + 2] = sz*scaleZ;
+
+            mesh.texcoords[v*2] = (float)sx/(terrain->width - 1);
+            mesh.texcoords[v*2 + 1] = (float)sz/(terrain->height - 1);
+
+            // Normals from central differences on heightmap, continuous between tiles
+            int xl = (sx > 0)? (sx - 1) : sx;
+            int xr = (sx < (terrain->width - 1))? (sx + 1) : sx;
+            int zd = (sz > 0)? (sz - 1) : sz;
+            int zu = (sz < (terrain->height - 1))? (sz + 1) : sz;
+
+            float dhdx = (terrain->heights[sz*terrain->width + xr] - terrain->heights[sz*terrain->width + xl])*scaleY/((xr - xl)*scaleX);
+            float dhdz = (terrain->heights[zu*terrain->width + sx] - terrain->heights[zd*terrain->width + sx])*scaleY/((zu - zd)*scaleZ);
+
+            Vector3 normal = Vector3Normalize((Vector3){ -dhdx, 1.0f, -dhdz });
+            mesh.normals[v*3] = normal.x;
+            mesh.normals[v*3 + 1] = normal.y;
+            mesh.normals[v*3 + 2] = normal.z;
+        }
+    }
+
+    // Skirt vertex, copy of edge vertex moved down
+    for (int edge = 0; edge < 4; edge++)
+    {
+        for (int k = 0; k <= n; k++)
+        {
+            int src = 0;
+            if (edge == 0) src = k;
+            else if (edge == 1) src = n*(n + 1) + k;
+            else if (edge == 2) src = k*(n + 1);
+            else src = k*(n + 1) + n;
+
+            int v = (n + 1)*(n + 1) + edge*(n + 1) + k;
+
+            mesh.vertices[v*3] = mesh.vertices[src*3];
+            mesh.vertices[v*3 + 1] = mesh.vertices[src*3 + 1] - skirtDepth;
+            mesh.vertices[v*3 + 2] = mesh.vertices[src*3 + 2];
+            mesh.texcoords[v*2] = mesh.texcoords[src*2];
+            mesh.texcoords[v*2 + 1] = mesh.texcoords[src*2 + 1];
+            mesh.normals[v*3] = mesh.normals[src*3];
+            mesh.normals[v*3 + 1] = mesh.normals[src*3 + 1];
+            mesh.normals[v*3 + 2] = mesh.normals[src*3 + 2];
+        }
+    }
+
+    // Upload vertex data to GPU (static mesh), indices are shared and set by LOD level
+    UploadMesh(&mesh, false);
+
+    tile->mesh = mesh;
+    tile->loaded = true;
+    terrain->gpuMemory += mesh.vertexCount*(3 + 3 + 2)*sizeof(float);
+}
+
+// Unload terrain tile from GPU and CPU memory
+static void UnloadTerrainTile(Terrain *terrain, TerrainTile *tile)
+{
+    // Shared indices must not be unloaded with the tile
+    tile->mesh.indices = NULL;
+    if (tile->mesh.vboId != NULL) tile->mesh.vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_INDICES] = 0;
+
+    terrain->gpuMemory -= tile->mesh.vertexCount*(3 + 3 + 2)*sizeof(float);
+
+    UnloadMesh(tile->mesh);
+    tile->mesh = (Mesh){ 0 };
+    tile->loaded = false;
+}
+
+// Get mesh attribute data pointer and size in bytes, for model binary format
+// NOTE: Attributes order: vertices, texcoords, texcoords2, normals, tangents, colors, indices, boneIds, boneWeights
+static void **GetModelBinaryMeshAttrib(Mesh *mesh, int attrib, unsigned int *size)
+{
+    void **data = NULL;
+
+    switch (attrib)
+    {
+        case 0: data = (void **)&mesh->vertices; *size = mesh->vertexCount*3*sizeof(float); break;
+        case 1: data = (void **)&mesh->texcoords; *size = mesh->vertexCount*2*sizeof(float); break;
+        case 2: data = (void **)&mesh->texcoords2; *size = mesh->vertexCount*2*sizeof(float); break;
+        case 3: data = (void **)&mesh->normals; *size = mesh->vertexCount*3*sizeof(float); break;
+        case 4: data = (void **)&mesh->tangents; *size = mesh->vertexCount*4*sizeof(float); break;
+        case 5: data = (void **)&mesh->colors; *size = mesh->vertexCount*4*sizeof(unsigned char); break;
+        case 6: data = (void **)&mesh->indices; *size = mesh->triangleCount*3*sizeof(unsigned short); break;
+        case 7: data = (void **)&mesh->boneIds; *size = mesh->vertexCount*4*sizeof(unsigned char); break;
+        case 8: data = (void **)&mesh->boneWeights; *size = mesh->vertexCount*4*sizeof(float); break;
+        default: break;
+    }
+
+    return data;
+}
+
+// Get image pixel data size in bytes, considering all mipmap levels
+static unsigned int GetModelBinaryImageSize(Image image)
+{
+    unsigned int size = 0;
+    int width = image.width;
+    int height = image.height;
+
+    for (int i = 0; i < image.mipmaps; i++)
+    {
+        size += GetPixelDataSize(width, height, image.format);
+
+        width /= 2;
+        height /= 2;
+        if (width < 1) width = 1;
+        if (height < 1) height = 1;
+    }
+
+    return size;
+}
+
+// Check model binary file data is valid: identifier, version, counts, blocks and indices in range
+// NOTE: Any inconsistency rejects the full file, loaders can copy blocks without further checks
+static bool IsModelBinaryValid(const unsigned char *fileData, int dataSize)
+{
+    if ((fileData == NULL) || (dataSize < (int)sizeof(ModelBinaryHeader))) return false;
+
+    const ModelBinaryHeader *header = (const ModelBinaryHeader *)fileData;
+
+    if (memcmp(header->id, "rMDB", 4) != 0) return false;
+    if (header->version != MODEL_BINARY_VERSION)
+    {
+        TRACELOG(LOG_WARNING, "MODEL: Model binary version not supported (%i)", header->version);
+        return false;
+    }
+    if (header->fileSize != (unsigned int)dataSize) return false;
+
+    // Check descriptors blocks, sizes computed in 64 bit to avoid overflows
+    // NOTE: Blocks contained in file data also bound the counts, file size fits in an int
+    if (header->meshCount == 0) return false;
+    if (!IsModelBinaryBlockValid(header, header->meshesOffset, (unsigned long long)header->meshCount*sizeof(ModelBinaryMesh))) return false;
+    if (!IsModelBinaryBlockValid(header, header->meshMaterialOffset, (unsigned long long)header->meshCount*sizeof(int))) return false;
+    if (!IsModelBinaryBlockValid(header, header->materialsOffset, (unsigned long long)header->materialCount*sizeof(ModelBinaryMaterial))) return false;
+    if (!IsModelBinaryBlockValid(header, header->texturesOffset, (unsigned long long)header->textureCount*sizeof(ModelBinaryTexture))) return false;
+    if (!IsModelBinaryBlockValid(header, header->bonesOffset, (unsigned long long)header->boneCount*sizeof(BoneInfo))) return false;
+    if (!IsModelBinaryBlockValid(header, header->bindPoseOffset, (unsigned long long)header->boneCount*sizeof(Transform))) return false;
+    if (!IsModelBinaryBlockValid(header, header->animationsOffset, (unsigned long long)header->animationCount*sizeof(ModelBinaryAnimation))) return false;
+
+    // Check meshes: counts, attributes blocks and indices/bones referenced
+    const ModelBinaryMesh *meshes = (const ModelBinaryMesh *)(fileData + header->meshesOffset);
+    const int *meshMaterial = (const int *)(fileData + header->meshMaterialOffset);
+
+    for (unsigned int m = 0; m < header->meshCount; m++)
+    {
+        if ((meshes[m].vertexCount <= 0) || (meshes[m].triangleCount < 0)) return false;
+        if (((unsigned long long)meshes[m].vertexCount*3*sizeof(float)) > header->fileSize) return false;
+        if (((unsigned long long)meshes[m].triangleCount*3*sizeof(unsigned short)) > header->fileSize) return false;
+        if (meshes[m].offsets[0] == 0) return false;    // Vertex positions are required
+
+        Mesh mesh = { 0 };
+        mesh.vertexCount = meshes[m].vertexCount;
+        mesh.triangleCount = meshes[m].triangleCount;
+
+        for (int a = 0; a < MODEL_BINARY_MESH_ATTRIBS; a++)
+        {
+            if (meshes[m].offsets[a] == 0) continue;
+
+            unsigned int size = 0;
+            GetModelBinaryMeshAttrib(&mesh, a, &size);
+
+            if (!IsModelBinaryBlockValid(header, meshes[m].offsets[a], size)) return false;
+        }
+
+        if (meshes[m].offsets[6] != 0)
+        {
+            const unsigned short *indices = (const unsigned short *)(fileData + meshes[m].offsets[6]);
+            for (int i = 0; i < meshes[m].triangleCount*3; i++) if (indices[i] >= meshes[m].vertexCount) return false;
+        }
+        else if ((meshes[m].triangleCount*3) > meshes[m].vertexCount) return false;
+
+        // Skinning requires both bones ids and weights, referencing model bones
+        if ((meshes[m].offsets[7] != 0) != (meshes[m].offsets[8] != 0)) return false;
+        if (meshes[m].offsets[7] != 0)
+        {
+            const unsigned char *boneIds = fileData + meshes[m].offsets[7];
+            for (int i = 0; i < meshes[m].vertexCount*4; i++) if (boneIds[i] >= header->boneCount) return false;
+        }
+
+        if ((header->materialCount > 0) && ((meshMaterial[m] < 0) || (meshMaterial[m] >= (int)header->materialCount))) return false;
+    }
+
+    // Check textures pixel data blocks
+    const ModelBinaryTexture *textures = (const ModelBinaryTexture *)(fileData + header->texturesOffset);
+    for (unsigned int t = 0; t < header->textureCount; t++)
+    {
+        // NOTE: Pixel count limited so GetPixelDataSize() can not overflow for any format (16 bytes per pixel max)
+        if ((textures[t].width <= 0) || (textures[t].height <= 0) || (((long long)textures[t].width*textures[t].height) > 8192*8192)) return false;
+        if ((textures[t].mipmaps <= 0) || (textures[t].mipmaps > 15)) return false;
+        if ((textures[t].format < PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) || (textures[t].format > PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA)) return false;
+
+        Image image = { NULL, textures[t].width, textures[t].height, textures[t].mipmaps, textures[t].format };
+        if (textures[t].dataSize < GetModelBinaryImageSize(image)) return false;
+        if (!IsModelBinaryBlockValid(header, textures[t].dataOffset, textures[t].dataSize)) return false;
+    }
+
+    // Check bones hierarchy
+    const BoneInfo *bones = (const BoneInfo *)(fileData + header->bonesOffset);
+    for (unsigned int b = 0; b < header->boneCount; b++)
+    {
+        if ((bones[b].parent < -1) || (bones[b].parent >= (int)header->boneCount)) return false;
+    }
+
+    // Check animations blocks
+    const ModelBinaryAnimation *anims = (const ModelBinaryAnimation *)(fileData + header->animationsOffset);
+    for (unsigned int a = 0; a < header->animationCount; a++)
+    {
+        if ((anims[a].boneCount < 0) || (anims[a].frameCount < 0)) return false;
+        if (!IsModelBinaryBlockValid(header, anims[a].bonesOffset, (unsigned long long)anims[a].boneCount*sizeof(BoneInfo))) return false;
+        if (!IsModelBinaryBlockValid(header, anims[a].posesOffset, (unsigned long long)anims[a].frameCount*anims[a].boneCount*sizeof(Transform))) return false;
+    }
+
+    return true;
+}
+
+// Check model binary block is aligned and fully contained in file data, after file header
+static bool IsModelBinaryBlockValid(const ModelBinaryHeader *header, unsigned int offset, unsigned long long size)
+{
+    if (size == 0) return true;
+
+    return ((offset >= sizeof(ModelBinaryHeader)) && ((offset%MODEL_BINARY_ALIGNMENT) == 0) && (((unsigned long long)offset + size) <= header->fileSize));
+}
+
 #if defined(SUPPORT_FILEFORMAT_IQM) || defined(SUPPORT_FILEFORMAT_GLTF)
 // Build pose from parent joints
 // NOTE: Required for animations loading (required by IQM and GLTF)
@@ -5045,8 +6662,68 @@ static BoneInfo *LoadBoneInfoGLTF(cgltf_skin skin, int *boneCount)
     return bones;
 }
 
+// Load scene nodes hierarchy from GLTF data
+// NOTE: Every unique mesh primitives are expected to be loaded consecutively, in meshes order
+static void LoadSceneNodesGLTF(cgltf_data *data, ModelScene *scene)
+{
+    // Get first model mesh index for every glTF mesh (only triangle primitives are loaded)
+    int *meshFirst = (int *)RL_CALLOC(data->meshes_count + 1, sizeof(int));
+
+    for (unsigned int i = 0; i < data->meshes_count; i++)
+    {
+        int count = 0;
+        for (unsigned int p = 0; p < data->meshes[i].primitives_count; p++)
+        {
+            if (data->meshes[i].primitives[p].type == cgltf_primitive_type_triangles) count++;
+        }
+
+        meshFirst[i + 1] = meshFirst[i] + count;
+    }
+
+    scene->nodeCount = (int)data->nodes_count;
+    scene->nodes = (ModelNode *)RL_CALLOC(scene->nodeCount, sizeof(ModelNode));
+
+    for (unsigned int i = 0; i < data->nodes_count; i++)
+    {
+        cgltf_node *node = &data->nodes[i];
+        ModelNode *sceneNode = &scene->nodes[i];
+
+        if (node->name != NULL)
+        {
+            strncpy(sceneNode->name, node->name, sizeof(sceneNode->name));
+            sceneNode->name[sizeof(sceneNode->name) - 1] = '\0';
+        }
+
+        sceneNode->parent = (node->parent != NULL)? (int)(node->parent - data->nodes) : -1;
+
+        cgltf_float localTransform[16];
+        cgltf_node_transform_local(node, localTransform);
+
+        Matrix localMatrix = {
+            localTransform[0], localTransform[4], localTransform[8], localTransform[12],
+            localTransform[1], localTransform[5], localTransform[9], localTransform[13],
+            localTransform[2], localTransform[6], localTransform[10], localTransform[14],
+            localTransform[3], localTransform[7], localTransform[11], localTransform[15]
+        };
+
+        MatrixDecompose(localMatrix, &sceneNode->local.translation, &sceneNode->local.rotation, &sceneNode->local.scale);
+        sceneNode->world = MatrixIdentity();
+
+        if (node->mesh != NULL)
+        {
+            int meshId = (int)(node->mesh - data->meshes);
+            sceneNode->meshFirst = meshFirst[meshId];
+            sceneNode->meshCount = meshFirst[meshId + 1] - meshFirst[meshId];
+        }
+        else sceneNode->meshFirst = -1;
+    }
+
+    RL_FREE(meshFirst);
+}
+
 // Load glTF file into model struct, .gltf and .glb supported
-static Model LoadGLTF(const char *fileName)
+// NOTE: If scene is provided, unique meshes are loaded once (no transform applied) and nodes data is returned in scene
+static Model LoadGLTF(const char *fileName, ModelScene *scene)
 {
     /*********************************************************************************************
 
@@ -5065,6 +6742,8 @@ static Model LoadGLTF(const char *fileName)
             hierarchy is not kept (as it can't be represented).
           - Mesh instances in the glTF file (i.e. same mesh linked from multiple nodes)
             are turned into separate raylib Meshes.
+          - When loading a scene (LoadModelScene()), unique meshes are loaded once without
+            transform applied and nodes hierarchy and mesh instances are kept in ModelScene.
 
         RESTRICTIONS:
           - Only triangle meshes supported
@@ -5126,13 +6805,16 @@ static Model LoadGLTF(const char *fileName)
         result = cgltf_load_buffers(&options, data, fileName);
         if (result != cgltf_result_success) TRACELOG(LOG_INFO, "MODEL: [%s] Failed to load mesh/material buffers", fileName);
 
+        // NOTE: Meshes source: every node linking a mesh or, if loading a scene, every unique mesh
+        unsigned int sourceCount = (scene != NULL)? (unsigned int)data->meshes_count : (unsigned int)data->nodes_count;
+
         int primitivesCount = 0;
         // NOTE: We will load every primitive in the glTF as a separate raylib Mesh.
         // Determine total number of meshes needed from the node hierarchy.
-        for (unsigned int i = 0; i < data->nodes_count; i++)
+        for (unsigned int i = 0; i < sourceCount; i++)
         {
-            cgltf_node *node = &(data->nodes[i]);
-            cgltf_mesh *mesh = node->mesh;
+            cgltf_node *node = (scene != NULL)? NULL : &(data->nodes[i]);
+            cgltf_mesh *mesh = (scene != NULL)? &(data->meshes[i]) : node->mesh;
             if (!mesh)
                 continue;
 
@@ -5253,18 +6935,19 @@ static Model LoadGLTF(const char *fileName)
         // is turned into multiple Mesh's, as each Node will have its own
         // transform applied.
         // Note: the code below disregards the scenes defined in the file, all nodes are used.
+        // Note: When loading a scene, every unique mesh is visited instead, with no transform applied.
         //----------------------------------------------------------------------------------------------------
         int meshIndex = 0;
-        for (unsigned int i = 0; i < data->nodes_count; i++)
+        for (unsigned int i = 0; i < sourceCount; i++)
         {
-            cgltf_node *node = &(data->nodes[i]);
+            cgltf_node *node = (scene != NULL)? NULL : &(data->nodes[i]);
 
-            cgltf_mesh *mesh = node->mesh;
+            cgltf_mesh *mesh = (scene != NULL)? &(data->meshes[i]) : node->mesh;
             if (!mesh)
                 continue;
 
-            cgltf_float worldTransform[16];
-            cgltf_node_transform_world(node, worldTransform);
+            cgltf_float worldTransform[16] = { 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1 };
+            if (node != NULL) cgltf_node_transform_world(node, worldTransform);
 
             Matrix worldMatrix = {
                 worldTransform[0], worldTransform[4], worldTransform[8], worldTransform[12],
@@ -5627,11 +7310,11 @@ static Model LoadGLTF(const char *fileName)
         }
 
         meshIndex = 0;
-        for (unsigned int i = 0; i < data->nodes_count; i++)
+        for (unsigned int i = 0; i < sourceCount; i++)
         {
-            cgltf_node *node = &(data->nodes[i]);
+            cgltf_node *node = (scene != NULL)? NULL : &(data->nodes[i]);
 
-            cgltf_mesh *mesh = node->mesh;
+            cgltf_mesh *mesh = (scene != NULL)? &(data->meshes[i]) : node->mesh;
             if (!mesh)
                 continue;
 
@@ -5760,6 +7443,9 @@ static Model LoadGLTF(const char *fileName)
 
         }
 
+        // Load scene nodes hierarchy, linked meshes are the unique meshes loaded above
+        if (scene != NULL) LoadSceneNodesGLTF(data, scene);
+
         // Free all cgltf loaded data
         cgltf_free(data);
     }
@@ -27,6 +27,13 @@
 *       #define MAX_TEXTSPLIT_COUNT
 *           TextSplit() function static substrings pointers array (pointing to static buffer)
 *
+*       #define RTEXT_NO_SIMD
+*           Disable SSE2/NEON text scanning on TextFindIndex(), LoadCodepoints() and GetCodepointCount()
+*
+*       #define TEXT_THREAD_LOCAL
+*           Storage qualifier for functions internal static buffers, thread local by default,
+*           every thread gets its own buffers [TextFormat(), TextSplit(), TextToUpper()...]
+*
 *   DEPENDENCIES:
 *       stb_truetype  - Load TTF file and rasterize characters data
 *       stb_rect_pack - Rectangles packing algorithms, required for font atlas generation
@@ -71,6 +78,17 @@
 #include <stdarg.h>         // Required for: va_list, va_start(), vsprintf(), va_end() [Used in TextFormat()]
 #include <ctype.h>          // Required for: toupper(), tolower() [Used in TextToUpper(), TextToLower()]
 
+// Text strings scanning SIMD support, it can be disabled with RTEXT_NO_SIMD
+#if !defined(RTEXT_NO_SIMD)
+    #if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+        #define RTEXT_SCAN_SSE2
+        #include <emmintrin.h>      // Required for: SSE2 intrinsics [Used in TextFindIndex(), LoadCodepoints(), GetCodepointCount()]
+    #elif defined(__aarch64__) || defined(_M_ARM64)
+        #define RTEXT_SCAN_NEON
+        #include <arm_neon.h>       // Required for: NEON intrinsics [Used in TextFindIndex(), LoadCodepoints(), GetCodepointCount()]
+    #endif
+#endif
+
 #if defined(SUPPORT_FILEFORMAT_TTF) || defined(SUPPORT_FILEFORMAT_BDF)
     #if defined(__GNUC__) // GCC and Clang
         #pragma GCC diagnostic push
@@ -100,6 +118,24 @@
     #if defined(__GNUC__) // GCC and Clang
         #pragma GCC diagnostic pop
     #endif
+
+    // Threads used to rasterize glyphs on font loading, not available on web
+    #if !defined(__EMSCRIPTEN__)
+        #define FONT_TTF_THREADS
+    #endif
+#endif
+
+#if defined(FONT_TTF_THREADS)
+    #if defined(_WIN32)
+        // NOTE: We declare required functions symbols to avoid including windows.h (kernel32.lib linkage required)
+        __declspec(dllimport) void *__stdcall CreateThread(void *threadAttributes, size_t stackSize, unsigned long (__stdcall *startAddress)(void *), void *parameter, unsigned long creationFlags, unsigned long *threadId);
+        __declspec(dllimport) unsigned long __stdcall WaitForSingleObject(void *handle, unsigned long milliseconds);
+        __declspec(dllimport) int __stdcall CloseHandle(void *handle);
+        __declspec(dllimport) unsigned long __stdcall GetActiveProcessorCount(unsigned short groupNumber);
+    #else
+        #include <pthread.h>        // Required for: pthread_create(), pthread_join() [Used in LoadFontData()]
+        #include <unistd.h>         // Required for: sysconf() [Used in LoadFontData()]
+    #endif
 #endif
 
 //----------------------------------------------------------------------------------
@@ -115,11 +151,199 @@
 #ifndef MAX_TEXTSPLIT_COUNT
     #define MAX_TEXTSPLIT_COUNT                  128        // Maximum number of substrings to split: TextSplit()
 #endif
+#ifndef MAX_TEXT_GLYPH_QUADS
+    #define MAX_TEXT_GLYPH_QUADS                  64        // Maximum glyphs quads staged before copying them to the render batch: DrawTextEx()
+#endif
+#ifndef FONT_CACHE_PAGE_SIZE
+    #define FONT_CACHE_PAGE_SIZE                 512        // Dynamic font glyph cache atlas page size (width and height in pixels)
+#endif
+#ifndef FONT_CACHE_MAX_PAGES
+    #define FONT_CACHE_MAX_PAGES                   8        // Dynamic font glyph cache maximum atlas pages, least recently used page is evicted
+#endif
+#ifndef FONT_CACHE_MAX_GLYPHS
+    #define FONT_CACHE_MAX_GLYPHS               4096        // Dynamic font glyph cache maximum glyphs cached at once
+#endif
+
+#ifndef FONT_TTF_MAX_THREADS
+    #define FONT_TTF_MAX_THREADS                   8        // Maximum threads to rasterize glyphs on TTF font loading, limited to processors count
+#endif
+#ifndef FONT_TTF_THREADS_MIN_GLYPHS
+    #define FONT_TTF_THREADS_MIN_GLYPHS          256        // Minimum glyphs count to rasterize glyphs with threads on TTF font loading
+#endif
+#ifndef FONT_ATLAS_MAX_SIZE
+    #define FONT_ATLAS_MAX_SIZE                16384        // Maximum font atlas size (width and height), used by skyline packing method
+#endif
+#ifndef FONT_ATLAS_PACK_METHOD
+    #define FONT_ATLAS_PACK_METHOD                 0        // Font atlas packing method on TTF/BDF font loading: 0-Default, 1-Skyline, 2-Skyline fitted to glyphs
+#endif
+#ifndef FONT_KERNING_MAX_QUERY_GLYPHS
+    #define FONT_KERNING_MAX_QUERY_GLYPHS        256        // Maximum glyphs to query kerning pairs one by one, fonts without kerning table (GPOS only)
+#endif
+#ifndef FONT_KERNING_DYNAMIC_LAST_CHAR
+    #define FONT_KERNING_DYNAMIC_LAST_CHAR     0x24f        // Dynamic fonts kerning pairs extracted for codepoints 32..last (Latin)
+#endif
+#ifndef FONT_BINARY_VERSION
+    #define FONT_BINARY_VERSION                  101        // Font binary file format version (.rfnt), files with other version are not loaded
+#endif
+#ifndef FONT_MSDF_CHAR_PADDING
+    #define FONT_MSDF_CHAR_PADDING                 4        // MSDF font generation char padding, distance field is kept inside padding
+#endif
+#ifndef FONT_MSDF_PIXEL_RANGE
+    #define FONT_MSDF_PIXEL_RANGE               4.0f        // MSDF font generation distance range in pixels (full channel range, half inside)
+#endif
+#ifndef FONT_MSDF_MAX_CURVE_STEPS
+    #define FONT_MSDF_MAX_CURVE_STEPS             16        // MSDF font generation maximum line segments to flatten an outline curve
+#endif
+
+// Thread local storage for internal static text buffers, it can be defined empty to disable it
+#ifndef TEXT_THREAD_LOCAL
+    #if defined(_MSC_VER)
+        #define TEXT_THREAD_LOCAL __declspec(thread)
+    #elif defined(__GNUC__) || defined(__clang__)
+        #define TEXT_THREAD_LOCAL __thread
+    #else
+        #define TEXT_THREAD_LOCAL
+    #endif
+#endif
+
+#define FONT_CACHE_HASH_SIZE        (2*FONT_CACHE_MAX_GLYPHS)   // Codepoints hash table size, must be a power of 2
+#define FONT_LIGATURES_COUNT                    6       // Supported ligatures count: ffi, ffl, ff, fi, fl, st
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-//...
+// Dynamic font glyph cache atlas page
+typedef struct FontCachePage {
+    Texture2D texture;          // Page texture (GRAY_ALPHA)
+    unsigned char *pixels;      // Page pixels copy in RAM (GRAY_ALPHA), modified rows are uploaded in batch
+    int glyphCount;             // Number of glyphs cached in the page
+    int shelfX;                 // Current shelf next free position X
+    int shelfY;                 // Current shelf position Y
+    int shelfHeight;            // Current shelf height
+    int dirtyTop;               // First row modified since last upload
+    int dirtyBottom;            // Last row modified since last upload (exclusive), 0 if page is not modified
+    unsigned int lastUsed;      // Last glyph use stamp, required for LRU eviction
+} FontCachePage;
+
+// Dynamic font glyph cache
+// NOTE: Glyph slots arrays are fixed size, so Font glyphs and recs can point to them
+struct rFontCache {
+    unsigned char *fileData;    // Font file data copy, required to rasterize glyphs on first use
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    stbtt_fontinfo fontInfo;    // Font info data
+#endif
+    int baseSize;               // Font base size (pixels height)
+    float scale;                // Font scale factor for base size
+    int ascent;                 // Font ascent, scaled to base size
+
+    GlyphInfo *glyphs;          // Glyph slots info data (FONT_CACHE_MAX_GLYPHS)
+    Rectangle *recs;            // Glyph slots rectangles in page texture (FONT_CACHE_MAX_GLYPHS)
+    int *glyphPages;            // Glyph slots page index, -1 if slot is free (FONT_CACHE_MAX_GLYPHS)
+    int *freeSlots;             // Free glyph slots stack (FONT_CACHE_MAX_GLYPHS)
+    int freeCount;              // Free glyph slots count
+
+    int *hashKeys;              // Codepoints hash table keys, -1 if entry is empty (FONT_CACHE_HASH_SIZE)
+    int *hashSlots;             // Codepoints hash table glyph slots (FONT_CACHE_HASH_SIZE)
+    int hashCount;              // Codepoints hash table entries count
+
+    FontCachePage pages[FONT_CACHE_MAX_PAGES];  // Atlas pages, created on demand
+    int pageCount;              // Atlas pages count
+    unsigned int useCounter;    // Glyph use stamp counter
+    unsigned int evictCount;    // Pages evicted count, required to detect glyphs evicted while refreshing a layout
+
+    unsigned char *bitmap;      // Glyph rasterization buffer (1 byte per pixel)
+};
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+// Font glyphs rasterization job, glyphs are processed interleaved by threads
+typedef struct FontGlyphsJob {
+    const stbtt_fontinfo *fontInfo; // Font info data
+    GlyphInfo *glyphs;          // Glyphs to fill
+    const int *codepoints;      // Glyphs codepoints
+    int glyphCount;             // Glyphs count
+    int fontSize;               // Font size (pixels height)
+    float scaleFactor;          // Font scale factor for font size
+    int ascent;                 // Font ascent (unscaled)
+    int type;                   // Font type: FONT_DEFAULT, FONT_BITMAP, FONT_SDF, FONT_MSDF
+    int first;                  // First glyph to process
+    int step;                   // Glyphs step between processed glyphs
+} FontGlyphsJob;
+
+// Font MSDF outline edge, curves are flattened into line segments
+typedef struct FontMSDFEdge {
+    int firstSegment;           // First edge segment index
+    int segmentCount;           // Edge segments count
+    int color;                  // Edge color channels mask: 1-Red, 2-Green, 4-Blue
+} FontMSDFEdge;
+
+// Font MSDF outline edge line segment
+typedef struct FontMSDFSegment {
+    Vector2 start;              // Segment start point (pixels)
+    Vector2 end;                // Segment end point (pixels)
+    int edge;                   // Segment edge index
+} FontMSDFSegment;
+#endif
+
+// Font kerning pair, advance adjustment between two codepoints
+typedef struct FontKerningPair {
+    int first;                  // First codepoint, 0 if hash table entry is empty
+    int second;                 // Second codepoint
+    float advance;              // Advance adjustment (scaled to font base size)
+} FontKerningPair;
+
+// Font text shaping data
+// NOTE: Kerning pairs are extracted on font loading, lookup does not require font data
+struct rFontShaping {
+    FontKerningPair *pairs;     // Kerning pairs hash table (hashSize)
+    int hashSize;               // Kerning pairs hash table size, power of 2
+    int pairCount;              // Kerning pairs count
+    int ligatures;              // Available ligatures mask, bit per fontLigatures[] entry
+};
+
+// Font binary file header (.rfnt)
+// NOTE: File data after header: glyphs info (value, offsetX, offsetY, advanceX), glyphs recs,
+// kerning pairs and atlas pixel data (compressed if atlasCompSize > 0), native byte order
+typedef struct FontBinaryHeader {
+    char id[4];                 // File identifier: "rFNT"
+    int version;                // File format version: 101
+    int baseSize;               // Font base size (default chars height)
+    int glyphCount;             // Number of glyph characters
+    int glyphPadding;           // Padding around the glyph characters
+    int type;                   // Font type (FontType), FONT_MSDF atlas requires bilinear filter
+    int atlasWidth;             // Atlas image width
+    int atlasHeight;            // Atlas image height
+    int atlasFormat;            // Atlas image pixel format (PixelFormat type)
+    int atlasDataSize;          // Atlas pixel data size in bytes
+    int atlasCompSize;          // Atlas pixel data compressed size in bytes (DEFLATE), 0 if not compressed
+    int pairCount;              // Kerning pairs count
+    int ligatures;              // Available ligatures mask, bit per fontLigatures[] entry
+} FontBinaryHeader;
+
+// Text glyphs quads staging buffer, quads sharing the same texture are copied in bulk to the render batch
+// NOTE: Glyphs quads are axis-aligned, transformation is applied by the render batch if required
+typedef struct TextGlyphQuads {
+    Font font;                  // Font used for the glyphs
+    float scaleFactor;          // Glyphs quads scaling factor (font size/font base size)
+    Color tint;                 // Glyphs tint color
+    Texture2D texture;          // Staged quads texture, dynamic fonts glyphs could use different cache pages
+    int quadCount;              // Staged quads count
+    float vertices[MAX_TEXT_GLYPH_QUADS*8];     // Quads vertex position (XY - 2 components per vertex, 4 vertex per quad)
+    float texcoords[MAX_TEXT_GLYPH_QUADS*8];    // Quads texture coordinates (UV - 2 components per vertex, 4 vertex per quad)
+} TextGlyphQuads;
+
+// Font atlas skyline node, top edge of packed area
+typedef struct FontAtlasNode {
+    int x;                      // Node position X
+    int y;                      // Node position Y (packed area bottom)
+    int width;                  // Node width
+} FontAtlasNode;
+
+// Font atlas rectangle to pack
+typedef struct FontAtlasRec {
+    int index;                  // Glyph index
+    int width;                  // Rectangle width (including padding)
+    int height;                 // Rectangle height (including padding)
+} FontAtlasRec;
 
 //----------------------------------------------------------------------------------
 // Global variables
@@ -131,6 +355,17 @@ extern bool isGpuReady;
 static Font defaultFont = { 0 };
 #endif
 
+// Supported ligatures: ligature codepoint and codepoints sequence replaced
+// NOTE: Longest sequences are checked first
+static const int fontLigatures[FONT_LIGATURES_COUNT][4] = {
+    { 0xfb03, 'f', 'f', 'i' },      // ffi
+    { 0xfb04, 'f', 'f', 'l' },      // ffl
+    { 0xfb00, 'f', 'f', 0 },        // ff
+    { 0xfb01, 'f', 'i', 0 },        // fi
+    { 0xfb02, 'f', 'l', 0 },        // fl
+    { 0xfb06, 's', 't', 0 }         // st
+};
+
 //----------------------------------------------------------------------------------
 // Other Modules Functions Declaration (required by text)
 //----------------------------------------------------------------------------------
@@ -146,6 +381,47 @@ static Font LoadBMFont(const char *fileName);   // Load a BMFont file (AngelCode
 static GlyphInfo *LoadFontDataBDF(const unsigned char *fileData, int dataSize, int *codepoints, int codepointCount, int *outFontSize);
 #endif
 static int textLineSpacing = 2;                 // Text vertical line spacing in pixels (between lines)
+static bool textLigatures = false;              // Text ligatures substitution enabled
+
+static rFontCache *LoadFontCache(const unsigned char *fileData, int dataSize, int fontSize, int padding); // Load dynamic font glyph cache
+static void UnloadFontCache(rFontCache *cache);                         // Unload dynamic font glyph cache
+static int GetFontCacheGlyph(rFontCache *cache, int codepoint, int padding); // Get glyph slot from dynamic font cache, rasterized if required
+static void UpdateFontCacheTextures(rFontCache *cache);                 // Update dynamic font cache pages textures with modified rows
+static void SetTextLayoutTexcoords(TextLayout layout, int quad);        // Set text layout glyph quad texture coordinates
+static void InitTextGlyphQuads(TextGlyphQuads *quads, Font font, float fontSize, Color tint); // Init text glyphs quads staging buffer
+static void AddTextGlyphQuad(TextGlyphQuads *quads, int index, float x, float y); // Add glyph quad to staging buffer, staged quads are drawn if required
+static void DrawTextGlyphQuads(TextGlyphQuads *quads);                  // Draw staged glyphs quads, copied in bulk to the render batch
+static rFontShaping *LoadFontShaping(const FontKerningPair *pairs, int pairCount, const int *codepoints, int codepointCount); // Load font shaping data
+static void UnloadFontShaping(rFontShaping *shaping);                   // Unload font shaping data
+static float GetFontShapingKerning(const rFontShaping *shaping, int codepoint, int nextCodepoint); // Get kerning advance between two codepoints
+static int GetFontShapingLigature(const rFontShaping *shaping, int codepoint, int next, int nextNext, int *length); // Get ligature replacing a codepoints sequence
+static int GetTextCodepointNext(Font font, const char *text, int *codepointByteCount); // Get next text codepoint, ligatures substituted if enabled
+static float MeasureTextLine(Font font, const char *text, int length, float fontSize, float spacing); // Measure text line width, text length in bytes
+#if defined(SUPPORT_FILEFORMAT_TTF)
+static rFontShaping *LoadFontShapingTTF(const unsigned char *fileData, int fontSize, const int *codepoints, int codepointCount); // Load font shaping data from TTF font data
+#endif
+#if defined(SUPPORT_FILEFORMAT_TTF)
+static void LoadFontGlyphs(FontGlyphsJob *job);                         // Load font glyphs data for a rasterization job
+static unsigned char *GenFontGlyphMSDF(const stbtt_fontinfo *fontInfo, int index, float scale, int *width, int *height, int *offsetX, int *offsetY); // Generate glyph MSDF image data
+#endif
+#if defined(FONT_TTF_THREADS)
+#if defined(_WIN32)
+static unsigned long __stdcall LoadFontGlyphsThread(void *job);         // Load font glyphs thread
+#else
+static void *LoadFontGlyphsThread(void *job);                           // Load font glyphs thread
+#endif
+#endif
+static int PackFontAtlasSkyline(const GlyphInfo *glyphs, int glyphCount, int padding, Rectangle *recs, int *atlasWidth, int *atlasHeight, float *packedArea); // Pack font atlas rectangles with skyline algorithm
+static int FindTextIndex(const char *text, int textLength, const char *find, int findLength); // Find first text occurrence within a text of known length
+#if defined(RTEXT_SCAN_NEON)
+static unsigned int GetTextScanMask(uint8x16_t compare);               // Get bytes comparison mask from NEON vector, one bit per byte
+#endif
+#if defined(RTEXT_SCAN_SSE2) || defined(RTEXT_SCAN_NEON)
+static int GetTextScanMaskFirst(unsigned int mask);                     // Get first set bit position in a bytes mask
+#endif
+static int DecodeTextUTF8(const char *text, int length, int *codepoints); // Decode UTF-8 text into codepoints, returns codepoints count
+static void WriteTextBuffer(char *buffer, int bufferSize, int position, const char *text, int length); // Write text bytes into buffer at position, truncated to buffer size
+static void EndTextBuffer(char *buffer, int bufferSize, int length);   // Write text buffer '\0' ending, truncated to buffer size
 
 #if defined(SUPPORT_DEFAULT_FONT)
 extern void LoadFontDefault(void);
@@ -357,6 +633,8 @@ Font LoadFont(const char *fileName)
     if (IsFileExtension(fileName, ".bdf")) font = LoadFontEx(fileName, FONT_TTF_DEFAULT_SIZE, NULL, FONT_TTF_DEFAULT_NUMCHARS);
     else
 #endif
+    if (IsFileExtension(fileName, ".rfnt")) font = LoadFontBinary(fileName);
+    else
     {
         Image image = LoadImage(fileName);
         if (image.data != NULL) font = LoadFontFromImage(image, MAGENTA, FONT_TTF_DEFAULT_FIRST_CHAR);
@@ -368,7 +646,9 @@ Font LoadFont(const char *fileName)
         if (font.texture.id == 0) TRACELOG(LOG_WARNING, "FONT: [%s] Failed to load font texture -> Using default font", fileName);
         else
         {
-            SetTextureFilter(font.texture, TEXTURE_FILTER_POINT);    // By default, we set point filter (the best performance)
+            // By default, we set point filter (the best performance), MSDF fonts require bilinear filter
+            if (font.type == FONT_MSDF) SetTextureFilter(font.texture, TEXTURE_FILTER_BILINEAR);
+            else SetTextureFilter(font.texture, TEXTURE_FILTER_POINT);
             TRACELOG(LOG_INFO, "FONT: Data loaded successfully (%i pixel size | %i glyphs)", FONT_TTF_DEFAULT_SIZE, FONT_TTF_DEFAULT_NUMCHARS);
         }
     }
@@ -529,7 +809,7 @@ Font LoadFontFromMemory(const char *fileType, const unsigned char *fileData, int
     Font font = { 0 };
 
     char fileExtLower[16] = { 0 };
-    strncpy(fileExtLower, TextToLower(fileType), 16 - 1);
+    TextToLowerBuffer(fileExtLower, 16, fileType);
 
     font.baseSize = fontSize;
     font.glyphCount = (codepointCount > 0)? codepointCount : 95;
@@ -559,7 +839,7 @@ Font LoadFontFromMemory(const char *fileType, const unsigned char *fileData, int
     {
         font.glyphPadding = FONT_TTF_DEFAULT_CHARS_PADDING;
 
-        Image atlas = GenImageFontAtlas(font.glyphs, &font.recs, font.glyphCount, font.baseSize, font.glyphPadding, 0);
+        Image atlas = GenImageFontAtlas(font.glyphs, &font.recs, font.glyphCount, font.baseSize, font.glyphPadding, FONT_ATLAS_PACK_METHOD);
         if (isGpuReady) font.texture = LoadTextureFromImage(atlas);
 
         // Update glyphs[i].image to use alpha, required to be used on ImageDrawText()
@@ -571,6 +851,19 @@ Font LoadFontFromMemory(const char *fileType, const unsigned char *fileData, int
 
         UnloadImage(atlas);
 
+#if defined(SUPPORT_FILEFORMAT_TTF)
+        // Extract kerning pairs between loaded glyphs and available ligatures
+        if (TextIsEqual(fileExtLower, ".ttf") || TextIsEqual(fileExtLower, ".otf"))
+        {
+            int *glyphCodepoints = (int *)RL_MALLOC(font.glyphCount*sizeof(int));
+            for (int i = 0; i < font.glyphCount; i++) glyphCodepoints[i] = font.glyphs[i].value;
+
+            font.shaping = LoadFontShapingTTF(fileData, font.baseSize, glyphCodepoints, font.glyphCount);
+
+            RL_FREE(glyphCodepoints);
+        }
+#endif
+
         TRACELOG(LOG_INFO, "FONT: Data loaded successfully (%i pixel size | %i glyphs)", font.baseSize, font.glyphCount);
     }
     else font = GetFontDefault();
@@ -581,9 +874,346 @@ Font LoadFontFromMemory(const char *fileType, const unsigned char *fileData, int
     return font;
 }
 
+// Load font from file in dynamic mode, glyphs are rasterized on first use into a glyph cache atlas
+// NOTE: Font file data is kept in memory, atlas pages are added on demand
+Font LoadFontDynamic(const char *fileName, int fontSize)
+{
+    Font font = { 0 };
+
+    int dataSize = 0;
+    unsigned char *fileData = LoadFileData(fileName, &dataSize);
+
+    if (fileData != NULL)
+    {
+        font = LoadFontDynamicFromMemory(GetFileExtension(fileName), fileData, dataSize, fontSize);
+        UnloadFileData(fileData);
+    }
+    else font = GetFontDefault();
+
+    return font;
+}
+
+// Load font from memory buffer in dynamic mode, fileType refers to extension: i.e. ".ttf"
+// NOTE: Only TTF/OTF fonts are supported, font data is copied internally
+Font LoadFontDynamicFromMemory(const char *fileType, const unsigned char *fileData, int dataSize, int fontSize)
+{
+    Font font = { 0 };
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    char fileExtLower[16] = { 0 };
+    TextToLowerBuffer(fileExtLower, 16, fileType);
+
+    if ((fontSize > 0) && (TextIsEqual(fileExtLower, ".ttf") || TextIsEqual(fileExtLower, ".otf")))
+    {
+        font.cache = LoadFontCache(fileData, dataSize, fontSize, FONT_TTF_DEFAULT_CHARS_PADDING);
+    }
+    else TRACELOG(LOG_WARNING, "FONT: Dynamic font requires TTF/OTF font data");
+
+    if (font.cache != NULL)
+    {
+        font.baseSize = fontSize;
+        font.glyphPadding = FONT_TTF_DEFAULT_CHARS_PADDING;
+        font.texture = font.cache->pages[0].texture;
+
+        // Glyph slots arrays are fixed, glyphs are indexed by slot
+        font.glyphs = font.cache->glyphs;
+        font.recs = font.cache->recs;
+
+        // Glyphs are not known in advance, kerning pairs are extracted for Latin codepoints and ligatures
+        int codepointCount = FONT_KERNING_DYNAMIC_LAST_CHAR - 32 + 1 + FONT_LIGATURES_COUNT;
+        int *codepoints = (int *)RL_MALLOC(codepointCount*sizeof(int));
+        for (int i = 0; i < (FONT_KERNING_DYNAMIC_LAST_CHAR - 32 + 1); i++) codepoints[i] = 32 + i;
+        for (int l = 0; l < FONT_LIGATURES_COUNT; l++) codepoints[codepointCount - FONT_LIGATURES_COUNT + l] = fontLigatures[l][0];
+
+        font.shaping = LoadFontShapingTTF(font.cache->fileData, font.baseSize, codepoints, codepointCount);
+
+        RL_FREE(codepoints);
+
+        TRACELOG(LOG_INFO, "FONT: Dynamic font loaded successfully (%i pixel size | glyphs rasterized on first use)", font.baseSize);
+    }
+    else font = GetFontDefault();
+#else
+    TRACELOG(LOG_WARNING, "FONT: Dynamic font requires TTF/OTF support");
+    font = GetFontDefault();
+#endif
+
+    return font;
+}
+
+// Load font from TTF file as multi-channel SDF (MSDF) atlas, distance fields are generated at fontSize
+// NOTE: Font requires MSDF shader to be drawn, one atlas can be drawn at any size
+Font LoadFontMSDF(const char *fileName, int fontSize, int *codepoints, int codepointCount)
+{
+    Font font = { 0 };
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    int dataSize = 0;
+    unsigned char *fileData = LoadFileData(fileName, &dataSize);
+
+    if (fileData != NULL)
+    {
+        font.baseSize = fontSize;
+        font.glyphCount = (codepointCount > 0)? codepointCount : 95;
+        font.glyphPadding = 1;      // Glyphs images already contain distance field padding
+        font.type = FONT_MSDF;
+
+        font.glyphs = LoadFontData(fileData, dataSize, font.baseSize, codepoints, font.glyphCount, FONT_MSDF);
+
+        if (font.glyphs != NULL)
+        {
+            int *glyphCodepoints = (int *)RL_MALLOC(font.glyphCount*sizeof(int));
+            for (int i = 0; i < font.glyphCount; i++) glyphCodepoints[i] = font.glyphs[i].value;
+
+            font.shaping = LoadFontShapingTTF(fileData, font.baseSize, glyphCodepoints, font.glyphCount);
+
+            RL_FREE(glyphCodepoints);
+        }
+
+        UnloadFileData(fileData);
+    }
+
+    if (font.glyphs != NULL)
+    {
+        Image atlas = GenImageFontAtlas(font.glyphs, &font.recs, font.glyphCount, font.baseSize, font.glyphPadding, 2);
+
+        if (isGpuReady)
+        {
+            font.texture = LoadTextureFromImage(atlas);
+            SetTextureFilter(font.texture, TEXTURE_FILTER_BILINEAR);    // Distance field must be interpolated
+        }
+
+        UnloadImage(atlas);
+
+        TRACELOG(LOG_INFO, "FONT: [%s] MSDF font loaded successfully (%i pixel size | %i glyphs)", fileName, font.baseSize, font.glyphCount);
+    }
+    else font = GetFontDefault();
+#else
+    TRACELOG(LOG_WARNING, "FONT: MSDF font requires TTF/OTF support");
+    font = GetFontDefault();
+#endif
+
+    return font;
+}
+
+// Load built-in shader to draw multi-channel SDF fonts
+// NOTE: Default vertex shader is used, glyph edge is antialiased from screen space distance derivative,
+// shader id is 0 if current graphics API does not support shaders (OpenGL 1.1)
+Shader LoadShaderMSDF(void)
+{
+    const char *msdfFShaderCode =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+    "uniform sampler2D texture0;        \n"
+    "uniform vec4 colDiffuse;           \n"
+    "float median(vec3 c) { return max(min(c.r, c.g), min(max(c.r, c.g), c.b)); } \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    float distance = median(texture2D(texture0, fragTexCoord).rgb) - 0.5;    \n"
+    "    float alpha = clamp(distance/max(fwidth(distance), 0.0001) + 0.5, 0.0, 1.0); \n"
+    "    gl_FragColor = vec4(fragColor.rgb*colDiffuse.rgb, fragColor.a*colDiffuse.a*alpha); \n"
+    "}                                  \n";
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330                       \n"
+    "in vec2 fragTexCoord;              \n"
+    "in vec4 fragColor;                 \n"
+    "out vec4 finalColor;               \n"
+    "uniform sampler2D texture0;        \n"
+    "uniform vec4 colDiffuse;           \n"
+    "float median(vec3 c) { return max(min(c.r, c.g), min(max(c.r, c.g), c.b)); } \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    float distance = median(texture(texture0, fragTexCoord).rgb) - 0.5;      \n"
+    "    float alpha = clamp(distance/max(fwidth(distance), 0.0001) + 0.5, 0.0, 1.0); \n"
+    "    finalColor = vec4(fragColor.rgb*colDiffuse.rgb, fragColor.a*colDiffuse.a*alpha); \n"
+    "}                                  \n";
+#elif defined(GRAPHICS_API_OPENGL_ES3)
+    "#version 300 es                    \n"
+    "precision mediump float;           \n"
+    "in vec2 fragTexCoord;              \n"
+    "in vec4 fragColor;                 \n"
+    "out vec4 finalColor;               \n"
+    "uniform sampler2D texture0;        \n"
+    "uniform vec4 colDiffuse;           \n"
+    "float median(vec3 c) { return max(min(c.r, c.g), min(max(c.r, c.g), c.b)); } \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    float distance = median(texture(texture0, fragTexCoord).rgb) - 0.5;      \n"
+    "    float alpha = clamp(distance/max(fwidth(distance), 0.0001) + 0.5, 0.0, 1.0); \n"
+    "    finalColor = vec4(fragColor.rgb*colDiffuse.rgb, fragColor.a*colDiffuse.a*alpha); \n"
+    "}                                  \n";
+#elif defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "#extension GL_OES_standard_derivatives : enable \n"    // Required for fwidth()
+    "precision mediump float;           \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+    "uniform sampler2D texture0;        \n"
+    "uniform vec4 colDiffuse;           \n"
+    "float median(vec3 c) { return max(min(c.r, c.g), min(max(c.r, c.g), c.b)); } \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    float distance = median(texture2D(texture0, fragTexCoord).rgb) - 0.5;    \n"
+    "    float alpha = clamp(distance/max(fwidth(distance), 0.0001) + 0.5, 0.0, 1.0); \n"
+    "    gl_FragColor = vec4(fragColor.rgb*colDiffuse.rgb, fragColor.a*colDiffuse.a*alpha); \n"
+    "}                                  \n";
+#else
+    NULL;
+#endif
+
+    // Shaders are not available on OpenGL 1.1, an invalid shader is returned
+    if (msdfFShaderCode == NULL)
+    {
+        TRACELOG(LOG_WARNING, "SHADER: MSDF shader not supported by current graphics API, requires OpenGL 2.1, 3.3, ES2 or ES3");
+        return (Shader){ 0 };
+    }
+
+    return LoadShaderFromMemory(NULL, msdfFShaderCode);
+}
+
+// Load font from binary file (.rfnt), atlas and metrics are loaded with one file read and one texture upload
+// NOTE: File is generated with ExportFontBinary(), compressed atlas requires SUPPORT_COMPRESSION_API
+Font LoadFontBinary(const char *fileName)
+{
+    Font font = { 0 };
+
+    int dataSize = 0;
+    unsigned char *fileData = LoadFileData(fileName, &dataSize);
+
+    if (fileData == NULL) return GetFontDefault();
+
+    FontBinaryHeader header = { 0 };
+    if (dataSize >= (int)sizeof(FontBinaryHeader)) memcpy(&header, fileData, sizeof(FontBinaryHeader));
+
+    // Validate file header and data sizes
+    int glyphsSize = header.glyphCount*(4*sizeof(int) + sizeof(Rectangle));
+    int pairsSize = header.pairCount*sizeof(FontKerningPair);
+    int atlasSize = (header.atlasCompSize > 0)? header.atlasCompSize : header.atlasDataSize;
+
+    if ((memcmp(header.id, "rFNT", 4) != 0) || (header.version != FONT_BINARY_VERSION) ||
+        (header.atlasWidth <= 0) || (header.atlasHeight <= 0) || (header.atlasWidth > FONT_ATLAS_MAX_SIZE) || (header.atlasHeight > FONT_ATLAS_MAX_SIZE) ||
+        (header.glyphCount <= 0) || (header.glyphCount > 0x10ffff) || (header.pairCount < 0) || (header.pairCount > 0x1000000) || (header.glyphPadding < 0) ||
+        (header.atlasFormat < PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) || (header.atlasFormat > PIXELFORMAT_UNCOMPRESSED_R16G16B16A16) ||
+        (header.atlasDataSize != GetPixelDataSize(header.atlasWidth, header.atlasHeight, header.atlasFormat)) || (atlasSize <= 0) ||
+        ((dataSize - (int)sizeof(FontBinaryHeader) - glyphsSize - pairsSize) < atlasSize))
+    {
+        TRACELOG(LOG_WARNING, "FONT: [%s] Font binary file not valid", fileName);
+        UnloadFileData(fileData);
+        return GetFontDefault();
+    }
+
+    const unsigned char *glyphsData = fileData + sizeof(FontBinaryHeader);
+    const unsigned char *recsData = glyphsData + header.glyphCount*4*sizeof(int);
+    const unsigned char *pairsData = recsData + header.glyphCount*sizeof(Rectangle);
+    const unsigned char *atlasData = pairsData + pairsSize;
+
+    // Validate glyphs recs, glyphs images are copied from atlas with ImageFromImage(), not bounds checked
+    // NOTE: Recs must be integral (pixels) and fit into atlas, NaN values fail the comparisons
+    for (int i = 0; i < header.glyphCount; i++)
+    {
+        Rectangle rec = { 0 };
+        memcpy(&rec, recsData + i*sizeof(Rectangle), sizeof(Rectangle));
+
+        if (!((rec.x >= 0.0f) && (rec.y >= 0.0f) && (rec.width >= 0.0f) && (rec.height >= 0.0f) &&
+              ((rec.x + rec.width) <= (float)header.atlasWidth) && ((rec.y + rec.height) <= (float)header.atlasHeight) &&
+              (rec.x == (float)(int)rec.x) && (rec.y == (float)(int)rec.y) && (rec.width == (float)(int)rec.width) && (rec.height == (float)(int)rec.height)))
+        {
+            TRACELOG(LOG_WARNING, "FONT: [%s] Font binary file not valid, glyph rectangle out of atlas", fileName);
+            UnloadFileData(fileData);
+            return GetFontDefault();
+        }
+    }
+
+    // Load atlas image, decompressed if required
+    Image atlas = { 0 };
+    atlas.width = header.atlasWidth;
+    atlas.height = header.atlasHeight;
+    atlas.mipmaps = 1;
+    atlas.format = header.atlasFormat;
+
+    if (header.atlasCompSize > 0)
+    {
+#if defined(SUPPORT_COMPRESSION_API)
+        int atlasDataSize = 0;
+        atlas.data = DecompressData(atlasData, header.atlasCompSize, &atlasDataSize);
+
+        if ((atlas.data != NULL) && (atlasDataSize != header.atlasDataSize))
+        {
+            RL_FREE(atlas.data);
+            atlas.data = NULL;
+        }
+#endif
+    }
+    else
+    {
+        atlas.data = RL_MALLOC(header.atlasDataSize);
+        memcpy(atlas.data, atlasData, header.atlasDataSize);
+    }
+
+    if (atlas.data == NULL)
+    {
+        TRACELOG(LOG_WARNING, "FONT: [%s] Failed to load font binary atlas", fileName);
+        UnloadFileData(fileData);
+        return GetFontDefault();
+    }
+
+    font.baseSize = header.baseSize;
+    font.glyphCount = header.glyphCount;
+    font.glyphPadding = header.glyphPadding;
+    font.type = header.type;
+    font.glyphs = (GlyphInfo *)RL_CALLOC(font.glyphCount, sizeof(GlyphInfo));
+    font.recs = (Rectangle *)RL_MALLOC(font.glyphCount*sizeof(Rectangle));
+    memcpy(font.recs, recsData, font.glyphCount*sizeof(Rectangle));
+
+    for (int i = 0; i < font.glyphCount; i++)
+    {
+        int info[4] = { 0 };
+        memcpy(info, glyphsData + i*sizeof(info), sizeof(info));
+
+        font.glyphs[i].value = info[0];
+        font.glyphs[i].offsetX = info[1];
+        font.glyphs[i].offsetY = info[2];
+        font.glyphs[i].advanceX = info[3];
+
+        // NOTE: Glyph images are required to be used on ImageDrawText()
+        font.glyphs[i].image = ImageFromImage(atlas, font.recs[i]);
+    }
+
+    // Load kerning pairs and available ligatures
+    // NOTE: Ligatures are available only if their glyph is defined in font file, not only requested on loading
+    FontKerningPair *pairs = (FontKerningPair *)RL_MALLOC((header.pairCount + 1)*sizeof(FontKerningPair));
+    memcpy(pairs, pairsData, pairsSize);
+
+    int ligatures[FONT_LIGATURES_COUNT] = { 0 };
+    int ligatureCount = 0;
+    for (int l = 0; l < FONT_LIGATURES_COUNT; l++) if (header.ligatures & (1 << l)) ligatures[ligatureCount++] = fontLigatures[l][0];
+
+    font.shaping = LoadFontShaping(pairs, header.pairCount, ligatures, ligatureCount);
+    RL_FREE(pairs);
+
+    if (isGpuReady)
+    {
+        font.texture = LoadTextureFromImage(atlas);
+
+        // MSDF fonts distance field must be interpolated
+        if (font.type == FONT_MSDF) SetTextureFilter(font.texture, TEXTURE_FILTER_BILINEAR);
+    }
+
+    UnloadImage(atlas);
+    UnloadFileData(fileData);
+
+    TRACELOG(LOG_INFO, "FONT: [%s] Font binary loaded successfully (%i pixel size | %i glyphs | %i kerning pairs)", fileName, font.baseSize, font.glyphCount, header.pairCount);
+
+    return font;
+}
+
 // Check if a font is ready
 bool IsFontReady(Font font)
 {
+    // Dynamic fonts rasterize glyphs on first use, no glyph is available after loading
+    if (font.cache != NULL) return ((font.texture.id > 0) && (font.baseSize > 0));
+
     return ((font.texture.id > 0) &&    // Validate OpenGL id for font texture atlas
             (font.baseSize > 0) &&      // Validate font size
             (font.glyphCount > 0) &&    // Validate font contains some glyph
@@ -647,81 +1277,74 @@ GlyphInfo *LoadFontData(const unsigned char *fileData, int dataSize, int fontSiz
 
             chars = (GlyphInfo *)RL_CALLOC(codepointCount, sizeof(GlyphInfo));
 
-            // NOTE: Using simple packaging, one char after another
-            for (int i = 0; i < codepointCount; i++)
-            {
-                int chw = 0, chh = 0;   // Character width and height (on generation)
-                int ch = codepoints[i];  // Character value to get info for
-                chars[i].value = ch;
+            FontGlyphsJob job = { &fontInfo, chars, codepoints, codepointCount, fontSize, scaleFactor, ascent, type, 0, 1 };
 
-                //  Render a unicode codepoint to a bitmap
-                //      stbtt_GetCodepointBitmap()           -- allocates and returns a bitmap
-                //      stbtt_GetCodepointBitmapBox()        -- how big the bitmap must be
-                //      stbtt_MakeCodepointBitmap()          -- renders into bitmap you provide
+#if defined(FONT_TTF_THREADS)
+            int threadCount = 1;
 
-                // Check if a glyph is available in the font
-                // WARNING: if (index == 0), glyph not found, it could fallback to default .notdef glyph (if defined in font)
-                int index = stbtt_FindGlyphIndex(&fontInfo, ch);
+            // Glyphs are rasterized independently, big charsets are split between threads
+            if (codepointCount >= FONT_TTF_THREADS_MIN_GLYPHS)
+            {
+            #if defined(_WIN32)
+                threadCount = (int)GetActiveProcessorCount(0xffff);     // ALL_PROCESSOR_GROUPS
+            #elif defined(_SC_NPROCESSORS_ONLN)
+                threadCount = (int)sysconf(_SC_NPROCESSORS_ONLN);
+            #endif
+                if (threadCount > FONT_TTF_MAX_THREADS) threadCount = FONT_TTF_MAX_THREADS;
+                if (threadCount < 1) threadCount = 1;
+            }
 
-                if (index > 0)
+            if (threadCount > 1)
+            {
+                FontGlyphsJob jobs[FONT_TTF_MAX_THREADS] = { 0 };
+            #if defined(_WIN32)
+                void *threads[FONT_TTF_MAX_THREADS] = { 0 };
+            #else
+                pthread_t threads[FONT_TTF_MAX_THREADS] = { 0 };
+            #endif
+                bool started[FONT_TTF_MAX_THREADS] = { 0 };
+
+                // NOTE: Calling thread processes first job, jobs could be
+                // processed on calling thread if threads creation fails
+                for (int t = 0; t < threadCount; t++)
                 {
-                    switch (type)
-                    {
-                        case FONT_DEFAULT:
-                        case FONT_BITMAP: chars[i].image.data = stbtt_GetCodepointBitmap(&fontInfo, scaleFactor, scaleFactor, ch, &chw, &chh, &chars[i].offsetX, &chars[i].offsetY); break;
-                        case FONT_SDF: if (ch != 32) chars[i].image.data = stbtt_GetCodepointSDF(&fontInfo, scaleFactor, ch, FONT_SDF_CHAR_PADDING, FONT_SDF_ON_EDGE_VALUE, FONT_SDF_PIXEL_DIST_SCALE, &chw, &chh, &chars[i].offsetX, &chars[i].offsetY); break;
-                        default: break;
-                    }
+                    jobs[t] = job;
+                    jobs[t].first = t;
+                    jobs[t].step = threadCount;
 
-                    if (chars[i].image.data != NULL)    // Glyph data has been found in the font
+                    if (t > 0)
                     {
-                        stbtt_GetCodepointHMetrics(&fontInfo, ch, &chars[i].advanceX, NULL);
-                        chars[i].advanceX = (int)((float)chars[i].advanceX*scaleFactor);
-                        
-                        if (chh > fontSize) TRACELOG(LOG_WARNING, "FONT: Character [0x%08x] size is bigger than expected font size", ch);
-
-                        // Load characters images
-                        chars[i].image.width = chw;
-                        chars[i].image.height = chh;
-                        chars[i].image.mipmaps = 1;
-                        chars[i].image.format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
-
-                        chars[i].offsetY += (int)((float)ascent*scaleFactor);
+                    #if defined(_WIN32)
+                        threads[t] = CreateThread(NULL, 0, LoadFontGlyphsThread, &jobs[t], 0, NULL);
+                        started[t] = (threads[t] != NULL);
+                    #else
+                        started[t] = (pthread_create(&threads[t], NULL, LoadFontGlyphsThread, &jobs[t]) == 0);
+                    #endif
                     }
+                }
 
-                    // NOTE: We create an empty image for space character,
-                    // it could be further required for atlas packing
-                    if (ch == 32)
-                    {
-                        stbtt_GetCodepointHMetrics(&fontInfo, ch, &chars[i].advanceX, NULL);
-                        chars[i].advanceX = (int)((float)chars[i].advanceX*scaleFactor);
-
-                        Image imSpace = {
-                            .data = RL_CALLOC(chars[i].advanceX*fontSize, 2),
-                            .width = chars[i].advanceX,
-                            .height = fontSize,
-                            .mipmaps = 1,
-                            .format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE
-                        };
-
-                        chars[i].image = imSpace;
-                    }
+                LoadFontGlyphs(&jobs[0]);
 
-                    if (type == FONT_BITMAP)
+                for (int t = 1; t < threadCount; t++)
+                {
+                    if (started[t])
                     {
-                        // Aliased bitmap (black & white) font generation, avoiding anti-aliasing
-                        // NOTE: For optimum results, bitmap font should be generated at base pixel size
-                        for (int p = 0; p < chw*chh; p++)
-                        {
-                            if (((unsigned char *)chars[i].image.data)[p] < FONT_BITMAP_ALPHA_THRESHOLD) ((unsigned char *)chars[i].image.data)[p] = 0;
-                            else ((unsigned char *)chars[i].image.data)[p] = 255;
-                        }
+                    #if defined(_WIN32)
+                        WaitForSingleObject(threads[t], 0xffffffff);    // INFINITE
+                        CloseHandle(threads[t]);
+                    #else
+                        pthread_join(threads[t], NULL);
+                    #endif
                     }
+                    else LoadFontGlyphs(&jobs[t]);
                 }
-                else
-                {
-                    // TODO: Use some fallback glyph for codepoints not found in the font
-                }
+
+                TRACELOGD("FONT: Glyphs rasterized (%i glyphs | %i threads)", codepointCount, threadCount);
+            }
+            else
+#endif
+            {
+                LoadFontGlyphs(&job);
             }
         }
         else TRACELOG(LOG_WARNING, "FONT: Failed to process TTF font data");
@@ -734,7 +1357,7 @@ GlyphInfo *LoadFontData(const unsigned char *fileData, int dataSize, int fontSiz
 }
 
 // Generate image font atlas using chars info
-// NOTE: Packing method: 0-Default, 1-Skyline
+// NOTE: Packing method: 0-Default, 1-Skyline, 2-Skyline with identical glyphs sharing rectangle and atlas size fitted to glyphs
 #if defined(SUPPORT_FILEFORMAT_TTF) || defined(SUPPORT_FILEFORMAT_BDF)
 Image GenImageFontAtlas(const GlyphInfo *glyphs, Rectangle **glyphRecs, int glyphCount, int fontSize, int padding, int packMethod)
 {
@@ -797,8 +1420,32 @@ Image GenImageFontAtlas(const GlyphInfo *glyphs, Rectangle **glyphRecs, int glyp
     }
 #endif
 
-    atlas.data = (unsigned char *)RL_CALLOC(1, atlas.width*atlas.height);   // Create a bitmap to store characters (8 bpp)
-    atlas.format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
+    // Skyline packing fits atlas size to glyphs, rectangles are computed before atlas allocation
+    int uniqueCount = glyphCount;
+    float packedArea = 0.0f;
+    if (packMethod == 2)
+    {
+        uniqueCount = PackFontAtlasSkyline(glyphs, glyphCount, padding, recs, &atlas.width, &atlas.height, &packedArea);
+
+        // Glyphs not fitting in maximum atlas size fallback to stb_pack_rect packing on estimated atlas size
+        if (uniqueCount < 0)
+        {
+            TRACELOG(LOG_WARNING, "FONT: Failed to package characters in %ix%i atlas, using default skyline packing", FONT_ATLAS_MAX_SIZE, FONT_ATLAS_MAX_SIZE);
+            uniqueCount = glyphCount;
+            packedArea = 0.0f;
+            packMethod = 1;
+        }
+    }
+
+    // MSDF glyphs use three channels (RGB), atlas keeps glyphs pixel format
+    int bytesPerPixel = 1;
+    for (int i = 0; i < glyphCount; i++)
+    {
+        if ((glyphs[i].image.data != NULL) && (glyphs[i].image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8)) { bytesPerPixel = 3; break; }
+    }
+
+    atlas.data = (unsigned char *)RL_CALLOC(bytesPerPixel, atlas.width*atlas.height);   // Create a bitmap to store characters (8 bpp or 24 bpp)
+    atlas.format = (bytesPerPixel == 3)? PIXELFORMAT_UNCOMPRESSED_R8G8B8 : PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
     atlas.mipmaps = 1;
 
     // DEBUG: We can see padding in the generated image setting a gray background...
@@ -840,9 +1487,9 @@ Image GenImageFontAtlas(const GlyphInfo *glyphs, Rectangle **glyphRecs, int glyp
             // Copy pixel data from glyph image to atlas
             for (int y = 0; y < glyphs[i].image.height; y++)
             {
-                for (int x = 0; x < glyphs[i].image.width; x++)
+                for (int x = 0; x < glyphs[i].image.width*bytesPerPixel; x++)
                 {
-                    ((unsigned char *)atlas.data)[(offsetY + y)*atlas.width + (offsetX + x)] = ((unsigned char *)glyphs[i].image.data)[y*glyphs[i].image.width + x];
+                    ((unsigned char *)atlas.data)[((offsetY + y)*atlas.width + offsetX)*bytesPerPixel + x] = ((unsigned char *)glyphs[i].image.data)[y*glyphs[i].image.width*bytesPerPixel + x];
                 }
             }
 
@@ -888,9 +1535,9 @@ Image GenImageFontAtlas(const GlyphInfo *glyphs, Rectangle **glyphRecs, int glyp
                 // Copy pixel data from fc.data to atlas
                 for (int y = 0; y < glyphs[i].image.height; y++)
                 {
-                    for (int x = 0; x < glyphs[i].image.width; x++)
+                    for (int x = 0; x < glyphs[i].image.width*bytesPerPixel; x++)
                     {
-                        ((unsigned char *)atlas.data)[(rects[i].y + padding + y)*atlas.width + (rects[i].x + padding + x)] = ((unsigned char *)glyphs[i].image.data)[y*glyphs[i].image.width + x];
+                        ((unsigned char *)atlas.data)[((rects[i].y + padding + y)*atlas.width + rects[i].x + padding)*bytesPerPixel + x] = ((unsigned char *)glyphs[i].image.data)[y*glyphs[i].image.width*bytesPerPixel + x];
                     }
                 }
             }
@@ -901,32 +1548,56 @@ Image GenImageFontAtlas(const GlyphInfo *glyphs, Rectangle **glyphRecs, int glyp
         RL_FREE(nodes);
         RL_FREE(context);
     }
+    else if (packMethod == 2)  // Use Skyline rect packing algorithm, rectangles already packed
+    {
+        for (int i = 0; i < glyphCount; i++)
+        {
+            // NOTE: Identical glyphs share rectangle, pixel data is just copied again
+            for (int y = 0; y < (int)recs[i].height; y++)
+            {
+                memcpy((unsigned char *)atlas.data + (((int)recs[i].y + y)*atlas.width + (int)recs[i].x)*bytesPerPixel,
+                       (unsigned char *)glyphs[i].image.data + y*glyphs[i].image.width*bytesPerPixel, (int)recs[i].width*bytesPerPixel);
+            }
+        }
+    }
+
+    // Atlas occupancy, considering glyphs padding
+    if (packMethod != 2)
+    {
+        for (int i = 0; i < glyphCount; i++)
+        {
+            if (recs[i].width > 0) packedArea += (recs[i].width + 2*padding)*(recs[i].height + 2*padding);
+        }
+    }
+
+    TRACELOG(LOG_INFO, "FONT: Atlas generated (%ix%i | %i glyphs, %i unique | %.1f%% occupancy)", atlas.width, atlas.height, glyphCount, uniqueCount, 100.0f*packedArea/(atlas.width*atlas.height));
 
 #if defined(SUPPORT_FONT_ATLAS_WHITE_REC)
     // Add a 3x3 white rectangle at the bottom-right corner of the generated atlas,
     // useful to use as the white texture to draw shapes with raylib, using this rectangle
     // shapes and text can be backed into a single draw call: SetShapesTexture()
-    for (int i = 0, k = atlas.width*atlas.height - 1; i < 3; i++)
+    for (int i = 0, k = (atlas.width*atlas.height - 1)*bytesPerPixel; i < 3; i++)
     {
-        ((unsigned char *)atlas.data)[k - 0] = 255;
-        ((unsigned char *)atlas.data)[k - 1] = 255;
-        ((unsigned char *)atlas.data)[k - 2] = 255;
-        k -= atlas.width;
+        memset((unsigned char *)atlas.data + k - 2*bytesPerPixel, 255, 3*bytesPerPixel);
+        k -= atlas.width*bytesPerPixel;
     }
 #endif
 
-    // Convert image data from GRAYSCALE to GRAY_ALPHA
-    unsigned char *dataGrayAlpha = (unsigned char *)RL_MALLOC(atlas.width*atlas.height*sizeof(unsigned char)*2); // Two channels
-
-    for (int i = 0, k = 0; i < atlas.width*atlas.height; i++, k += 2)
+    if (bytesPerPixel == 1)
     {
-        dataGrayAlpha[k] = 255;
-        dataGrayAlpha[k + 1] = ((unsigned char *)atlas.data)[i];
-    }
+        // Convert image data from GRAYSCALE to GRAY_ALPHA
+        unsigned char *dataGrayAlpha = (unsigned char *)RL_MALLOC(atlas.width*atlas.height*sizeof(unsigned char)*2); // Two channels
 
-    RL_FREE(atlas.data);
-    atlas.data = dataGrayAlpha;
-    atlas.format = PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA;
+        for (int i = 0, k = 0; i < atlas.width*atlas.height; i++, k += 2)
+        {
+            dataGrayAlpha[k] = 255;
+            dataGrayAlpha[k + 1] = ((unsigned char *)atlas.data)[i];
+        }
+
+        RL_FREE(atlas.data);
+        atlas.data = dataGrayAlpha;
+        atlas.format = PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA;
+    }
 
     *glyphRecs = recs;
 
@@ -949,11 +1620,20 @@ void UnloadFontData(GlyphInfo *glyphs, int glyphCount)
 void UnloadFont(Font font)
 {
     // NOTE: Make sure font is not default font (fallback)
-    if (font.texture.id != GetFontDefault().texture.id)
+    if (font.cache != NULL)
+    {
+        // Glyph data and page textures are owned by dynamic font cache
+        UnloadFontCache(font.cache);
+        UnloadFontShaping(font.shaping);
+
+        TRACELOGD("FONT: Unloaded dynamic font data from RAM and VRAM");
+    }
+    else if (font.texture.id != GetFontDefault().texture.id)
     {
         UnloadFontData(font.glyphs, font.glyphCount);
         if (isGpuReady) UnloadTexture(font.texture);
         RL_FREE(font.recs);
+        UnloadFontShaping(font.shaping);
 
         TRACELOGD("FONT: Unloaded font data from RAM and VRAM");
     }
@@ -972,7 +1652,7 @@ bool ExportFontAsCode(Font font, const char *fileName)
 
     // Get file name from path
     char fileNamePascal[256] = { 0 };
-    strncpy(fileNamePascal, TextToPascal(GetFileNameWithoutExt(fileName)), 256 - 1);
+    TextToPascalBuffer(fileNamePascal, 256, GetFileNameWithoutExt(fileName));
 
     // NOTE: Text data buffer size is estimated considering image data size in bytes
     // and requiring 6 char bytes for every byte: "0x00, "
@@ -1113,7 +1793,172 @@ bool ExportFontAsCode(Font font, const char *fileName)
     return success;
 }
 
-// Draw current FPS
+// Export font as BMFont text file (.fnt) and atlas image (.png), returns true on success
+// NOTE: Atlas image is saved next to .fnt file, MSDF fonts atlas keeps RGB channels
+// and distance range is added at the end of file, font can be loaded back with LoadFont()
+bool ExportFontAsBMFont(Font font, const char *fileName)
+{
+    bool success = false;
+
+    if ((font.cache != NULL) || (font.texture.id == 0) || (font.glyphs == NULL) || (font.recs == NULL))
+    {
+        TRACELOG(LOG_WARNING, "FILEIO: [%s] Font not valid to export as BMFont", fileName);
+        return success;
+    }
+
+    // NOTE: LoadBMFont() reads up to 128 characters of page file name
+    char imFileName[129] = { 0 };
+    if (snprintf(imFileName, sizeof(imFileName), "%s.png", GetFileNameWithoutExt(fileName)) >= (int)sizeof(imFileName))
+    {
+        TRACELOG(LOG_WARNING, "FILEIO: [%s] File name too long to export as BMFont", fileName);
+        return success;
+    }
+
+    // Export font atlas image
+    Image image = LoadImageFromTexture(font.texture);
+    bool isMSDF = (font.type == FONT_MSDF);
+    if (isMSDF) ImageFormat(&image, PIXELFORMAT_UNCOMPRESSED_R8G8B8);
+
+    success = ExportImage(image, TextFormat("%s/%s", GetDirectoryPath(fileName), imFileName));
+    UnloadImage(image);
+
+    if (success)
+    {
+        int pairCount = (font.shaping != NULL)? font.shaping->pairCount : 0;
+
+        // NOTE: Every line is expected to be smaller than 256 bytes, info line (font name) could take two
+        int bufferSize = (font.glyphCount + pairCount + 8)*256;
+        char *txtData = (char *)RL_CALLOC(bufferSize, sizeof(char));
+        int byteCount = 0;
+
+        // NOTE: LoadBMFont() expects info, common, page and chars lines in this order
+        byteCount += snprintf(txtData + byteCount, bufferSize - byteCount, "info face=\"%s\" size=%i bold=0 italic=0 charset=\"\" unicode=1 stretchH=100 smooth=1 aa=1 padding=0,0,0,0 spacing=%i,%i\n",
+                             GetFileNameWithoutExt(fileName), font.baseSize, font.glyphPadding, font.glyphPadding);
+        byteCount += snprintf(txtData + byteCount, bufferSize - byteCount, "common lineHeight=%i base=%i scaleW=%i scaleH=%i pages=1 packed=0\n", font.baseSize, font.baseSize, font.texture.width, font.texture.height);
+        byteCount += snprintf(txtData + byteCount, bufferSize - byteCount, "page id=0 file=\"%s\"\n", imFileName);
+        byteCount += snprintf(txtData + byteCount, bufferSize - byteCount, "chars count=%i\n", font.glyphCount);
+
+        for (int i = 0; i < font.glyphCount; i++)
+        {
+            byteCount += snprintf(txtData + byteCount, bufferSize - byteCount, "char id=%i x=%i y=%i width=%i height=%i xoffset=%i yoffset=%i xadvance=%i page=0 chnl=15\n",
+                                 font.glyphs[i].value, (int)font.recs[i].x, (int)font.recs[i].y, (int)font.recs[i].width, (int)font.recs[i].height,
+                                 font.glyphs[i].offsetX, font.glyphs[i].offsetY, font.glyphs[i].advanceX);
+        }
+
+        // Kerning pairs, advance rounded to pixels
+        if (pairCount > 0)
+        {
+            byteCount += snprintf(txtData + byteCount, bufferSize - byteCount, "kernings count=%i\n", pairCount);
+
+            for (int i = 0; i < font.shaping->hashSize; i++)
+            {
+                FontKerningPair *pair = &font.shaping->pairs[i];
+                if (pair->first != 0) byteCount += snprintf(txtData + byteCount, bufferSize - byteCount, "kerning first=%i second=%i amount=%i\n", pair->first, pair->second, (int)(pair->advance + ((pair->advance < 0.0f)? -0.5f : 0.5f)));
+            }
+        }
+
+        if (isMSDF) byteCount += snprintf(txtData + byteCount, bufferSize - byteCount, "distanceField fieldType=msdf distanceRange=%i\n", (int)FONT_MSDF_PIXEL_RANGE);
+
+        success = SaveFileText(fileName, txtData);
+
+        RL_FREE(txtData);
+    }
+
+    if (success != 0) TRACELOG(LOG_INFO, "FILEIO: [%s] Font as BMFont exported successfully", fileName);
+    else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to export font as BMFont", fileName);
+
+    return success;
+}
+
+// Export font as binary file (.rfnt): atlas, glyphs metrics, kerning pairs and codepoints, returns true on success
+// NOTE: Atlas pixel data is compressed (DEFLATE) if SUPPORT_COMPRESSION_API is enabled, font can be loaded back with LoadFontBinary()
+bool ExportFontBinary(Font font, const char *fileName)
+{
+    bool success = false;
+
+    if ((font.cache != NULL) || (font.texture.id == 0) || (font.glyphs == NULL) || (font.recs == NULL))
+    {
+        TRACELOG(LOG_WARNING, "FILEIO: [%s] Font not valid to export as binary", fileName);
+        return success;
+    }
+
+    Image atlas = LoadImageFromTexture(font.texture);
+    if (atlas.data == NULL) return success;
+
+    FontBinaryHeader header = { 0 };
+    memcpy(header.id, "rFNT", 4);
+    header.version = FONT_BINARY_VERSION;
+    header.baseSize = font.baseSize;
+    header.glyphCount = font.glyphCount;
+    header.glyphPadding = font.glyphPadding;
+    header.type = font.type;
+    header.atlasWidth = atlas.width;
+    header.atlasHeight = atlas.height;
+    header.atlasFormat = atlas.format;
+    header.atlasDataSize = GetPixelDataSize(atlas.width, atlas.height, atlas.format);
+    header.pairCount = (font.shaping != NULL)? font.shaping->pairCount : 0;
+    header.ligatures = (font.shaping != NULL)? font.shaping->ligatures : 0;
+
+    const unsigned char *atlasData = (const unsigned char *)atlas.data;
+    int atlasSize = header.atlasDataSize;
+
+#if defined(SUPPORT_COMPRESSION_API)
+    // Atlas is only stored compressed if smaller
+    int compDataSize = 0;
+    unsigned char *compData = CompressData(atlasData, header.atlasDataSize, &compDataSize);
+
+    if ((compData != NULL) && (compDataSize > 0) && (compDataSize < header.atlasDataSize))
+    {
+        header.atlasCompSize = compDataSize;
+        atlasData = compData;
+        atlasSize = compDataSize;
+    }
+#endif
+
+    int dataSize = sizeof(FontBinaryHeader) + header.glyphCount*(4*sizeof(int) + sizeof(Rectangle)) + header.pairCount*sizeof(FontKerningPair) + atlasSize;
+    unsigned char *fileData = (unsigned char *)RL_MALLOC(dataSize);
+    int offset = 0;
+
+    memcpy(fileData + offset, &header, sizeof(FontBinaryHeader));
+    offset += sizeof(FontBinaryHeader);
+
+    for (int i = 0; i < font.glyphCount; i++)
+    {
+        int info[4] = { font.glyphs[i].value, font.glyphs[i].offsetX, font.glyphs[i].offsetY, font.glyphs[i].advanceX };
+        memcpy(fileData + offset, info, sizeof(info));
+        offset += sizeof(info);
+    }
+
+    memcpy(fileData + offset, font.recs, font.glyphCount*sizeof(Rectangle));
+    offset += font.glyphCount*sizeof(Rectangle);
+
+    // Kerning pairs are stored packed, hash table is rebuilt on loading
+    for (int i = 0; (font.shaping != NULL) && (i < font.shaping->hashSize); i++)
+    {
+        if (font.shaping->pairs[i].first != 0)
+        {
+            memcpy(fileData + offset, &font.shaping->pairs[i], sizeof(FontKerningPair));
+            offset += sizeof(FontKerningPair);
+        }
+    }
+
+    memcpy(fileData + offset, atlasData, atlasSize);
+
+    success = SaveFileData(fileName, fileData, dataSize);
+
+    RL_FREE(fileData);
+#if defined(SUPPORT_COMPRESSION_API)
+    RL_FREE(compData);
+#endif
+    UnloadImage(atlas);
+
+    if (success != 0) TRACELOG(LOG_INFO, "FILEIO: [%s] Font as binary exported successfully", fileName);
+    else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to export font as binary", fileName);
+
+    return success;
+}
+
+// Draw current FPS
 // NOTE: Uses default font
 void DrawFPS(int posX, int posY)
 {
@@ -1156,12 +2001,31 @@ void DrawTextEx(Font font, const char *text, Vector2 position, float fontSize, f
     float textOffsetX = 0.0f;       // Offset X to next character to draw
 
     float scaleFactor = fontSize/font.baseSize;         // Character quad scaling factor
+    int previousCodepoint = 0;      // Previous codepoint in line, required for kerning
+
+    if (font.cache != NULL)
+    {
+        // Rasterize all text glyphs first, so modified cache pages are uploaded once
+        for (int i = 0; i < size;)
+        {
+            int codepointByteCount = 0;
+            int codepoint = GetTextCodepointNext(font, &text[i], &codepointByteCount);
+            if ((codepoint != '\n') && (codepoint != ' ') && (codepoint != '\t')) GetFontCacheGlyph(font.cache, codepoint, font.glyphPadding);
+            i += codepointByteCount;
+        }
+
+        UpdateFontCacheTextures(font.cache);
+    }
+
+    // Glyphs quads are staged and copied in bulk to the render batch, one texture bind per text
+    TextGlyphQuads quads;
+    InitTextGlyphQuads(&quads, font, fontSize, tint);
 
     for (int i = 0; i < size;)
     {
-        // Get next codepoint from byte string and glyph index in font
+        // Get next codepoint from byte string (ligatures substituted) and glyph index in font
         int codepointByteCount = 0;
-        int codepoint = GetCodepointNext(&text[i], &codepointByteCount);
+        int codepoint = GetTextCodepointNext(font, &text[i], &codepointByteCount);
         int index = GetGlyphIndex(font, codepoint);
 
         if (codepoint == '\n')
@@ -1169,20 +2033,24 @@ void DrawTextEx(Font font, const char *text, Vector2 position, float fontSize, f
             // NOTE: Line spacing is a global variable, use SetTextLineSpacing() to setup
             textOffsetY += (fontSize + textLineSpacing);
             textOffsetX = 0.0f;
+            previousCodepoint = 0;
         }
         else
         {
-            if ((codepoint != ' ') && (codepoint != '\t'))
-            {
-                DrawTextCodepoint(font, codepoint, (Vector2){ position.x + textOffsetX, position.y + textOffsetY }, fontSize, tint);
-            }
+            if ((font.shaping != NULL) && (previousCodepoint != 0)) textOffsetX += GetFontShapingKerning(font.shaping, previousCodepoint, codepoint)*scaleFactor;
+
+            if ((codepoint != ' ') && (codepoint != '\t')) AddTextGlyphQuad(&quads, index, position.x + textOffsetX, position.y + textOffsetY);
 
             if (font.glyphs[index].advanceX == 0) textOffsetX += ((float)font.recs[index].width*scaleFactor + spacing);
             else textOffsetX += ((float)font.glyphs[index].advanceX*scaleFactor + spacing);
+
+            previousCodepoint = codepoint;
         }
 
         i += codepointByteCount;   // Move text bytes counter to next codepoint
     }
+
+    DrawTextGlyphQuads(&quads);
 }
 
 // Draw text using Font and pro parameters (rotation)
@@ -1205,22 +2073,12 @@ void DrawTextCodepoint(Font font, int codepoint, Vector2 position, float fontSiz
     // Character index position in sprite font
     // NOTE: In case a codepoint is not available in the font, index returned points to '?'
     int index = GetGlyphIndex(font, codepoint);
-    float scaleFactor = fontSize/font.baseSize;     // Character quad scaling factor
-
-    // Character destination rectangle on screen
-    // NOTE: We consider glyphPadding on drawing
-    Rectangle dstRec = { position.x + font.glyphs[index].offsetX*scaleFactor - (float)font.glyphPadding*scaleFactor,
-                      position.y + font.glyphs[index].offsetY*scaleFactor - (float)font.glyphPadding*scaleFactor,
-                      (font.recs[index].width + 2.0f*font.glyphPadding)*scaleFactor,
-                      (font.recs[index].height + 2.0f*font.glyphPadding)*scaleFactor };
-
-    // Character source rectangle from font texture atlas
-    // NOTE: We consider chars padding when drawing, it could be required for outline/glow shader effects
-    Rectangle srcRec = { font.recs[index].x - (float)font.glyphPadding, font.recs[index].y - (float)font.glyphPadding,
-                         font.recs[index].width + 2.0f*font.glyphPadding, font.recs[index].height + 2.0f*font.glyphPadding };
 
-    // Draw the character texture on the screen
-    DrawTexturePro(font.texture, srcRec, dstRec, (Vector2){ 0, 0 }, 0.0f, tint);
+    // Draw the character quad on the screen, same as DrawTexturePro() without rotation
+    TextGlyphQuads quads;
+    InitTextGlyphQuads(&quads, font, fontSize, tint);
+    AddTextGlyphQuad(&quads, index, position.x, position.y);
+    DrawTextGlyphQuads(&quads);
 }
 
 // Draw multiple character (codepoints)
@@ -1230,182 +2088,640 @@ void DrawTextCodepoints(Font font, const int *codepoints, int codepointCount, Ve
     float textOffsetX = 0.0f;       // Offset X to next character to draw
 
     float scaleFactor = fontSize/font.baseSize;         // Character quad scaling factor
+    int previousCodepoint = 0;      // Previous codepoint in line, required for kerning
+    bool ligatures = (textLigatures && (font.shaping != NULL) && (font.shaping->ligatures != 0));
 
-    for (int i = 0; i < codepointCount; i++)
+    if (font.cache != NULL)
+    {
+        // Rasterize all glyphs first, so modified cache pages are uploaded once
+        for (int i = 0; i < codepointCount; i++)
+        {
+            if ((codepoints[i] != '\n') && (codepoints[i] != ' ') && (codepoints[i] != '\t')) GetFontCacheGlyph(font.cache, codepoints[i], font.glyphPadding);
+        }
+
+        UpdateFontCacheTextures(font.cache);
+    }
+
+    // Glyphs quads are staged and copied in bulk to the render batch, one texture bind per text
+    TextGlyphQuads quads;
+    InitTextGlyphQuads(&quads, font, fontSize, tint);
+
+    for (int i = 0; i < codepointCount;)
     {
-        int index = GetGlyphIndex(font, codepoints[i]);
+        int codepoint = codepoints[i];
+        int length = 1;
+
+        if (ligatures)
+        {
+            codepoint = GetFontShapingLigature(font.shaping, codepoint, ((i + 1) < codepointCount)? codepoints[i + 1] : 0, ((i + 2) < codepointCount)? codepoints[i + 2] : 0, &length);
+        }
+
+        int index = GetGlyphIndex(font, codepoint);
 
-        if (codepoints[i] == '\n')
+        if (codepoint == '\n')
         {
             // NOTE: Line spacing is a global variable, use SetTextLineSpacing() to setup
             textOffsetY += (fontSize + textLineSpacing);
             textOffsetX = 0.0f;
+            previousCodepoint = 0;
         }
         else
         {
-            if ((codepoints[i] != ' ') && (codepoints[i] != '\t'))
-            {
-                DrawTextCodepoint(font, codepoints[i], (Vector2){ position.x + textOffsetX, position.y + textOffsetY }, fontSize, tint);
-            }
+            if ((font.shaping != NULL) && (previousCodepoint != 0)) textOffsetX += GetFontShapingKerning(font.shaping, previousCodepoint, codepoint)*scaleFactor;
+
+            if ((codepoint != ' ') && (codepoint != '\t')) AddTextGlyphQuad(&quads, index, position.x + textOffsetX, position.y + textOffsetY);
 
             if (font.glyphs[index].advanceX == 0) textOffsetX += ((float)font.recs[index].width*scaleFactor + spacing);
             else textOffsetX += ((float)font.glyphs[index].advanceX*scaleFactor + spacing);
-        }
-    }
-}
-
-// Set vertical line spacing when drawing with line-breaks
-void SetTextLineSpacing(int spacing)
-{
-    textLineSpacing = spacing;
-}
 
-// Measure string width for default font
-int MeasureText(const char *text, int fontSize)
-{
-    Vector2 textSize = { 0.0f, 0.0f };
-
-    // Check if default font has been loaded
-    if (GetFontDefault().texture.id != 0)
-    {
-        int defaultFontSize = 10;   // Default Font chars height in pixel
-        if (fontSize < defaultFontSize) fontSize = defaultFontSize;
-        int spacing = fontSize/defaultFontSize;
+            previousCodepoint = codepoint;
+        }
 
-        textSize = MeasureTextEx(GetFontDefault(), text, (float)fontSize, (float)spacing);
+        i += length;
     }
 
-    return (int)textSize.x;
+    DrawTextGlyphQuads(&quads);
 }
 
-// Measure string size for Font
-Vector2 MeasureTextEx(Font font, const char *text, float fontSize, float spacing)
+// Load text layout, glyphs quads precomputed for static text drawing
+// NOTE: Glyphs quads match DrawTextEx() output, bounds match MeasureTextEx() size
+TextLayout LoadTextLayout(Font font, const char *text, float fontSize, float spacing)
 {
-    Vector2 textSize = { 0 };
+    TextLayout layout = { 0 };
 
-    if ((isGpuReady && (font.texture.id == 0)) || (text == NULL)) return textSize; // Security check
+    if (font.texture.id == 0) font = GetFontDefault();  // Security check in case of not valid font
+    if (text == NULL) return layout;
 
-    int size = TextLength(text);    // Get size in bytes of text
-    int tempByteCounter = 0;        // Used to count longer text line num chars
-    int byteCounter = 0;
+    int size = TextLength(text);    // Total size in bytes of the text, scanned by codepoints in loop
 
-    float textWidth = 0.0f;
-    float tempTextWidth = 0.0f;     // Used to count longer text line width
+    // NOTE: Text bytes count is used as maximum glyphs count
+    layout.font = font;
+    layout.vertices = (float *)RL_MALLOC(size*8*sizeof(float));
+    layout.texcoords = (float *)RL_MALLOC(size*8*sizeof(float));
+    layout.glyphs = (int *)RL_MALLOC(size*sizeof(int));
+    layout.codepoints = (int *)RL_MALLOC(size*sizeof(int));
 
-    float textHeight = fontSize;
-    float scaleFactor = fontSize/(float)font.baseSize;
+    float textOffsetY = 0;          // Offset between lines (on linebreak '\n')
+    float textOffsetX = 0.0f;       // Offset X to next character to draw
 
-    int letter = 0;                 // Current character
-    int index = 0;                  // Index position in sprite font
+    float scaleFactor = fontSize/font.baseSize;         // Character quad scaling factor
+    int previousCodepoint = 0;      // Previous codepoint in line, required for kerning
 
     for (int i = 0; i < size;)
     {
-        byteCounter++;
-
-        int next = 0;
-        letter = GetCodepointNext(&text[i], &next);
-        index = GetGlyphIndex(font, letter);
-
-        i += next;
+        int codepointByteCount = 0;
+        int codepoint = GetTextCodepointNext(font, &text[i], &codepointByteCount);
+        int index = GetGlyphIndex(font, codepoint);
 
-        if (letter != '\n')
+        if (codepoint == '\n')
         {
-            if (font.glyphs[index].advanceX != 0) textWidth += font.glyphs[index].advanceX;
-            else textWidth += (font.recs[index].width + font.glyphs[index].offsetX);
+            // NOTE: Line spacing is a global variable, use SetTextLineSpacing() to setup
+            textOffsetY += (fontSize + textLineSpacing);
+            textOffsetX = 0.0f;
+            previousCodepoint = 0;
         }
         else
         {
-            if (tempTextWidth < textWidth) tempTextWidth = textWidth;
-            byteCounter = 0;
-            textWidth = 0;
+            if ((font.shaping != NULL) && (previousCodepoint != 0)) textOffsetX += GetFontShapingKerning(font.shaping, previousCodepoint, codepoint)*scaleFactor;
 
-            // NOTE: Line spacing is a global variable, use SetTextLineSpacing() to setup
-            textHeight += (fontSize + textLineSpacing);
+            if ((codepoint != ' ') && (codepoint != '\t'))
+            {
+                // Glyph quad, same as DrawTextCodepoint() considering glyphPadding
+                float x = textOffsetX + font.glyphs[index].offsetX*scaleFactor - (float)font.glyphPadding*scaleFactor;
+                float y = textOffsetY + font.glyphs[index].offsetY*scaleFactor - (float)font.glyphPadding*scaleFactor;
+                float width = (font.recs[index].width + 2.0f*font.glyphPadding)*scaleFactor;
+                float height = (font.recs[index].height + 2.0f*font.glyphPadding)*scaleFactor;
+
+                // Quad vertex order: top-left, bottom-left, bottom-right, top-right
+                float *vertices = layout.vertices + layout.glyphCount*8;
+                vertices[0] = x; vertices[1] = y;
+                vertices[2] = x; vertices[3] = y + height;
+                vertices[4] = x + width; vertices[5] = y + height;
+                vertices[6] = x + width; vertices[7] = y;
+
+                layout.glyphs[layout.glyphCount] = index;
+                layout.codepoints[layout.glyphCount] = font.glyphs[index].value;
+                SetTextLayoutTexcoords(layout, layout.glyphCount);
+                layout.glyphCount++;
+            }
+
+            if (font.glyphs[index].advanceX == 0) textOffsetX += ((float)font.recs[index].width*scaleFactor + spacing);
+            else textOffsetX += ((float)font.glyphs[index].advanceX*scaleFactor + spacing);
+
+            previousCodepoint = codepoint;
         }
 
-        if (tempByteCounter < byteCounter) tempByteCounter = byteCounter;
+        i += codepointByteCount;   // Move text bytes counter to next codepoint
     }
 
-    if (tempTextWidth < textWidth) tempTextWidth = textWidth;
+    Vector2 textSize = MeasureTextEx(font, text, fontSize, spacing);
+    layout.bounds = (Rectangle){ 0.0f, 0.0f, textSize.x, textSize.y };
 
-    textSize.x = tempTextWidth*scaleFactor + (float)((tempByteCounter - 1)*spacing);
-    textSize.y = textHeight;
+    return layout;
+}
 
-    return textSize;
+// Unload text layout data (RAM)
+void UnloadTextLayout(TextLayout layout)
+{
+    RL_FREE(layout.vertices);
+    RL_FREE(layout.texcoords);
+    RL_FREE(layout.glyphs);
+    RL_FREE(layout.codepoints);
 }
 
-// Get index position for a unicode character on font
-// NOTE: If codepoint is not found in the font it fallbacks to '?'
-int GetGlyphIndex(Font font, int codepoint)
+// Draw text layout, glyphs quads copied in bulk to the render batch
+void DrawTextLayout(TextLayout layout, Vector2 position, Color tint)
 {
-    int index = 0;
+    if ((layout.glyphCount == 0) || (layout.font.texture.id == 0)) return;
 
-#define SUPPORT_UNORDERED_CHARSET
-#if defined(SUPPORT_UNORDERED_CHARSET)
-    int fallbackIndex = 0;      // Get index of fallback glyph '?'
+    rFontCache *cache = layout.font.cache;
 
-    // Look for character index in the unordered charset
-    for (int i = 0; i < font.glyphCount; i++)
+    if (cache == NULL)
     {
-        if (font.glyphs[i].value == 63) fallbackIndex = i;
+        rlSetTexture(layout.font.texture.id);
+        rlBegin(RL_QUADS);
 
-        if (font.glyphs[i].value == codepoint)
+            rlColor4ub(tint.r, tint.g, tint.b, tint.a);
+            rlNormal3f(0.0f, 0.0f, 1.0f);                          // Normal vector pointing towards viewer
+            rlVertexQuads2f(layout.vertices, layout.texcoords, layout.glyphCount, position.x, position.y);
+
+        rlEnd();
+        rlSetTexture(0);
+    }
+    else
+    {
+        // Dynamic font glyphs could have been evicted and rasterized again in a different
+        // cache position since layout was loaded, glyphs metrics do not change, only texture coordinates
+        // NOTE: Rasterizing a glyph could evict the page of a glyph already refreshed,
+        // so glyphs are refreshed again until no page is evicted, then texture coordinates are set
+        // WARNING: Layouts not fitting in the cache at once keep evicting pages, then every glyph
+        // is drawn just after refreshing it, page eviction draws render batch before modifying the page
+        unsigned int evictCount = 0;
+        int pass = 0;
+
+        do
         {
-            index = i;
-            break;
+            evictCount = cache->evictCount;
+
+            for (int i = 0; i < layout.glyphCount; i++)
+            {
+                int slot = layout.glyphs[i];
+
+                if ((cache->glyphPages[slot] == -1) || (cache->glyphs[slot].value != layout.codepoints[i]))
+                {
+                    layout.glyphs[i] = GetFontCacheGlyph(cache, layout.codepoints[i], layout.font.glyphPadding);
+                }
+                else
+                {
+                    cache->useCounter++;
+                    cache->pages[cache->glyphPages[slot]].lastUsed = cache->useCounter;
+                }
+            }
+
+            pass++;
+        } while ((cache->evictCount != evictCount) && (pass < FONT_CACHE_MAX_PAGES));
+
+        bool cached = (cache->evictCount == evictCount);
+
+        if (cached)
+        {
+            for (int i = 0; i < layout.glyphCount; i++) SetTextLayoutTexcoords(layout, i);
+            UpdateFontCacheTextures(cache);
         }
-    }
+        else TRACELOGD("FONT: Text layout glyphs do not fit in dynamic font cache, drawn glyph by glyph");
 
-    if ((index == 0) && (font.glyphs[0].value != codepoint)) index = fallbackIndex;
-#else
-    index = codepoint - 32;
-#endif
+        // Glyphs quads are drawn in runs sharing the same cache page
+        for (int i = 0; i < layout.glyphCount;)
+        {
+            if (!cached)
+            {
+                layout.glyphs[i] = GetFontCacheGlyph(cache, layout.codepoints[i], layout.font.glyphPadding);
+                SetTextLayoutTexcoords(layout, i);
+                UpdateFontCacheTextures(cache);
+            }
 
-    return index;
-}
+            int page = cache->glyphPages[layout.glyphs[i]];
+            int count = 1;
 
-// Get glyph font info data for a codepoint (unicode character)
-// NOTE: If codepoint is not found in the font it fallbacks to '?'
-GlyphInfo GetGlyphInfo(Font font, int codepoint)
-{
-    GlyphInfo info = { 0 };
+            while (cached && ((i + count) < layout.glyphCount) && (cache->glyphPages[layout.glyphs[i + count]] == page)) count++;
 
-    info = font.glyphs[GetGlyphIndex(font, codepoint)];
+            rlSetTexture(cache->pages[page].texture.id);
+            rlBegin(RL_QUADS);
 
-    return info;
+                rlColor4ub(tint.r, tint.g, tint.b, tint.a);
+                rlNormal3f(0.0f, 0.0f, 1.0f);                      // Normal vector pointing towards viewer
+                rlVertexQuads2f(layout.vertices + i*8, layout.texcoords + i*8, count, position.x, position.y);
+
+            rlEnd();
+            rlSetTexture(0);
+
+            i += count;
+        }
+    }
 }
 
-// Get glyph rectangle in font atlas for a codepoint (unicode character)
-// NOTE: If codepoint is not found in the font it fallbacks to '?'
-Rectangle GetGlyphAtlasRec(Font font, int codepoint)
+// Load text document, text lines indexed for clipped drawing of long texts
+TextDocument LoadTextDocument(Font font, const char *text, float fontSize, float spacing)
 {
-    Rectangle rec = { 0 };
+    TextDocument document = { 0 };
 
-    rec = font.recs[GetGlyphIndex(font, codepoint)];
+    if (font.texture.id == 0) font = GetFontDefault();  // Security check in case of not valid font
 
-    return rec;
+    document.font = font;
+    document.fontSize = fontSize;
+    document.spacing = spacing;
+
+    // NOTE: Line spacing is a global variable, use SetTextLineSpacing() to setup before loading
+    document.lineHeight = fontSize + (float)textLineSpacing;
+
+    // Document always contains at least one (empty) line
+    document.textCapacity = 256;
+    document.text = (char *)RL_CALLOC(document.textCapacity, 1);
+    document.lineCapacity = 64;
+    document.lineStarts = (int *)RL_CALLOC(document.lineCapacity, sizeof(int));
+    document.lineWidths = (float *)RL_CALLOC(document.lineCapacity, sizeof(float));
+    document.lineCount = 1;
+    document.size = (Vector2){ 0.0f, fontSize };
+
+    AppendTextDocument(&document, text);
+
+    return document;
 }
 
-//----------------------------------------------------------------------------------
-// Text strings management functions
-//----------------------------------------------------------------------------------
-// Get text length in bytes, check for \0 character
-unsigned int TextLength(const char *text)
+// Unload text document data (RAM)
+void UnloadTextDocument(TextDocument document)
 {
-    unsigned int length = 0;
+    RL_FREE(document.text);
+    RL_FREE(document.lineStarts);
+    RL_FREE(document.lineWidths);
+}
 
-    if (text != NULL)
+// Append text to text document, only new lines (and last line, if continued) are measured
+void AppendTextDocument(TextDocument *document, const char *text)
+{
+    int length = TextLength(text);
+
+    if ((document == NULL) || (document->text == NULL) || (length == 0)) return;
+
+    // Grow text buffer if required, doubling its capacity
+    if ((document->textLength + length + 1) > document->textCapacity)
     {
-        // NOTE: Alternative: use strlen(text)
+        int capacity = document->textCapacity;
+        while ((document->textLength + length + 1) > capacity) capacity *= 2;
 
-        while (*text++) length++;
+        char *newText = (char *)RL_REALLOC(document->text, capacity);
+        if (newText == NULL) return;
+
+        document->text = newText;
+        document->textCapacity = capacity;
     }
 
-    return length;
-}
+    memcpy(document->text + document->textLength, text, length);
+    int start = document->textLength;       // Appended text start position
+    document->textLength += length;
+    document->text[document->textLength] = '\0';
 
-// Formatting of text with variables to 'embed'
-// WARNING: String returned will expire after this function is called MAX_TEXTFORMAT_BUFFERS times
+    // Index new lines start positions
+    for (const char *ptr = (const char *)memchr(document->text + start, '\n', length); ptr != NULL;
+         ptr = (const char *)memchr(ptr, '\n', document->textLength - (ptr - document->text)))
+    {
+        ptr++;
+
+        if (document->lineCount == document->lineCapacity)
+        {
+            int capacity = document->lineCapacity*2;
+            int *newStarts = (int *)RL_REALLOC(document->lineStarts, capacity*sizeof(int));
+            if (newStarts != NULL) document->lineStarts = newStarts;
+            float *newWidths = (float *)RL_REALLOC(document->lineWidths, capacity*sizeof(float));
+            if (newWidths != NULL) document->lineWidths = newWidths;
+            if ((newStarts == NULL) || (newWidths == NULL)) break;
+
+            document->lineCapacity = capacity;
+        }
+
+        document->lineStarts[document->lineCount] = (int)(ptr - document->text);
+        document->lineWidths[document->lineCount] = 0.0f;
+        document->lineCount++;
+    }
+
+    // Measure modified lines: previous last line could be continued by appended text
+    // NOTE: Lines only grow on append, so document width is the maximum of measured widths
+    int firstLine = GetTextDocumentLine(*document, start);
+
+    for (int line = firstLine; line < document->lineCount; line++)
+    {
+        int lineStart = document->lineStarts[line];
+        int lineEnd = (line < (document->lineCount - 1))? document->lineStarts[line + 1] - 1 : document->textLength;
+
+        document->lineWidths[line] = MeasureTextLine(document->font, document->text + lineStart, lineEnd - lineStart, document->fontSize, document->spacing);
+        if (document->lineWidths[line] > document->size.x) document->size.x = document->lineWidths[line];
+    }
+
+    document->size.y = document->fontSize + (float)(document->lineCount - 1)*document->lineHeight;
+}
+
+// Get text document line containing a text byte position
+// NOTE: Lines start positions are sorted, binary search is used
+int GetTextDocumentLine(TextDocument document, int position)
+{
+    int low = 0;
+    int high = document.lineCount - 1;
+
+    while (low < high)
+    {
+        int middle = (low + high + 1)/2;
+
+        if (document.lineStarts[middle] <= position) low = middle;
+        else high = middle - 1;
+    }
+
+    return low;
+}
+
+// Draw text document lines intersecting a clip rectangle (same coordinates as position)
+// NOTE: Lines partially inside clip are fully drawn, use BeginScissorMode() with same rectangle to clip them
+void DrawTextDocument(TextDocument document, Vector2 position, Rectangle clip, Color tint)
+{
+    if ((document.text == NULL) || (document.lineHeight <= 0.0f)) return;
+
+    // Get first and last visible lines, every line takes fontSize height every lineHeight
+    float top = (clip.y - position.y - document.fontSize)/document.lineHeight;
+    float bottom = (clip.y + clip.height - position.y)/document.lineHeight;
+
+    if (bottom <= 0.0f) return;
+
+    int firstLine = (top < 0.0f)? 0 : (int)top + 1;
+    int lastLine = ((float)(int)bottom == bottom)? (int)bottom - 1 : (int)bottom;
+    if (lastLine > (document.lineCount - 1)) lastLine = document.lineCount - 1;
+
+    Font font = document.font;
+    float scaleFactor = document.fontSize/font.baseSize;
+    float clipRight = clip.x + clip.width - position.x;
+
+    if (font.cache != NULL)
+    {
+        // Rasterize visible lines glyphs first, so modified cache pages are uploaded once
+        for (int line = firstLine; line <= lastLine; line++)
+        {
+            const char *text = document.text + document.lineStarts[line];
+            int size = (line < (document.lineCount - 1))? document.lineStarts[line + 1] - 1 - document.lineStarts[line] : document.textLength - document.lineStarts[line];
+
+            for (int i = 0; i < size;)
+            {
+                int codepointByteCount = 0;
+                int codepoint = GetTextCodepointNext(font, &text[i], &codepointByteCount);
+                if ((codepoint != ' ') && (codepoint != '\t')) GetFontCacheGlyph(font.cache, codepoint, font.glyphPadding);
+                i += codepointByteCount;
+            }
+        }
+
+        UpdateFontCacheTextures(font.cache);
+    }
+
+    // Glyphs quads of all visible lines are staged and copied in bulk to the render batch
+    TextGlyphQuads quads;
+    InitTextGlyphQuads(&quads, font, document.fontSize, tint);
+
+    for (int line = firstLine; line <= lastLine; line++)
+    {
+        const char *text = document.text + document.lineStarts[line];
+        int size = (line < (document.lineCount - 1))? document.lineStarts[line + 1] - 1 - document.lineStarts[line] : document.textLength - document.lineStarts[line];
+
+        float textOffsetY = (float)line*document.lineHeight;
+        float textOffsetX = 0.0f;
+        int previousCodepoint = 0;
+
+        for (int i = 0; (i < size) && (textOffsetX < clipRight);)
+        {
+            int codepointByteCount = 0;
+            int codepoint = GetTextCodepointNext(font, &text[i], &codepointByteCount);
+            int index = GetGlyphIndex(font, codepoint);
+
+            if ((font.shaping != NULL) && (previousCodepoint != 0)) textOffsetX += GetFontShapingKerning(font.shaping, previousCodepoint, codepoint)*scaleFactor;
+
+            float advanceX = (font.glyphs[index].advanceX == 0)? (float)font.recs[index].width*scaleFactor : (float)font.glyphs[index].advanceX*scaleFactor;
+
+            // Glyphs before clip left side are skipped, only advanced
+            if ((codepoint != ' ') && (codepoint != '\t') && ((position.x + textOffsetX + (font.glyphs[index].offsetX + font.recs[index].width + font.glyphPadding)*scaleFactor) >= clip.x))
+            {
+                AddTextGlyphQuad(&quads, index, position.x + textOffsetX, position.y + textOffsetY);
+            }
+
+            textOffsetX += (advanceX + document.spacing);
+            previousCodepoint = codepoint;
+
+            i += codepointByteCount;   // Move text bytes counter to next codepoint
+        }
+    }
+
+    DrawTextGlyphQuads(&quads);
+}
+
+// Set vertical line spacing when drawing with line-breaks
+void SetTextLineSpacing(int spacing)
+{
+    textLineSpacing = spacing;
+}
+
+// Set ligatures substitution when drawing and measuring text
+// NOTE: Ligatures are only substituted if font contains ligature glyphs (i.e. U+FB01 'fi')
+void SetTextLigatures(bool enabled)
+{
+    textLigatures = enabled;
+}
+
+// Measure string width for default font
+int MeasureText(const char *text, int fontSize)
+{
+    Vector2 textSize = { 0.0f, 0.0f };
+
+    // Check if default font has been loaded
+    if (GetFontDefault().texture.id != 0)
+    {
+        int defaultFontSize = 10;   // Default Font chars height in pixel
+        if (fontSize < defaultFontSize) fontSize = defaultFontSize;
+        int spacing = fontSize/defaultFontSize;
+
+        textSize = MeasureTextEx(GetFontDefault(), text, (float)fontSize, (float)spacing);
+    }
+
+    return (int)textSize.x;
+}
+
+// Measure string size for Font
+Vector2 MeasureTextEx(Font font, const char *text, float fontSize, float spacing)
+{
+    Vector2 textSize = { 0 };
+
+    if ((isGpuReady && (font.texture.id == 0)) || (text == NULL)) return textSize; // Security check
+
+    int size = TextLength(text);    // Get size in bytes of text
+    int tempByteCounter = 0;        // Used to count longer text line num chars
+    int byteCounter = 0;
+
+    float textWidth = 0.0f;
+    float tempTextWidth = 0.0f;     // Used to count longer text line width
+
+    float textHeight = fontSize;
+    float scaleFactor = fontSize/(float)font.baseSize;
+
+    int letter = 0;                 // Current character
+    int previousLetter = 0;         // Previous character in line, required for kerning
+    int index = 0;                  // Index position in sprite font
+
+    for (int i = 0; i < size;)
+    {
+        byteCounter++;
+
+        int next = 0;
+        letter = GetTextCodepointNext(font, &text[i], &next);
+        index = GetGlyphIndex(font, letter);
+
+        i += next;
+
+        if (letter != '\n')
+        {
+            if ((font.shaping != NULL) && (previousLetter != 0)) textWidth += GetFontShapingKerning(font.shaping, previousLetter, letter);
+
+            if (font.glyphs[index].advanceX != 0) textWidth += font.glyphs[index].advanceX;
+            else textWidth += (font.recs[index].width + font.glyphs[index].offsetX);
+
+            previousLetter = letter;
+        }
+        else
+        {
+            if (tempTextWidth < textWidth) tempTextWidth = textWidth;
+            byteCounter = 0;
+            textWidth = 0;
+            previousLetter = 0;
+
+            // NOTE: Line spacing is a global variable, use SetTextLineSpacing() to setup
+            textHeight += (fontSize + textLineSpacing);
+        }
+
+        if (tempByteCounter < byteCounter) tempByteCounter = byteCounter;
+    }
+
+    if (tempTextWidth < textWidth) tempTextWidth = textWidth;
+
+    textSize.x = tempTextWidth*scaleFactor + (float)((tempByteCounter - 1)*spacing);
+    textSize.y = textHeight;
+
+    return textSize;
+}
+
+// Get index position for a unicode character on font
+// NOTE: If codepoint is not found in the font it fallbacks to '?'
+// WARNING: Dynamic fonts rasterize the glyph on first use, it could evict a cache page,
+// so glyph indices (and recs) got previously could be reused by other glyphs
+int GetGlyphIndex(Font font, int codepoint)
+{
+    int index = 0;
+
+    // Dynamic fonts index glyphs by cache slot, glyph is rasterized on first use
+    if (font.cache != NULL) return GetFontCacheGlyph(font.cache, codepoint, font.glyphPadding);
+
+#define SUPPORT_UNORDERED_CHARSET
+#if defined(SUPPORT_UNORDERED_CHARSET)
+    // Ordered charsets starting at 32 (default) are indexed directly
+    if ((codepoint >= 32) && ((codepoint - 32) < font.glyphCount) && (font.glyphs[codepoint - 32].value == codepoint)) return codepoint - 32;
+
+    int fallbackIndex = 0;      // Get index of fallback glyph '?'
+
+    // Look for character index in the unordered charset
+    for (int i = 0; i < font.glyphCount; i++)
+    {
+        if (font.glyphs[i].value == 63) fallbackIndex = i;
+
+        if (font.glyphs[i].value == codepoint)
+        {
+            index = i;
+            break;
+        }
+    }
+
+    if ((index == 0) && (font.glyphs[0].value != codepoint)) index = fallbackIndex;
+#else
+    index = codepoint - 32;
+#endif
+
+    return index;
+}
+
+// Get glyph font info data for a codepoint (unicode character)
+// NOTE: If codepoint is not found in the font it fallbacks to '?'
+GlyphInfo GetGlyphInfo(Font font, int codepoint)
+{
+    GlyphInfo info = { 0 };
+
+    info = font.glyphs[GetGlyphIndex(font, codepoint)];
+
+    return info;
+}
+
+// Get glyph rectangle in font atlas for a codepoint (unicode character)
+// NOTE: If codepoint is not found in the font it fallbacks to '?'
+// NOTE: Dynamic fonts use several atlas pages, rectangle refers to GetGlyphAtlasTexture() texture, not font.texture
+Rectangle GetGlyphAtlasRec(Font font, int codepoint)
+{
+    Rectangle rec = { 0 };
+
+    rec = font.recs[GetGlyphIndex(font, codepoint)];
+
+    return rec;
+}
+
+// Get glyph atlas texture for a codepoint (unicode character)
+// NOTE: Static fonts always return font.texture, dynamic fonts return the cache page containing the glyph,
+// it must be used before rasterizing other glyphs, they could evict the page
+Texture2D GetGlyphAtlasTexture(Font font, int codepoint)
+{
+    Texture2D texture = font.texture;
+
+    if (font.cache != NULL)
+    {
+        int index = GetGlyphIndex(font, codepoint);
+        texture = font.cache->pages[font.cache->glyphPages[index]].texture;
+    }
+
+    return texture;
+}
+
+// Get kerning advance adjustment between two codepoints (unicode characters), scaled to font base size
+// NOTE: Kerning pairs are extracted on font loading, 0.0f is returned for pairs not kerned
+float GetGlyphKerning(Font font, int codepoint, int nextCodepoint)
+{
+    float kerning = 0.0f;
+
+    if (font.shaping != NULL) kerning = GetFontShapingKerning(font.shaping, codepoint, nextCodepoint);
+
+    return kerning;
+}
+
+// Get next codepoint drawn for a font in a UTF-8 encoded string, bytes processed returned in codepointSize
+// NOTE: Ligatures are substituted if enabled (SetTextLigatures()) and available in font, as text drawing does
+int GetGlyphCodepointNext(Font font, const char *text, int *codepointSize)
+{
+    return GetTextCodepointNext(font, text, codepointSize);
+}
+
+//----------------------------------------------------------------------------------
+// Text strings management functions
+//----------------------------------------------------------------------------------
+// Get text length in bytes, check for \0 character
+// REQUIRES: strlen()
+unsigned int TextLength(const char *text)
+{
+    unsigned int length = 0;
+
+    // NOTE: Standard library strlen() is already vectorized on most platforms
+    if (text != NULL) length = (unsigned int)strlen(text);
+
+    return length;
+}
+
+// Formatting of text with variables to 'embed'
+// WARNING: String returned will expire after this function is called MAX_TEXTFORMAT_BUFFERS times on same thread
 const char *TextFormat(const char *text, ...)
 {
 #ifndef MAX_TEXTFORMAT_BUFFERS
@@ -1413,11 +2729,10 @@ const char *TextFormat(const char *text, ...)
 #endif
 
     // We create an array of buffers so strings don't expire until MAX_TEXTFORMAT_BUFFERS invocations
-    static char buffers[MAX_TEXTFORMAT_BUFFERS][MAX_TEXT_BUFFER_LENGTH] = { 0 };
-    static int index = 0;
+    static TEXT_THREAD_LOCAL char buffers[MAX_TEXTFORMAT_BUFFERS][MAX_TEXT_BUFFER_LENGTH] = { 0 };
+    static TEXT_THREAD_LOCAL int index = 0;
 
     char *currentBuffer = buffers[index];
-    memset(currentBuffer, 0, MAX_TEXT_BUFFER_LENGTH);   // Clear buffer before using
 
     va_list args;
     va_start(args, text);
@@ -1438,6 +2753,18 @@ const char *TextFormat(const char *text, ...)
     return currentBuffer;
 }
 
+// Formatting of text with variables to 'embed' into provided buffer
+// NOTE: Text is truncated to fit bufferSize (including '\0'), required text length is returned
+int TextFormatBuffer(char *buffer, int bufferSize, const char *text, ...)
+{
+    va_list args;
+    va_start(args, text);
+    int requiredByteCount = vsnprintf(buffer, (bufferSize > 0)? bufferSize : 0, text, args);
+    va_end(args);
+
+    return requiredByteCount;
+}
+
 // Get integer value from text
 // NOTE: This function replaces atoi() [stdlib.h]
 int TextToInteger(const char *text)
@@ -1528,173 +2855,194 @@ bool TextIsEqual(const char *text1, const char *text2)
 // Get a piece of a text string
 const char *TextSubtext(const char *text, int position, int length)
 {
-    static char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
-    memset(buffer, 0, MAX_TEXT_BUFFER_LENGTH);
+    static TEXT_THREAD_LOCAL char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
 
-    int textLength = TextLength(text);
-
-    if (position >= textLength)
-    {
-        position = textLength - 1;
-        length = 0;
-    }
+    TextSubtextBuffer(buffer, MAX_TEXT_BUFFER_LENGTH, text, position, length);
 
-    if (length >= textLength) length = textLength;
+    return buffer;
+}
 
-    // NOTE: Alternative: memcpy(buffer, text + position, length)
+// Get a piece of a text string into provided buffer
+// NOTE: Text is truncated to fit bufferSize (including '\0'), required text length is returned
+int TextSubtextBuffer(char *buffer, int bufferSize, const char *text, int position, int length)
+{
+    int textLength = TextLength(text);
 
-    for (int c = 0 ; c < length ; c++)
-    {
-        *(buffer + c) = *(text + position);
-        text++;
-    }
+    if (position < 0) position = 0;
+    if (position > textLength) position = textLength;
+    if (length > (textLength - position)) length = textLength - position;
+    if (length < 0) length = 0;
 
-    *(buffer + length) = '\0';
+    WriteTextBuffer(buffer, bufferSize, 0, text + position, length);
+    EndTextBuffer(buffer, bufferSize, length);
 
-    return buffer;
+    return length;
 }
 
 // Replace text string
-// REQUIRES: strlen(), strstr(), strncpy(), strcpy()
 // WARNING: Allocated memory must be manually freed
 char *TextReplace(const char *text, const char *replace, const char *by)
 {
     // Sanity checks and initialization
     if (!text || !replace || !by) return NULL;
+    if (TextLength(replace) == 0) return NULL;
 
-    char *result = NULL;
-
-    char *insertPoint = NULL;   // Next insert point
-    char *temp = NULL;          // Temp pointer
-    int replaceLen = 0;         // Replace string length of (the string to remove)
-    int byLen = 0;              // Replacement length (the string to replace by)
-    int lastReplacePos = 0;     // Distance between replace and end of last replace
-    int count = 0;              // Number of replacements
+    // Get required length and replace text into allocated string
+    int length = TextReplaceBuffer(NULL, 0, text, replace, by);
+    char *result = (char *)RL_MALLOC(length + 1);
 
-    replaceLen = TextLength(replace);
-    if (replaceLen == 0) return NULL;  // Empty replace causes infinite loop during count
-
-    byLen = TextLength(by);
+    if (!result) return NULL;   // Memory could not be allocated
 
-    // Count the number of replacements needed
-    insertPoint = (char *)text;
-    for (count = 0; (temp = strstr(insertPoint, replace)); count++) insertPoint = temp + replaceLen;
+    TextReplaceBuffer(result, length + 1, text, replace, by);
 
-    // Allocate returning string and point temp to it
-    temp = result = (char *)RL_MALLOC(TextLength(text) + (byLen - replaceLen)*count + 1);
+    return result;
+}
 
-    if (!result) return NULL;   // Memory could not be allocated
+// Replace text string into provided buffer
+// NOTE: Text is truncated to fit bufferSize (including '\0'), required text length is returned
+int TextReplaceBuffer(char *buffer, int bufferSize, const char *text, const char *replace, const char *by)
+{
+    int textLength = TextLength(text);
+    int replaceLength = TextLength(replace);
+    int byLength = TextLength(by);
+    int length = 0;
 
-    // First time through the loop, all the variable are set correctly from here on,
-    //  - 'temp' points to the end of the result string
-    //  - 'insertPoint' points to the next occurrence of replace in text
-    //  - 'text' points to the remainder of text after "end of replace"
-    while (count--)
+    // Copy text parts between replace occurrences, followed by the replacement
+    if (replaceLength > 0)
     {
-        insertPoint = strstr(text, replace);
-        lastReplacePos = (int)(insertPoint - text);
-        temp = strncpy(temp, text, lastReplacePos) + lastReplacePos;
-        temp = strcpy(temp, by) + byLen;
-        text += lastReplacePos + replaceLen; // Move to next "end of replace"
+        for (int index = FindTextIndex(text, textLength, replace, replaceLength); index >= 0; index = FindTextIndex(text, textLength, replace, replaceLength))
+        {
+            WriteTextBuffer(buffer, bufferSize, length, text, index);
+            WriteTextBuffer(buffer, bufferSize, length + index, by, byLength);
+            length += index + byLength;
+
+            text += index + replaceLength;
+            textLength -= index + replaceLength;
+        }
     }
 
-    // Copy remaind text part after replacement to result (pointed by moving temp)
-    strcpy(temp, text);
+    WriteTextBuffer(buffer, bufferSize, length, text, textLength);
+    length += textLength;
+    EndTextBuffer(buffer, bufferSize, length);
 
-    return result;
+    return length;
 }
 
 // Insert text in a specific position, moves all text forward
 // WARNING: Allocated memory must be manually freed
 char *TextInsert(const char *text, const char *insert, int position)
 {
-    int textLen = TextLength(text);
-    int insertLen = TextLength(insert);
-
-    char *result = (char *)RL_MALLOC(textLen + insertLen + 1);
-
-    for (int i = 0; i < position; i++) result[i] = text[i];
-    for (int i = position; i < insertLen + position; i++) result[i] = insert[i];
-    for (int i = (insertLen + position); i < (textLen + insertLen); i++) result[i] = text[i];
+    int length = TextInsertBuffer(NULL, 0, text, insert, position);
+    char *result = (char *)RL_MALLOC(length + 1);
 
-    result[textLen + insertLen] = '\0';     // Make sure text string is valid!
+    if (result != NULL) TextInsertBuffer(result, length + 1, text, insert, position);
 
     return result;
 }
 
+// Insert text in a specific position into provided buffer
+// NOTE: Text is truncated to fit bufferSize (including '\0'), required text length is returned
+int TextInsertBuffer(char *buffer, int bufferSize, const char *text, const char *insert, int position)
+{
+    int textLength = TextLength(text);
+    int insertLength = TextLength(insert);
+
+    if (position < 0) position = 0;
+    if (position > textLength) position = textLength;
+
+    WriteTextBuffer(buffer, bufferSize, 0, text, position);
+    WriteTextBuffer(buffer, bufferSize, position, insert, insertLength);
+    WriteTextBuffer(buffer, bufferSize, position + insertLength, text + position, textLength - position);
+    EndTextBuffer(buffer, bufferSize, textLength + insertLength);
+
+    return textLength + insertLength;
+}
+
 // Join text strings with delimiter
-// REQUIRES: memset(), memcpy()
 const char *TextJoin(const char **textList, int count, const char *delimiter)
 {
-    static char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
-    memset(buffer, 0, MAX_TEXT_BUFFER_LENGTH);
-    char *textPtr = buffer;
+    static TEXT_THREAD_LOCAL char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
+
+    TextJoinBuffer(buffer, MAX_TEXT_BUFFER_LENGTH, textList, count, delimiter);
 
-    int totalLength = 0;
-    int delimiterLen = TextLength(delimiter);
+    return buffer;
+}
+
+// Join text strings with delimiter into provided buffer
+// NOTE: Text is truncated to fit bufferSize (including '\0'), required text length is returned
+int TextJoinBuffer(char *buffer, int bufferSize, const char **textList, int count, const char *delimiter)
+{
+    int length = 0;
+    int delimiterLength = TextLength(delimiter);
 
     for (int i = 0; i < count; i++)
     {
         int textLength = TextLength(textList[i]);
 
-        // Make sure joined text could fit inside MAX_TEXT_BUFFER_LENGTH
-        if ((totalLength + textLength) < MAX_TEXT_BUFFER_LENGTH)
-        {
-            memcpy(textPtr, textList[i], textLength);
-            totalLength += textLength;
-            textPtr += textLength;
+        WriteTextBuffer(buffer, bufferSize, length, textList[i], textLength);
+        length += textLength;
 
-            if ((delimiterLen > 0) && (i < (count - 1)))
-            {
-                memcpy(textPtr, delimiter, delimiterLen);
-                totalLength += delimiterLen;
-                textPtr += delimiterLen;
-            }
+        if ((delimiterLength > 0) && (i < (count - 1)))
+        {
+            WriteTextBuffer(buffer, bufferSize, length, delimiter, delimiterLength);
+            length += delimiterLength;
         }
     }
 
-    return buffer;
+    EndTextBuffer(buffer, bufferSize, length);
+
+    return length;
 }
 
 // Split string into multiple strings
-// REQUIRES: memset()
 const char **TextSplit(const char *text, char delimiter, int *count)
 {
     // NOTE: Current implementation returns a copy of the provided string with '\0' (string end delimiter)
     // inserted between strings defined by "delimiter" parameter. No memory is dynamically allocated,
-    // all used memory is static... it has some limitations:
+    // all used memory is static (per thread)... it has some limitations:
     //      1. Maximum number of possible split strings is set by MAX_TEXTSPLIT_COUNT
     //      2. Maximum size of text to split is MAX_TEXT_BUFFER_LENGTH
 
-    static const char *result[MAX_TEXTSPLIT_COUNT] = { NULL };
-    static char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
-    memset(buffer, 0, MAX_TEXT_BUFFER_LENGTH);
+    static TEXT_THREAD_LOCAL const char *result[MAX_TEXTSPLIT_COUNT] = { NULL };
+    static TEXT_THREAD_LOCAL char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
 
     result[0] = buffer;
+    buffer[0] = '\0';
+
+    *count = TextSplitBuffer(buffer, MAX_TEXT_BUFFER_LENGTH, text, delimiter, result, MAX_TEXTSPLIT_COUNT);
+
+    return result;
+}
+
+// Split string into multiple strings using provided buffer and substrings pointers array
+// NOTE: Text is copied into buffer (truncated to fit bufferSize) with '\0' inserted at every delimiter,
+// once maxCount substrings are found, last substring contains the remaining text
+int TextSplitBuffer(char *buffer, int bufferSize, const char *text, char delimiter, const char **result, int maxCount)
+{
     int counter = 0;
 
-    if (text != NULL)
+    if ((text != NULL) && (bufferSize > 0) && (maxCount > 0))
     {
+        int length = TextLength(text);
+        if (length > (bufferSize - 1)) length = bufferSize - 1;
+
+        memcpy(buffer, text, length);
+        buffer[length] = '\0';
+
+        result[0] = buffer;
         counter = 1;
 
-        // Count how many substrings we have on text and point to every one
-        for (int i = 0; i < MAX_TEXT_BUFFER_LENGTH; i++)
+        // Point to every substring, setting an end of string at delimiters
+        for (char *ptr = (char *)memchr(buffer, delimiter, length); (ptr != NULL) && (counter < maxCount); ptr = (char *)memchr(ptr, delimiter, length - (ptr - buffer)))
         {
-            buffer[i] = text[i];
-            if (buffer[i] == '\0') break;
-            else if (buffer[i] == delimiter)
-            {
-                buffer[i] = '\0';   // Set an end of string at this point
-                result[counter] = buffer + i + 1;
-                counter++;
-
-                if (counter == MAX_TEXTSPLIT_COUNT) break;
-            }
+            *ptr = '\0';
+            ptr++;
+            result[counter] = ptr;
+            counter++;
         }
     }
 
-    *count = counter;
-    return result;
+    return counter;
 }
 
 // Append text at specific position and move cursor
@@ -1707,16 +3055,9 @@ void TextAppend(char *text, const char *append, int *position)
 }
 
 // Find first text occurrence within a string
-// REQUIRES: strstr()
 int TextFindIndex(const char *text, const char *find)
 {
-    int position = -1;
-
-    char *ptr = strstr(text, find);
-
-    if (ptr != NULL) position = (int)(ptr - text);
-
-    return position;
+    return FindTextIndex(text, TextLength(text), find, TextLength(find));
 }
 
 // Get upper case version of provided string
@@ -1724,122 +3065,196 @@ int TextFindIndex(const char *text, const char *find)
 // TODO: Support UTF-8 diacritics to upper-case, check codepoints
 const char *TextToUpper(const char *text)
 {
-    static char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
-    memset(buffer, 0, MAX_TEXT_BUFFER_LENGTH);
+    static TEXT_THREAD_LOCAL char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
+
+    TextToUpperBuffer(buffer, MAX_TEXT_BUFFER_LENGTH, text);
+
+    return buffer;
+}
+
+// Get upper case version of provided string into provided buffer
+// NOTE: Text is truncated to fit bufferSize (including '\0'), required text length is returned
+int TextToUpperBuffer(char *buffer, int bufferSize, const char *text)
+{
+    int length = 0;
 
     if (text != NULL)
     {
-        for (int i = 0; (i < MAX_TEXT_BUFFER_LENGTH - 1) && (text[i] != '\0'); i++)
+        for (; text[length] != '\0'; length++)
         {
-            if ((text[i] >= 'a') && (text[i] <= 'z')) buffer[i] = text[i] - 32;
-            else buffer[i] = text[i];
+            if (length >= (bufferSize - 1)) continue;
+
+            if ((text[length] >= 'a') && (text[length] <= 'z')) buffer[length] = text[length] - 32;
+            else buffer[length] = text[length];
         }
     }
 
-    return buffer;
+    EndTextBuffer(buffer, bufferSize, length);
+
+    return length;
 }
 
 // Get lower case version of provided string
 // WARNING: Limited functionality, only basic characters set
 const char *TextToLower(const char *text)
 {
-    static char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
-    memset(buffer, 0, MAX_TEXT_BUFFER_LENGTH);
+    static TEXT_THREAD_LOCAL char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
+
+    TextToLowerBuffer(buffer, MAX_TEXT_BUFFER_LENGTH, text);
+
+    return buffer;
+}
+
+// Get lower case version of provided string into provided buffer
+// NOTE: Text is truncated to fit bufferSize (including '\0'), required text length is returned
+int TextToLowerBuffer(char *buffer, int bufferSize, const char *text)
+{
+    int length = 0;
 
     if (text != NULL)
     {
-        for (int i = 0; (i < MAX_TEXT_BUFFER_LENGTH - 1) && (text[i] != '\0'); i++)
+        for (; text[length] != '\0'; length++)
         {
-            if ((text[i] >= 'A') && (text[i] <= 'Z')) buffer[i] = text[i] + 32;
-            else buffer[i] = text[i];
+            if (length >= (bufferSize - 1)) continue;
+
+            if ((text[length] >= 'A') && (text[length] <= 'Z')) buffer[length] = text[length] + 32;
+            else buffer[length] = text[length];
         }
     }
 
-    return buffer;
+    EndTextBuffer(buffer, bufferSize, length);
+
+    return length;
 }
 
 // Get Pascal case notation version of provided string
 // WARNING: Limited functionality, only basic characters set
 const char *TextToPascal(const char *text)
 {
-    static char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
-    memset(buffer, 0, MAX_TEXT_BUFFER_LENGTH);
+    static TEXT_THREAD_LOCAL char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
 
-    if (text != NULL)
-    {
-        // Upper case first character
-        if ((text[0] >= 'a') && (text[0] <= 'z')) buffer[0] = text[0] - 32;
-        else buffer[0] = text[0];
+    TextToPascalBuffer(buffer, MAX_TEXT_BUFFER_LENGTH, text);
+
+    return buffer;
+}
+
+// Get Pascal case notation version of provided string into provided buffer
+// NOTE: Text is truncated to fit bufferSize (including '\0'), required text length is returned
+int TextToPascalBuffer(char *buffer, int bufferSize, const char *text)
+{
+    int length = 0;
 
-        // Check for next separator to upper case another character
-        for (int i = 1, j = 1; (i < MAX_TEXT_BUFFER_LENGTH - 1) && (text[j] != '\0'); i++, j++)
+    if ((text != NULL) && (text[0] != '\0'))
+    {
+        // Upper case first character and next character after every separator
+        for (int j = 0; text[j] != '\0'; j++, length++)
         {
-            if (text[j] != '_') buffer[i] = text[j];
-            else
+            char c = text[j];
+
+            if (j == 0) { if ((c >= 'a') && (c <= 'z')) c -= 32; }
+            else if (c == '_')
             {
+                if (text[j + 1] == '\0') break;
+
                 j++;
-                if ((text[j] >= 'a') && (text[j] <= 'z')) buffer[i] = text[j] - 32;
+                c = text[j];
+                if ((c >= 'a') && (c <= 'z')) c -= 32;
             }
+
+            if (length < (bufferSize - 1)) buffer[length] = c;
         }
     }
 
-    return buffer;
+    EndTextBuffer(buffer, bufferSize, length);
+
+    return length;
 }
 
 // Get snake case notation version of provided string
 // WARNING: Limited functionality, only basic characters set
 const char *TextToSnake(const char *text)
 {
-    static char buffer[MAX_TEXT_BUFFER_LENGTH] = {0};
-    memset(buffer, 0, MAX_TEXT_BUFFER_LENGTH);
+    static TEXT_THREAD_LOCAL char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
+
+    TextToSnakeBuffer(buffer, MAX_TEXT_BUFFER_LENGTH, text);
+
+    return buffer;
+}
+
+// Get snake case notation version of provided string into provided buffer
+// NOTE: Text is truncated to fit bufferSize (including '\0'), required text length is returned
+int TextToSnakeBuffer(char *buffer, int bufferSize, const char *text)
+{
+    int length = 0;
 
     if (text != NULL)
     {
-        // Check for next separator to upper case another character
-        for (int i = 0, j = 0; (i < MAX_TEXT_BUFFER_LENGTH - 1) && (text[j] != '\0'); i++, j++)
+        // Lower case upper case characters, adding a separator before them
+        for (int j = 0; text[j] != '\0'; j++, length++)
         {
-            if ((text[j] >= 'A') && (text[j] <= 'Z'))
+            char c = text[j];
+
+            if ((c >= 'A') && (c <= 'Z'))
             {
-                if (i >= 1)
+                if (length >= 1)
                 {
-                    buffer[i] = '_';
-                    i++;
+                    if (length < (bufferSize - 1)) buffer[length] = '_';
+                    length++;
                 }
-                buffer[i] = text[j] + 32;
+
+                c += 32;
             }
-            else buffer[i] = text[j];
+
+            if (length < (bufferSize - 1)) buffer[length] = c;
         }
     }
 
-    return buffer;
+    EndTextBuffer(buffer, bufferSize, length);
+
+    return length;
 }
 
 // Get Camel case notation version of provided string
 // WARNING: Limited functionality, only basic characters set
 const char *TextToCamel(const char *text)
 {
-    static char buffer[MAX_TEXT_BUFFER_LENGTH] = {0};
-    memset(buffer, 0, MAX_TEXT_BUFFER_LENGTH);
+    static TEXT_THREAD_LOCAL char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
 
-    if (text != NULL)
-    {
-        // Lower case first character
-        if ((text[0] >= 'A') && (text[0] <= 'Z')) buffer[0] = text[0] + 32;
-        else buffer[0] = text[0];
+    TextToCamelBuffer(buffer, MAX_TEXT_BUFFER_LENGTH, text);
+
+    return buffer;
+}
 
-        // Check for next separator to upper case another character
-        for (int i = 1, j = 1; (i < MAX_TEXT_BUFFER_LENGTH - 1) && (text[j] != '\0'); i++, j++)
+// Get Camel case notation version of provided string into provided buffer
+// NOTE: Text is truncated to fit bufferSize (including '\0'), required text length is returned
+int TextToCamelBuffer(char *buffer, int bufferSize, const char *text)
+{
+    int length = 0;
+
+    if ((text != NULL) && (text[0] != '\0'))
+    {
+        // Lower case first character, upper case next character after every separator
+        for (int j = 0; text[j] != '\0'; j++, length++)
         {
-            if (text[j] != '_') buffer[i] = text[j];
-            else
+            char c = text[j];
+
+            if (j == 0) { if ((c >= 'A') && (c <= 'Z')) c += 32; }
+            else if (c == '_')
             {
+                if (text[j + 1] == '\0') break;
+
                 j++;
-                if ((text[j] >= 'a') && (text[j] <= 'z')) buffer[i] = text[j] - 32;
+                c = text[j];
+                if ((c >= 'a') && (c <= 'z')) c -= 32;
             }
+
+            if (length < (bufferSize - 1)) buffer[length] = c;
         }
     }
 
-    return buffer;
+    EndTextBuffer(buffer, bufferSize, length);
+
+    return length;
 }
 
 // Encode text codepoint into UTF-8 text
@@ -1860,280 +3275,1809 @@ char *LoadUTF8(const int *codepoints, int length)
         size += bytes;
     }
 
-    // Resize memory to text length + string NULL terminator
-    void *ptr = RL_REALLOC(text, size + 1);
+    // Resize memory to text length + string NULL terminator
+    void *ptr = RL_REALLOC(text, size + 1);
+
+    if (ptr != NULL) text = (char *)ptr;
+
+    return text;
+}
+
+// Unload UTF-8 text encoded from codepoints array
+void UnloadUTF8(char *text)
+{
+    RL_FREE(text);
+}
+
+// Load all codepoints from a UTF-8 text string, codepoints count returned by parameter
+int *LoadCodepoints(const char *text, int *count)
+{
+    int textLength = TextLength(text);
+
+    // Allocate a big enough buffer to store as many codepoints as text bytes
+    int *codepoints = (int *)RL_CALLOC(textLength, sizeof(int));
+    int codepointCount = DecodeTextUTF8(text, textLength, codepoints);
+
+    // Re-allocate buffer to the actual number of codepoints loaded
+    codepoints = (int *)RL_REALLOC(codepoints, codepointCount*sizeof(int));
+
+    *count = codepointCount;
+
+    return codepoints;
+}
+
+// Unload codepoints data from memory
+void UnloadCodepoints(int *codepoints)
+{
+    RL_FREE(codepoints);
+}
+
+// Get total number of characters(codepoints) in a UTF-8 encoded text, until '\0' is found
+// NOTE: If an invalid UTF-8 sequence is encountered a '?'(0x3f) codepoint is counted instead
+int GetCodepointCount(const char *text)
+{
+    return DecodeTextUTF8(text, TextLength(text), NULL);
+}
+
+// Encode codepoint into utf8 text (char array length returned as parameter)
+// NOTE: It uses a static array (per thread) to store UTF-8 bytes
+const char *CodepointToUTF8(int codepoint, int *utf8Size)
+{
+    static TEXT_THREAD_LOCAL char utf8[6] = { 0 };
+    int size = 0;   // Byte size of codepoint
+
+    if (codepoint <= 0x7f)
+    {
+        utf8[0] = (char)codepoint;
+        size = 1;
+    }
+    else if (codepoint <= 0x7ff)
+    {
+        utf8[0] = (char)(((codepoint >> 6) & 0x1f) | 0xc0);
+        utf8[1] = (char)((codepoint & 0x3f) | 0x80);
+        size = 2;
+    }
+    else if (codepoint <= 0xffff)
+    {
+        utf8[0] = (char)(((codepoint >> 12) & 0x0f) | 0xe0);
+        utf8[1] = (char)(((codepoint >>  6) & 0x3f) | 0x80);
+        utf8[2] = (char)((codepoint & 0x3f) | 0x80);
+        size = 3;
+    }
+    else if (codepoint <= 0x10ffff)
+    {
+        utf8[0] = (char)(((codepoint >> 18) & 0x07) | 0xf0);
+        utf8[1] = (char)(((codepoint >> 12) & 0x3f) | 0x80);
+        utf8[2] = (char)(((codepoint >>  6) & 0x3f) | 0x80);
+        utf8[3] = (char)((codepoint & 0x3f) | 0x80);
+        size = 4;
+    }
+
+    *utf8Size = size;
+
+    return utf8;
+}
+#endif      // SUPPORT_TEXT_MANIPULATION
+
+// Get next codepoint in a UTF-8 encoded text, scanning until '\0' is found
+// When an invalid UTF-8 byte is encountered we exit as soon as possible and a '?'(0x3f) codepoint is returned
+// Total number of bytes processed are returned as a parameter
+// NOTE: The standard says U+FFFD should be returned in case of errors
+// but that character is not supported by the default font in raylib
+int GetCodepoint(const char *text, int *codepointSize)
+{
+/*
+    UTF-8 specs from https://www.ietf.org/rfc/rfc3629.txt
+
+    Char. number range  |        UTF-8 octet sequence
+      (hexadecimal)    |              (binary)
+    --------------------+---------------------------------------------
+    0000 0000-0000 007F | 0xxxxxxx
+    0000 0080-0000 07FF | 110xxxxx 10xxxxxx
+    0000 0800-0000 FFFF | 1110xxxx 10xxxxxx 10xxxxxx
+    0001 0000-0010 FFFF | 11110xxx 10xxxxxx 10xxxxxx 10xxxxxx
+*/
+    // NOTE: on decode errors we return as soon as possible
+
+    int codepoint = 0x3f;   // Codepoint (defaults to '?')
+    int octet = (unsigned char)(text[0]); // The first UTF8 octet
+    *codepointSize = 1;
+
+    if (octet <= 0x7f)
+    {
+        // Only one octet (ASCII range x00-7F)
+        codepoint = text[0];
+    }
+    else if ((octet & 0xe0) == 0xc0)
+    {
+        // Two octets
+
+        // [0]xC2-DF    [1]UTF8-tail(x80-BF)
+        unsigned char octet1 = text[1];
+
+        if ((octet1 == '\0') || ((octet1 >> 6) != 2)) { *codepointSize = 2; return codepoint; } // Unexpected sequence
+
+        if ((octet >= 0xc2) && (octet <= 0xdf))
+        {
+            codepoint = ((octet & 0x1f) << 6) | (octet1 & 0x3f);
+            *codepointSize = 2;
+        }
+    }
+    else if ((octet & 0xf0) == 0xe0)
+    {
+        // Three octets
+        unsigned char octet1 = text[1];
+        unsigned char octet2 = '\0';
+
+        if ((octet1 == '\0') || ((octet1 >> 6) != 2)) { *codepointSize = 2; return codepoint; } // Unexpected sequence
+
+        octet2 = text[2];
+
+        if ((octet2 == '\0') || ((octet2 >> 6) != 2)) { *codepointSize = 3; return codepoint; } // Unexpected sequence
+
+        // [0]xE0    [1]xA0-BF       [2]UTF8-tail(x80-BF)
+        // [0]xE1-EC [1]UTF8-tail    [2]UTF8-tail(x80-BF)
+        // [0]xED    [1]x80-9F       [2]UTF8-tail(x80-BF)
+        // [0]xEE-EF [1]UTF8-tail    [2]UTF8-tail(x80-BF)
+
+        if (((octet == 0xe0) && !((octet1 >= 0xa0) && (octet1 <= 0xbf))) ||
+            ((octet == 0xed) && !((octet1 >= 0x80) && (octet1 <= 0x9f)))) { *codepointSize = 2; return codepoint; }
+
+        if ((octet >= 0xe0) && (octet <= 0xef))
+        {
+            codepoint = ((octet & 0xf) << 12) | ((octet1 & 0x3f) << 6) | (octet2 & 0x3f);
+            *codepointSize = 3;
+        }
+    }
+    else if ((octet & 0xf8) == 0xf0)
+    {
+        // Four octets
+        if (octet > 0xf4) return codepoint;
+
+        unsigned char octet1 = text[1];
+        unsigned char octet2 = '\0';
+        unsigned char octet3 = '\0';
+
+        if ((octet1 == '\0') || ((octet1 >> 6) != 2)) { *codepointSize = 2; return codepoint; }  // Unexpected sequence
+
+        octet2 = text[2];
+
+        if ((octet2 == '\0') || ((octet2 >> 6) != 2)) { *codepointSize = 3; return codepoint; }  // Unexpected sequence
+
+        octet3 = text[3];
+
+        if ((octet3 == '\0') || ((octet3 >> 6) != 2)) { *codepointSize = 4; return codepoint; }  // Unexpected sequence
+
+        // [0]xF0       [1]x90-BF       [2]UTF8-tail  [3]UTF8-tail
+        // [0]xF1-F3    [1]UTF8-tail    [2]UTF8-tail  [3]UTF8-tail
+        // [0]xF4       [1]x80-8F       [2]UTF8-tail  [3]UTF8-tail
+
+        if (((octet == 0xf0) && !((octet1 >= 0x90) && (octet1 <= 0xbf))) ||
+            ((octet == 0xf4) && !((octet1 >= 0x80) && (octet1 <= 0x8f)))) { *codepointSize = 2; return codepoint; } // Unexpected sequence
+
+        if (octet >= 0xf0)
+        {
+            codepoint = ((octet & 0x7) << 18) | ((octet1 & 0x3f) << 12) | ((octet2 & 0x3f) << 6) | (octet3 & 0x3f);
+            *codepointSize = 4;
+        }
+    }
+
+    if (codepoint > 0x10ffff) codepoint = 0x3f;     // Codepoints after U+10ffff are invalid
+
+    return codepoint;
+}
+
+// Get next codepoint in a byte sequence and bytes processed
+// NOTE: Overlong sequences, surrogates and codepoints over 0x10ffff are invalid, '?'(0x3f) is returned for 1 byte
+int GetCodepointNext(const char *text, int *codepointSize)
+{
+    const unsigned char *ptr = (const unsigned char *)text;
+    int codepoint = 0x3f;       // Codepoint (defaults to '?')
+    *codepointSize = 1;
+
+    // Get current codepoint and bytes processed
+    // NOTE: Continuation bytes are checked in order, so bytes after a '\0' are never read
+    if (ptr[0] < 0x80)
+    {
+        // 1 byte UTF-8 codepoint
+        codepoint = ptr[0];
+    }
+    else if (0xc0 == (0xe0 & ptr[0]))
+    {
+        // 2 byte UTF-8 codepoint
+        if ((ptr[1] & 0xc0) != 0x80) return codepoint;     // 10xxxxxx checks
+
+        int value = ((0x1f & ptr[0]) << 6) | (0x3f & ptr[1]);
+        if (value >= 0x80) { codepoint = value; *codepointSize = 2; }
+    }
+    else if (0xe0 == (0xf0 & ptr[0]))
+    {
+        // 3 byte UTF-8 codepoint
+        if (((ptr[1] & 0xc0) != 0x80) || ((ptr[2] & 0xc0) != 0x80)) return codepoint;   // 10xxxxxx checks
+
+        int value = ((0x0f & ptr[0]) << 12) | ((0x3f & ptr[1]) << 6) | (0x3f & ptr[2]);
+        if ((value >= 0x800) && ((value < 0xd800) || (value > 0xdfff))) { codepoint = value; *codepointSize = 3; }
+    }
+    else if (0xf0 == (0xf8 & ptr[0]))
+    {
+        // 4 byte UTF-8 codepoint
+        if (((ptr[1] & 0xc0) != 0x80) || ((ptr[2] & 0xc0) != 0x80) || ((ptr[3] & 0xc0) != 0x80)) return codepoint;  // 10xxxxxx checks
+
+        int value = ((0x07 & ptr[0]) << 18) | ((0x3f & ptr[1]) << 12) | ((0x3f & ptr[2]) << 6) | (0x3f & ptr[3]);
+        if ((value >= 0x10000) && (value <= 0x10ffff)) { codepoint = value; *codepointSize = 4; }
+    }
+
+    return codepoint;
+}
+
+// Get previous codepoint in a byte sequence and bytes processed
+int GetCodepointPrevious(const char *text, int *codepointSize)
+{
+    const char *ptr = text;
+    int codepoint = 0x3f;       // Codepoint (defaults to '?')
+    int cpSize = 0;
+    *codepointSize = 0;
+
+    // Move to previous codepoint
+    do ptr--;
+    while (((0x80 & ptr[0]) != 0) && ((0xc0 & ptr[0]) ==  0x80));
+
+    codepoint = GetCodepointNext(ptr, &cpSize);
+
+    if (codepoint != 0) *codepointSize = cpSize;
+
+    return codepoint;
+}
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Definition
+//----------------------------------------------------------------------------------
+#if defined(SUPPORT_FILEFORMAT_TTF)
+// Load font glyphs data for a rasterization job
+// NOTE: Font info data is only read, jobs can be processed concurrently
+static void LoadFontGlyphs(FontGlyphsJob *job)
+{
+    for (int i = job->first; i < job->glyphCount; i += job->step)
+    {
+        GlyphInfo *glyph = &job->glyphs[i];
+        int chw = 0, chh = 0;   // Character width and height (on generation)
+        int ch = job->codepoints[i];  // Character value to get info for
+        glyph->value = ch;
+
+        //  Render a unicode codepoint to a bitmap
+        //      stbtt_GetCodepointBitmap()           -- allocates and returns a bitmap
+        //      stbtt_GetCodepointBitmapBox()        -- how big the bitmap must be
+        //      stbtt_MakeCodepointBitmap()          -- renders into bitmap you provide
+
+        // Check if a glyph is available in the font
+        // WARNING: if (index == 0), glyph not found, it could fallback to default .notdef glyph (if defined in font)
+        int index = stbtt_FindGlyphIndex(job->fontInfo, ch);
+
+        if (index > 0)
+        {
+            switch (job->type)
+            {
+                case FONT_DEFAULT:
+                case FONT_BITMAP: glyph->image.data = stbtt_GetCodepointBitmap(job->fontInfo, job->scaleFactor, job->scaleFactor, ch, &chw, &chh, &glyph->offsetX, &glyph->offsetY); break;
+                case FONT_SDF: if (ch != 32) glyph->image.data = stbtt_GetCodepointSDF(job->fontInfo, job->scaleFactor, ch, FONT_SDF_CHAR_PADDING, FONT_SDF_ON_EDGE_VALUE, FONT_SDF_PIXEL_DIST_SCALE, &chw, &chh, &glyph->offsetX, &glyph->offsetY); break;
+                case FONT_MSDF: if (ch != 32) glyph->image.data = GenFontGlyphMSDF(job->fontInfo, index, job->scaleFactor, &chw, &chh, &glyph->offsetX, &glyph->offsetY); break;
+                default: break;
+            }
+
+            if (glyph->image.data != NULL)    // Glyph data has been found in the font
+            {
+                stbtt_GetCodepointHMetrics(job->fontInfo, ch, &glyph->advanceX, NULL);
+                glyph->advanceX = (int)((float)glyph->advanceX*job->scaleFactor);
+
+                if (chh > job->fontSize) TRACELOG(LOG_WARNING, "FONT: Character [0x%08x] size is bigger than expected font size", ch);
+
+                // Load characters images
+                glyph->image.width = chw;
+                glyph->image.height = chh;
+                glyph->image.mipmaps = 1;
+                glyph->image.format = (job->type == FONT_MSDF)? PIXELFORMAT_UNCOMPRESSED_R8G8B8 : PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
+
+                glyph->offsetY += (int)((float)job->ascent*job->scaleFactor);
+            }
+
+            // NOTE: We create an empty image for space character,
+            // it could be further required for atlas packing
+            if (ch == 32)
+            {
+                stbtt_GetCodepointHMetrics(job->fontInfo, ch, &glyph->advanceX, NULL);
+                glyph->advanceX = (int)((float)glyph->advanceX*job->scaleFactor);
+
+                Image imSpace = {
+                    .data = RL_CALLOC(glyph->advanceX*job->fontSize, (job->type == FONT_MSDF)? 3 : 2),
+                    .width = glyph->advanceX,
+                    .height = job->fontSize,
+                    .mipmaps = 1,
+                    .format = (job->type == FONT_MSDF)? PIXELFORMAT_UNCOMPRESSED_R8G8B8 : PIXELFORMAT_UNCOMPRESSED_GRAYSCALE
+                };
+
+                glyph->image = imSpace;
+            }
+
+            if (job->type == FONT_BITMAP)
+            {
+                // Aliased bitmap (black & white) font generation, avoiding anti-aliasing
+                // NOTE: For optimum results, bitmap font should be generated at base pixel size
+                for (int p = 0; p < chw*chh; p++)
+                {
+                    if (((unsigned char *)glyph->image.data)[p] < FONT_BITMAP_ALPHA_THRESHOLD) ((unsigned char *)glyph->image.data)[p] = 0;
+                    else ((unsigned char *)glyph->image.data)[p] = 255;
+                }
+            }
+        }
+        else
+        {
+            // TODO: Use some fallback glyph for codepoints not found in the font
+        }
+    }
+}
+#endif
+
+#if defined(FONT_TTF_THREADS)
+// Load font glyphs thread
+#if defined(_WIN32)
+static unsigned long __stdcall LoadFontGlyphsThread(void *job)
+{
+    LoadFontGlyphs((FontGlyphsJob *)job);
+    return 0;
+}
+#else
+static void *LoadFontGlyphsThread(void *job)
+{
+    LoadFontGlyphs((FontGlyphsJob *)job);
+    return NULL;
+}
+#endif
+#endif
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+// Generate glyph multi-channel signed distance field (MSDF) image data (R8G8B8)
+// NOTE: Outline curves are flattened into line segments and edges are colored by channels,
+// edges meeting at a sharp corner share only one channel, so channels median keeps the corner
+static unsigned char *GenFontGlyphMSDF(const stbtt_fontinfo *fontInfo, int index, float scale, int *width, int *height, int *offsetX, int *offsetY)
+{
+    unsigned char *data = NULL;
+    stbtt_vertex *vertices = NULL;
+    int vertexCount = stbtt_GetGlyphShape(fontInfo, index, &vertices);
+
+    if (vertexCount <= 0) return NULL;
+
+    // Flatten glyph outline into edges and line segments (pixels, Y-down)
+    int maxSegments = 0;
+    for (int i = 0; i < vertexCount; i++) maxSegments += (vertices[i].type == STBTT_vline)? 1 : FONT_MSDF_MAX_CURVE_STEPS;
+
+    FontMSDFSegment *segments = (FontMSDFSegment *)RL_MALLOC(maxSegments*sizeof(FontMSDFSegment));
+    FontMSDFEdge *edges = (FontMSDFEdge *)RL_MALLOC(vertexCount*sizeof(FontMSDFEdge));
+    int *contours = (int *)RL_MALLOC((vertexCount + 1)*sizeof(int));     // Contours first edge
+    int *corners = (int *)RL_MALLOC(vertexCount*sizeof(int));           // Contour edges starting at a corner
+    int segmentCount = 0;
+    int edgeCount = 0;
+    int contourCount = 0;
+    float area = 0.0f;
+    Vector2 point = { 0 };
+
+    for (int i = 0; i < vertexCount; i++)
+    {
+        stbtt_vertex *vertex = &vertices[i];
+        Vector2 next = { vertex->x*scale, -vertex->y*scale };
+        Vector2 control0 = { vertex->cx*scale, -vertex->cy*scale };
+        Vector2 control1 = { vertex->cx1*scale, -vertex->cy1*scale };
+
+        if (vertex->type == STBTT_vmove) contours[contourCount++] = edgeCount;
+        else if ((vertex->type != STBTT_vline) || (next.x != point.x) || (next.y != point.y))
+        {
+            int steps = 1;
+
+            if (vertex->type != STBTT_vline)
+            {
+                // Curve flattened from control polygon length, one segment every 2 pixels
+                float length = hypotf(control0.x - point.x, control0.y - point.y);
+                if (vertex->type == STBTT_vcurve) length += hypotf(next.x - control0.x, next.y - control0.y);
+                else length += hypotf(control1.x - control0.x, control1.y - control0.y) + hypotf(next.x - control1.x, next.y - control1.y);
+
+                steps = 1 + (int)(length/2.0f);
+                if (steps > FONT_MSDF_MAX_CURVE_STEPS) steps = FONT_MSDF_MAX_CURVE_STEPS;
+            }
+
+            edges[edgeCount] = (FontMSDFEdge){ segmentCount, steps, 7 };
+            Vector2 start = point;
+
+            for (int s = 1; s <= steps; s++)
+            {
+                float t = (float)s/(float)steps;
+                float it = 1.0f - t;
+                Vector2 end = next;
+
+                if (s < steps)
+                {
+                    if (vertex->type == STBTT_vcurve)
+                    {
+                        end.x = it*it*point.x + 2.0f*it*t*control0.x + t*t*next.x;
+                        end.y = it*it*point.y + 2.0f*it*t*control0.y + t*t*next.y;
+                    }
+                    else
+                    {
+                        end.x = it*it*it*point.x + 3.0f*it*it*t*control0.x + 3.0f*it*t*t*control1.x + t*t*t*next.x;
+                        end.y = it*it*it*point.y + 3.0f*it*it*t*control0.y + 3.0f*it*t*t*control1.y + t*t*t*next.y;
+                    }
+                }
+
+                segments[segmentCount++] = (FontMSDFSegment){ start, end, edgeCount };
+                area += start.x*end.y - end.x*start.y;
+                start = end;
+            }
+
+            edgeCount++;
+        }
+
+        point = next;
+    }
+
+    contours[contourCount] = edgeCount;
+
+    // Color contours edges, channels change only at corners
+    for (int c = 0; c < contourCount; c++)
+    {
+        int first = contours[c];
+        int count = contours[c + 1] - first;
+        int cornerCount = 0;
+
+        for (int e = 0; e < count; e++)
+        {
+            FontMSDFEdge *previous = &edges[first + (e + count - 1)%count];
+            FontMSDFSegment *a = &segments[previous->firstSegment + previous->segmentCount - 1];
+            FontMSDFSegment *b = &segments[edges[first + e].firstSegment];
+
+            Vector2 da = { a->end.x - a->start.x, a->end.y - a->start.y };
+            Vector2 db = { b->end.x - b->start.x, b->end.y - b->start.y };
+            float lengths = hypotf(da.x, da.y)*hypotf(db.x, db.y);
+
+            if (lengths > 0.0f)
+            {
+                float dot = (da.x*db.x + da.y*db.y)/lengths;
+                float cross = (da.x*db.y - da.y*db.x)/lengths;
+
+                // Direction changes more than ~8 degrees, sin(3 radians) used as threshold
+                if ((dot <= 0.0f) || (fabsf(cross) > 0.1411f)) corners[cornerCount++] = e;
+            }
+        }
+
+        if ((cornerCount == 1) && (count > 1))
+        {
+            // Teardrop contour, edges meeting at the corner share only red channel
+            edges[first + corners[0]].color = 5;                    // Magenta
+            edges[first + (corners[0] + count - 1)%count].color = 3; // Yellow
+        }
+        else if (cornerCount > 1)
+        {
+            // Edges between corners share color, consecutive colors differ: cyan, magenta, yellow
+            const int colors[3] = { 6, 5, 3 };
+
+            for (int k = 0; k < cornerCount; k++)
+            {
+                int color = colors[k%3];
+                if ((k == (cornerCount - 1)) && ((k%3) == 0)) color = colors[1];  // Last color must differ from first
+
+                int end = (k < (cornerCount - 1))? corners[k + 1] : corners[0] + count;
+                for (int e = corners[k]; e < end; e++) edges[first + e%count].color = color;
+            }
+        }
+    }
+
+    // Distances sign depends on outline orientation, inside distances are positive
+    float orientation = (area > 0.0f)? 1.0f : -1.0f;
+
+    int ix0 = 0, iy0 = 0, ix1 = 0, iy1 = 0;
+    stbtt_GetGlyphBitmapBox(fontInfo, index, scale, scale, &ix0, &iy0, &ix1, &iy1);
+
+    *width = ix1 - ix0 + 2*FONT_MSDF_CHAR_PADDING;
+    *height = iy1 - iy0 + 2*FONT_MSDF_CHAR_PADDING;
+    *offsetX = ix0 - FONT_MSDF_CHAR_PADDING;
+    *offsetY = iy0 - FONT_MSDF_CHAR_PADDING;
+
+    data = (unsigned char *)RL_MALLOC((*width)*(*height)*3);
+
+    for (int y = 0; y < *height; y++)
+    {
+        for (int x = 0; x < *width; x++)
+        {
+            Vector2 p = { (float)(*offsetX + x) + 0.5f, (float)(*offsetY + y) + 0.5f };
+            float channelDistance[3] = { 1e30f, 1e30f, 1e30f };
+            float channelOrthogonality[3] = { 0 };
+            int channelSegment[3] = { -1, -1, -1 };
+            float minDistance = 1e30f;
+            int winding = 0;
+
+            // Find nearest segment for each channel, ties on shared endpoints are solved
+            // choosing the segment most orthogonal to the point direction
+            for (int i = 0; i < segmentCount; i++)
+            {
+                FontMSDFSegment *segment = &segments[i];
+                Vector2 d = { segment->end.x - segment->start.x, segment->end.y - segment->start.y };
+                Vector2 ap = { p.x - segment->start.x, p.y - segment->start.y };
+                float length2 = d.x*d.x + d.y*d.y;
+                float t = (length2 > 0.0f)? (ap.x*d.x + ap.y*d.y)/length2 : 0.0f;
+
+                if (t < 0.0f) t = 0.0f;
+                else if (t > 1.0f) t = 1.0f;
+
+                Vector2 qp = { ap.x - d.x*t, ap.y - d.y*t };
+                float distance = hypotf(qp.x, qp.y);
+                float orthogonality = ((distance > 0.0f) && (length2 > 0.0f))? fabsf(d.x*qp.y - d.y*qp.x)/(sqrtf(length2)*distance) : 0.0f;
+
+                if (distance < minDistance) minDistance = distance;
+
+                // Non-zero winding rule, horizontal ray to the right
+                if ((segment->start.y <= p.y) != (segment->end.y <= p.y))
+                {
+                    float crossX = segment->start.x + (p.y - segment->start.y)*d.x/d.y;
+                    if (crossX > p.x) winding += (d.y > 0.0f)? 1 : -1;
+                }
+
+                int color = edges[segment->edge].color;
+
+                for (int ch = 0; ch < 3; ch++)
+                {
+                    if ((color & (1 << ch)) && ((distance < (channelDistance[ch] - 1e-5f)) ||
+                        ((fabsf(distance - channelDistance[ch]) <= 1e-5f) && (orthogonality > channelOrthogonality[ch]))))
+                    {
+                        channelDistance[ch] = distance;
+                        channelOrthogonality[ch] = orthogonality;
+                        channelSegment[ch] = i;
+                    }
+                }
+            }
+
+            float trueDistance = (winding != 0)? minDistance : -minDistance;
+            float distance[3] = { trueDistance, trueDistance, trueDistance };
+
+            for (int ch = 0; ch < 3; ch++)
+            {
+                if (channelSegment[ch] == -1) continue;
+
+                FontMSDFSegment *segment = &segments[channelSegment[ch]];
+                FontMSDFEdge *edge = &edges[segment->edge];
+                Vector2 d = { segment->end.x - segment->start.x, segment->end.y - segment->start.y };
+                Vector2 ap = { p.x - segment->start.x, p.y - segment->start.y };
+                float length = hypotf(d.x, d.y);
+                float cross = d.x*ap.y - d.y*ap.x;
+                float t = (length > 0.0f)? (ap.x*d.x + ap.y*d.y)/(length*length) : 0.0f;
+
+                distance[ch] = (cross < 0.0f)? -channelDistance[ch] : channelDistance[ch];
+
+                // Pseudo-distance: beyond edge endpoints, distance to edge extended line
+                if ((length > 0.0f) && (((channelSegment[ch] == edge->firstSegment) && (t < 0.0f)) ||
+                    ((channelSegment[ch] == (edge->firstSegment + edge->segmentCount - 1)) && (t > 1.0f))))
+                {
+                    float pseudoDistance = cross/length;
+                    if (fabsf(pseudoDistance) <= channelDistance[ch]) distance[ch] = pseudoDistance;
+                }
+
+                distance[ch] *= orientation;
+            }
+
+            // Error correction: channels median must match true distance sign, otherwise
+            // channels would create artifacts, true distance is used on all channels
+            float median = fmaxf(fminf(distance[0], distance[1]), fminf(fmaxf(distance[0], distance[1]), distance[2]));
+
+            if ((median > 0.0f) != (trueDistance > 0.0f))
+            {
+                distance[0] = trueDistance;
+                distance[1] = trueDistance;
+                distance[2] = trueDistance;
+            }
+
+            for (int ch = 0; ch < 3; ch++)
+            {
+                float value = 0.5f + distance[ch]/FONT_MSDF_PIXEL_RANGE;
+
+                if (value < 0.0f) value = 0.0f;
+                else if (value > 1.0f) value = 1.0f;
+
+                data[(y*(*width) + x)*3 + ch] = (unsigned char)(value*255.0f + 0.5f);
+            }
+        }
+    }
+
+    RL_FREE(corners);
+    RL_FREE(contours);
+    RL_FREE(edges);
+    RL_FREE(segments);
+    stbtt_FreeShape(fontInfo, vertices);
+
+    return data;
+}
+#endif
+
+// Compare font atlas rectangles for packing order: taller first, then wider first
+static int CompareFontAtlasRecs(const void *a, const void *b)
+{
+    const FontAtlasRec *recA = (const FontAtlasRec *)a;
+    const FontAtlasRec *recB = (const FontAtlasRec *)b;
+
+    if (recA->height != recB->height) return recB->height - recA->height;
+    if (recA->width != recB->width) return recB->width - recA->width;
+    return recA->index - recB->index;
+}
+
+// Pack font atlas rectangles into skyline, returns false if some rectangle does not fit
+// NOTE: Bottom-left heuristic, every rectangle is placed at the lowest possible position
+static bool PackFontAtlasSkylineRecs(const FontAtlasRec *rects, int rectCount, int width, int height, FontAtlasNode *nodes, int *positions)
+{
+    int nodeCount = 1;
+    nodes[0] = (FontAtlasNode){ 0, 0, width };
+
+    for (int r = 0; r < rectCount; r++)
+    {
+        int bestNode = -1;
+        int bestX = 0;
+        int bestY = 0;
+        int bestBottom = 0;
+
+        for (int i = 0; i < nodeCount; i++)
+        {
+            int x = nodes[i].x;
+            if ((x + rects[r].width) > width) break;
+
+            // Rectangle rests on the highest node it spans
+            int y = 0;
+            for (int j = i, spanned = 0; spanned < rects[r].width; j++)
+            {
+                if (nodes[j].y > y) y = nodes[j].y;
+                spanned += nodes[j].width;
+            }
+
+            if ((y + rects[r].height) > height) continue;
+        #if defined(SUPPORT_FONT_ATLAS_WHITE_REC)
+            // Bottom-right corner is reserved for the white rectangle
+            if (((x + rects[r].width) > (width - 3)) && ((y + rects[r].height) > (height - 3))) continue;
+        #endif
+
+            if ((bestNode == -1) || ((y + rects[r].height) < bestBottom))
+            {
+                bestNode = i;
+                bestX = x;
+                bestY = y;
+                bestBottom = y + rects[r].height;
+            }
+        }
+
+        if (bestNode == -1) return false;
+
+        positions[2*rects[r].index] = bestX;
+        positions[2*rects[r].index + 1] = bestY;
+
+        // Insert new node over the rectangle, nodes covered by it are shrunk or removed
+        int right = bestX + rects[r].width;
+        memmove(&nodes[bestNode + 1], &nodes[bestNode], (nodeCount - bestNode)*sizeof(FontAtlasNode));
+        nodes[bestNode] = (FontAtlasNode){ bestX, bestY + rects[r].height, rects[r].width };
+        nodeCount++;
+
+        int next = bestNode + 1;
+        while ((next < nodeCount) && (nodes[next].x < right))
+        {
+            int overlap = right - nodes[next].x;
+
+            if (nodes[next].width <= overlap)
+            {
+                memmove(&nodes[next], &nodes[next + 1], (nodeCount - next - 1)*sizeof(FontAtlasNode));
+                nodeCount--;
+            }
+            else
+            {
+                nodes[next].x += overlap;
+                nodes[next].width -= overlap;
+                break;
+            }
+        }
+
+        // Merge neighbour nodes at the same height
+        for (int i = 0; i < (nodeCount - 1);)
+        {
+            if (nodes[i].y == nodes[i + 1].y)
+            {
+                nodes[i].width += nodes[i + 1].width;
+                memmove(&nodes[i + 1], &nodes[i + 2], (nodeCount - i - 2)*sizeof(FontAtlasNode));
+                nodeCount--;
+            }
+            else i++;
+        }
+    }
+
+    return true;
+}
+
+// Pack font atlas rectangles with skyline algorithm, identical glyphs share rectangle
+// NOTE: Atlas size is the smallest power-of-two size fitting the glyphs, returns unique glyphs count,
+// -1 is returned if glyphs do not fit in FONT_ATLAS_MAX_SIZE atlas (rectangles and atlas size not modified)
+static int PackFontAtlasSkyline(const GlyphInfo *glyphs, int glyphCount, int padding, Rectangle *recs, int *atlasWidth, int *atlasHeight, float *packedArea)
+{
+    int *duplicateOf = (int *)RL_MALLOC(glyphCount*sizeof(int));
+    FontAtlasRec *rects = (FontAtlasRec *)RL_MALLOC(glyphCount*sizeof(FontAtlasRec));
+    int rectCount = 0;
+
+    // Find identical glyph images with a hash table (FNV-1a hash of image size and pixels)
+    int hashSize = 1;
+    while (hashSize < 2*glyphCount) hashSize *= 2;
+    int *hashTable = (int *)RL_MALLOC(hashSize*sizeof(int));
+    for (int i = 0; i < hashSize; i++) hashTable[i] = -1;
+
+    float area = 0.0f;
+
+    for (int i = 0; i < glyphCount; i++)
+    {
+        const Image *image = &glyphs[i].image;
+        int dataSize = image->width*image->height*((image->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8)? 3 : 1);
+
+        unsigned int hash = 2166136261u;
+        hash = (hash ^ (unsigned int)image->width)*16777619u;
+        hash = (hash ^ (unsigned int)image->height)*16777619u;
+        for (int p = 0; p < dataSize; p++) hash = (hash ^ ((unsigned char *)image->data)[p])*16777619u;
+
+        unsigned int position = hash&(hashSize - 1);
+        duplicateOf[i] = -1;
+
+        while (hashTable[position] != -1)
+        {
+            const Image *other = &glyphs[hashTable[position]].image;
+
+            if ((other->width == image->width) && (other->height == image->height) &&
+                ((dataSize == 0) || (memcmp(other->data, image->data, dataSize) == 0)))
+            {
+                duplicateOf[i] = hashTable[position];
+                break;
+            }
+
+            position = (position + 1)&(hashSize - 1);
+        }
+
+        if (duplicateOf[i] == -1)
+        {
+            hashTable[position] = i;
+            rects[rectCount] = (FontAtlasRec){ i, image->width + 2*padding, image->height + 2*padding };
+            area += (float)rects[rectCount].width*rects[rectCount].height;
+            rectCount++;
+        }
+    }
+
+    RL_FREE(hashTable);
+
+    qsort(rects, rectCount, sizeof(FontAtlasRec), CompareFontAtlasRecs);
+
+    // Try atlas sizes from the smallest fitting glyphs area, doubling height and width alternatively
+    int *positions = (int *)RL_CALLOC(2*glyphCount, sizeof(int));
+    FontAtlasNode *nodes = (FontAtlasNode *)RL_MALLOC((rectCount + 1)*sizeof(FontAtlasNode));
+
+    int width = 64;
+    while ((width*width) < area) width *= 2;
+    int height = ((width*width/2) >= area)? width/2 : width;
+    bool packed = false;
+
+    while (!packed && (width <= FONT_ATLAS_MAX_SIZE))
+    {
+        packed = PackFontAtlasSkylineRecs(rects, rectCount, width, height, nodes, positions);
+
+        if (!packed)
+        {
+            if (height < width) height = width;
+            else
+            {
+                width *= 2;
+                height = width/2;
+            }
+        }
+    }
+
+    if (packed)
+    {
+        for (int i = 0; i < glyphCount; i++)
+        {
+            int index = (duplicateOf[i] == -1)? i : duplicateOf[i];
+
+            recs[i].x = (float)(positions[2*index] + padding);
+            recs[i].y = (float)(positions[2*index + 1] + padding);
+            recs[i].width = (float)glyphs[i].image.width;
+            recs[i].height = (float)glyphs[i].image.height;
+        }
+
+        *atlasWidth = width;
+        *atlasHeight = height;
+        *packedArea = area;
+    }
+    else rectCount = -1;
+
+    RL_FREE(nodes);
+    RL_FREE(positions);
+    RL_FREE(rects);
+    RL_FREE(duplicateOf);
+
+    return rectCount;
+}
+
+// Load dynamic font glyph cache, first atlas page is created
+static rFontCache *LoadFontCache(const unsigned char *fileData, int dataSize, int fontSize, int padding)
+{
+    rFontCache *cache = NULL;
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    if ((fileData == NULL) || (dataSize <= 0) || ((fontSize + 2*padding) > FONT_CACHE_PAGE_SIZE)) return NULL;
+
+    cache = (rFontCache *)RL_CALLOC(1, sizeof(rFontCache));
+
+    // Font data must be available while the font is used
+    cache->fileData = (unsigned char *)RL_MALLOC(dataSize);
+    memcpy(cache->fileData, fileData, dataSize);
+
+    if (stbtt_InitFont(&cache->fontInfo, cache->fileData, stbtt_GetFontOffsetForIndex(cache->fileData, 0)))
+    {
+        int ascent = 0, descent = 0, lineGap = 0;
+        stbtt_GetFontVMetrics(&cache->fontInfo, &ascent, &descent, &lineGap);
+
+        cache->baseSize = fontSize;
+        cache->scale = stbtt_ScaleForPixelHeight(&cache->fontInfo, (float)fontSize);
+        cache->ascent = (int)((float)ascent*cache->scale);
+
+        cache->glyphs = (GlyphInfo *)RL_CALLOC(FONT_CACHE_MAX_GLYPHS, sizeof(GlyphInfo));
+        cache->recs = (Rectangle *)RL_CALLOC(FONT_CACHE_MAX_GLYPHS, sizeof(Rectangle));
+        cache->glyphPages = (int *)RL_MALLOC(FONT_CACHE_MAX_GLYPHS*sizeof(int));
+        cache->freeSlots = (int *)RL_MALLOC(FONT_CACHE_MAX_GLYPHS*sizeof(int));
+        cache->hashKeys = (int *)RL_MALLOC(FONT_CACHE_HASH_SIZE*sizeof(int));
+        cache->hashSlots = (int *)RL_MALLOC(FONT_CACHE_HASH_SIZE*sizeof(int));
+        cache->bitmap = (unsigned char *)RL_MALLOC(FONT_CACHE_PAGE_SIZE*FONT_CACHE_PAGE_SIZE);
+
+        // Free slots are stacked in reverse order, so slots are used in order
+        for (int i = 0; i < FONT_CACHE_MAX_GLYPHS; i++)
+        {
+            cache->glyphPages[i] = -1;
+            cache->freeSlots[i] = FONT_CACHE_MAX_GLYPHS - 1 - i;
+        }
+        cache->freeCount = FONT_CACHE_MAX_GLYPHS;
+
+        for (int i = 0; i < FONT_CACHE_HASH_SIZE; i++) cache->hashKeys[i] = -1;
+
+        // First page is always available, it is used as font texture
+        FontCachePage *page = &cache->pages[0];
+        page->pixels = (unsigned char *)RL_CALLOC(FONT_CACHE_PAGE_SIZE*FONT_CACHE_PAGE_SIZE*2, 1);
+        cache->pageCount = 1;
+
+        if (isGpuReady)
+        {
+            Image image = { page->pixels, FONT_CACHE_PAGE_SIZE, FONT_CACHE_PAGE_SIZE, 1, PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA };
+            page->texture = LoadTextureFromImage(image);
+        }
+    }
+    else
+    {
+        TRACELOG(LOG_WARNING, "FONT: Failed to process TTF font data");
+        RL_FREE(cache->fileData);
+        RL_FREE(cache);
+        cache = NULL;
+    }
+#endif
+
+    return cache;
+}
+
+// Unload dynamic font glyph cache
+static void UnloadFontCache(rFontCache *cache)
+{
+    for (int i = 0; i < cache->pageCount; i++)
+    {
+        if (isGpuReady) UnloadTexture(cache->pages[i].texture);
+        RL_FREE(cache->pages[i].pixels);
+    }
+
+    RL_FREE(cache->glyphs);
+    RL_FREE(cache->recs);
+    RL_FREE(cache->glyphPages);
+    RL_FREE(cache->freeSlots);
+    RL_FREE(cache->hashKeys);
+    RL_FREE(cache->hashSlots);
+    RL_FREE(cache->bitmap);
+    RL_FREE(cache->fileData);
+    RL_FREE(cache);
+}
+
+// Get codepoint hash table position in dynamic font cache
+// NOTE: Returned position contains the codepoint or it is the empty entry to insert it
+static int GetFontCacheHashPosition(const rFontCache *cache, int codepoint)
+{
+    unsigned int position = ((unsigned int)codepoint*2654435761u)&(FONT_CACHE_HASH_SIZE - 1);
+
+    // Table is never full, probing always ends on the codepoint or an empty entry
+    while ((cache->hashKeys[position] != -1) && (cache->hashKeys[position] != codepoint)) position = (position + 1)&(FONT_CACHE_HASH_SIZE - 1);
+
+    return (int)position;
+}
+
+// Rebuild dynamic font cache hash table from cached glyphs, fallback codepoints entries are removed
+// NOTE: Cached glyphs fill at most half of the table, fallback codepoints are looked up again
+static void RebuildFontCacheHash(rFontCache *cache)
+{
+    for (int i = 0; i < FONT_CACHE_HASH_SIZE; i++) cache->hashKeys[i] = -1;
+    cache->hashCount = 0;
+
+    for (int i = 0; i < FONT_CACHE_MAX_GLYPHS; i++)
+    {
+        if (cache->glyphPages[i] != -1)
+        {
+            int position = GetFontCacheHashPosition(cache, cache->glyphs[i].value);
+
+            cache->hashKeys[position] = cache->glyphs[i].value;
+            cache->hashSlots[position] = i;
+            cache->hashCount++;
+        }
+    }
+}
+
+// Add codepoint glyph slot to dynamic font cache hash table
+static void AddFontCacheHash(rFontCache *cache, int codepoint, int slot)
+{
+    // Table load is kept under 3/4, if fallback codepoints fill it, table is rebuilt without them
+    if (cache->hashCount >= (FONT_CACHE_HASH_SIZE/4*3)) RebuildFontCacheHash(cache);
+
+    int position = GetFontCacheHashPosition(cache, codepoint);
+
+    if (cache->hashKeys[position] == -1) cache->hashCount++;
+    cache->hashKeys[position] = codepoint;
+    cache->hashSlots[position] = slot;
+}
+
+// Evict least recently used page from dynamic font cache, all its glyphs are removed
+// NOTE: Pending draw calls could use the page texture, render batch is drawn first
+static int EvictFontCachePage(rFontCache *cache, bool requireGlyphs)
+{
+    int pageIndex = -1;
+
+    for (int i = 0; i < cache->pageCount; i++)
+    {
+        if (requireGlyphs && (cache->pages[i].glyphCount == 0)) continue;
+        if ((pageIndex == -1) || (cache->pages[i].lastUsed < cache->pages[pageIndex].lastUsed)) pageIndex = i;
+    }
+
+    if (pageIndex == -1) return -1;
+
+    if (isGpuReady) rlDrawRenderBatchActive();
+
+    cache->evictCount++;
+
+    for (int i = 0; i < FONT_CACHE_MAX_GLYPHS; i++)
+    {
+        if (cache->glyphPages[i] == pageIndex)
+        {
+            cache->glyphPages[i] = -1;
+            cache->freeSlots[cache->freeCount] = i;
+            cache->freeCount++;
+        }
+    }
+
+    FontCachePage *page = &cache->pages[pageIndex];
+    page->glyphCount = 0;
+    page->shelfX = 0;
+    page->shelfY = 0;
+    page->shelfHeight = 0;
+
+    // Hash table is rebuilt from cached glyphs, fallback codepoints are looked up again
+    RebuildFontCacheHash(cache);
+
+    return pageIndex;
+}
+
+// Allocate rectangle in dynamic font cache page shelf, returns false if page is full
+static bool AllocFontCachePageRec(FontCachePage *page, int width, int height, int *x, int *y)
+{
+    // Start a new shelf if glyph does not fit in current one
+    if ((page->shelfX + width) > FONT_CACHE_PAGE_SIZE)
+    {
+        if ((page->shelfY + page->shelfHeight + height) > FONT_CACHE_PAGE_SIZE) return false;
+
+        page->shelfY += page->shelfHeight;
+        page->shelfX = 0;
+        page->shelfHeight = 0;
+    }
+
+    if ((page->shelfY + height) > FONT_CACHE_PAGE_SIZE) return false;
+
+    *x = page->shelfX;
+    *y = page->shelfY;
+
+    page->shelfX += width;
+    if (height > page->shelfHeight) page->shelfHeight = height;
+
+    return true;
+}
+
+// Allocate rectangle in dynamic font cache, a page is added or evicted if required
+static int AllocFontCacheRec(rFontCache *cache, int width, int height, int *x, int *y)
+{
+    for (int i = 0; i < cache->pageCount; i++)
+    {
+        if (AllocFontCachePageRec(&cache->pages[i], width, height, x, y)) return i;
+    }
+
+    int pageIndex = -1;
+
+    if (cache->pageCount < FONT_CACHE_MAX_PAGES)
+    {
+        pageIndex = cache->pageCount;
+
+        FontCachePage *page = &cache->pages[pageIndex];
+        page->pixels = (unsigned char *)RL_CALLOC(FONT_CACHE_PAGE_SIZE*FONT_CACHE_PAGE_SIZE*2, 1);
+
+        if (isGpuReady)
+        {
+            Image image = { page->pixels, FONT_CACHE_PAGE_SIZE, FONT_CACHE_PAGE_SIZE, 1, PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA };
+            page->texture = LoadTextureFromImage(image);
+        }
+
+        cache->pageCount++;
+
+        TRACELOGD("FONT: Dynamic font cache page added (%i pages)", cache->pageCount);
+    }
+    else pageIndex = EvictFontCachePage(cache, false);
+
+    // Glyph size is limited to page size, so it always fits in an empty page
+    AllocFontCachePageRec(&cache->pages[pageIndex], width, height, x, y);
+
+    return pageIndex;
+}
+
+// Rasterize codepoint glyph into dynamic font cache, returns glyph slot
+// NOTE: Codepoints not available in the font use the '?' glyph slot
+static int LoadFontCacheGlyph(rFontCache *cache, int codepoint, int padding)
+{
+    int slot = 0;
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    int glyphIndex = stbtt_FindGlyphIndex(&cache->fontInfo, codepoint);
+
+    if ((glyphIndex == 0) && (codepoint != '?'))
+    {
+        slot = GetFontCacheGlyph(cache, '?', padding);
+        AddFontCacheHash(cache, codepoint, slot);
+        return slot;
+    }
+
+    // A free slot is required, pages are evicted until one is available
+    if (cache->freeCount == 0) EvictFontCachePage(cache, true);
+
+    int advanceX = 0;
+    stbtt_GetGlyphHMetrics(&cache->fontInfo, glyphIndex, &advanceX, NULL);
+    advanceX = (int)((float)advanceX*cache->scale);
+
+    int x0 = 0, y0 = 0, x1 = 0, y1 = 0;
+    stbtt_GetGlyphBitmapBox(&cache->fontInfo, glyphIndex, cache->scale, cache->scale, &x0, &y0, &x1, &y1);
+
+    int width = x1 - x0;
+    int height = y1 - y0;
+    bool empty = ((width <= 0) || (height <= 0));
+
+    // NOTE: Space character uses an empty glyph, same as static fonts
+    if (codepoint == 32)
+    {
+        x0 = 0;
+        y0 = -cache->ascent;
+        width = advanceX;
+        height = cache->baseSize;
+        empty = true;
+    }
+
+    if (width > (FONT_CACHE_PAGE_SIZE - 2*padding)) width = FONT_CACHE_PAGE_SIZE - 2*padding;
+    if (height > (FONT_CACHE_PAGE_SIZE - 2*padding)) height = FONT_CACHE_PAGE_SIZE - 2*padding;
+
+    int recX = 0, recY = 0;
+    int pageIndex = AllocFontCacheRec(cache, width + 2*padding, height + 2*padding, &recX, &recY);
+    FontCachePage *page = &cache->pages[pageIndex];
+
+    // Page eviction could free a slot as well, so slot is taken after rectangle allocation
+    cache->freeCount--;
+    slot = cache->freeSlots[cache->freeCount];
+
+    if (!empty) stbtt_MakeGlyphBitmap(&cache->fontInfo, cache->bitmap, width, height, width, cache->scale, cache->scale, glyphIndex);
+
+    // Copy glyph into page, including padding cleared from previous evicted glyphs
+    for (int y = 0; y < (height + 2*padding); y++)
+    {
+        unsigned char *row = page->pixels + ((recY + y)*FONT_CACHE_PAGE_SIZE + recX)*2;
+
+        for (int x = 0; x < (width + 2*padding); x++)
+        {
+            bool inside = (!empty && (x >= padding) && (x < (width + padding)) && (y >= padding) && (y < (height + padding)));
+
+            row[x*2] = 255;
+            row[x*2 + 1] = inside? cache->bitmap[(y - padding)*width + (x - padding)] : 0;
+        }
+    }
+
+    if (page->dirtyBottom == 0) page->dirtyTop = recY;
+    else if (recY < page->dirtyTop) page->dirtyTop = recY;
+    if ((recY + height + 2*padding) > page->dirtyBottom) page->dirtyBottom = recY + height + 2*padding;
+
+    cache->glyphs[slot] = (GlyphInfo){ 0 };
+    cache->glyphs[slot].value = codepoint;
+    cache->glyphs[slot].offsetX = x0;
+    cache->glyphs[slot].offsetY = y0 + cache->ascent;
+    cache->glyphs[slot].advanceX = advanceX;
+
+    cache->recs[slot] = (Rectangle){ (float)(recX + padding), (float)(recY + padding), (float)width, (float)height };
+    cache->glyphPages[slot] = pageIndex;
+    page->glyphCount++;
+
+    AddFontCacheHash(cache, codepoint, slot);
+#endif
+
+    return slot;
+}
+
+// Get glyph slot from dynamic font cache, glyph is rasterized on first use
+static int GetFontCacheGlyph(rFontCache *cache, int codepoint, int padding)
+{
+    int position = GetFontCacheHashPosition(cache, codepoint);
+    int slot = (cache->hashKeys[position] == codepoint)? cache->hashSlots[position] : LoadFontCacheGlyph(cache, codepoint, padding);
+
+    cache->useCounter++;
+    cache->pages[cache->glyphPages[slot]].lastUsed = cache->useCounter;
+
+    return slot;
+}
+
+// Set text layout glyph quad texture coordinates, considering glyphPadding
+static void SetTextLayoutTexcoords(TextLayout layout, int quad)
+{
+    Font font = layout.font;
+    int index = layout.glyphs[quad];
+
+    float width = (font.cache != NULL)? FONT_CACHE_PAGE_SIZE : (float)font.texture.width;
+    float height = (font.cache != NULL)? FONT_CACHE_PAGE_SIZE : (float)font.texture.height;
+    if ((width <= 0.0f) || (height <= 0.0f)) width = height = 1.0f;
+
+    Rectangle srcRec = { font.recs[index].x - (float)font.glyphPadding, font.recs[index].y - (float)font.glyphPadding,
+                         font.recs[index].width + 2.0f*font.glyphPadding, font.recs[index].height + 2.0f*font.glyphPadding };
+
+    // Quad vertex order: top-left, bottom-left, bottom-right, top-right
+    float *texcoords = layout.texcoords + quad*8;
+    texcoords[0] = srcRec.x/width; texcoords[1] = srcRec.y/height;
+    texcoords[2] = srcRec.x/width; texcoords[3] = (srcRec.y + srcRec.height)/height;
+    texcoords[4] = (srcRec.x + srcRec.width)/width; texcoords[5] = (srcRec.y + srcRec.height)/height;
+    texcoords[6] = (srcRec.x + srcRec.width)/width; texcoords[7] = srcRec.y/height;
+}
+
+// Init text glyphs quads staging buffer
+// NOTE: Quads arrays are not cleared, only staged quads are read
+static void InitTextGlyphQuads(TextGlyphQuads *quads, Font font, float fontSize, Color tint)
+{
+    quads->font = font;
+    quads->scaleFactor = fontSize/font.baseSize;
+    quads->tint = tint;
+    quads->texture = font.texture;
+    quads->quadCount = 0;
+}
+
+// Add glyph quad to staging buffer, staged quads are drawn if buffer is full or glyph texture changes
+// NOTE: Glyph quad matches DrawTextCodepoint(), glyphPadding is considered on drawing
+static void AddTextGlyphQuad(TextGlyphQuads *quads, int index, float x, float y)
+{
+    const Font *font = &quads->font;
+    Texture2D texture = (font->cache != NULL)? font->cache->pages[font->cache->glyphPages[index]].texture : font->texture;
+
+    if ((quads->quadCount == MAX_TEXT_GLYPH_QUADS) || ((quads->quadCount > 0) && (texture.id != quads->texture.id))) DrawTextGlyphQuads(quads);
+    quads->texture = texture;
+
+    float padding = (float)font->glyphPadding;
+    float width = (texture.width > 0)? (float)texture.width : 1.0f;
+    float height = (texture.height > 0)? (float)texture.height : 1.0f;
+
+    // Character destination rectangle on screen and source rectangle from font texture atlas
+    Rectangle dstRec = { x + (font->glyphs[index].offsetX - padding)*quads->scaleFactor, y + (font->glyphs[index].offsetY - padding)*quads->scaleFactor,
+                         (font->recs[index].width + 2.0f*padding)*quads->scaleFactor, (font->recs[index].height + 2.0f*padding)*quads->scaleFactor };
+    Rectangle srcRec = { (font->recs[index].x - padding)/width, (font->recs[index].y - padding)/height,
+                         (font->recs[index].width + 2.0f*padding)/width, (font->recs[index].height + 2.0f*padding)/height };
+
+    // Quad vertex order: top-left, bottom-left, bottom-right, top-right
+    float *vertices = quads->vertices + quads->quadCount*8;
+    vertices[0] = dstRec.x; vertices[1] = dstRec.y;
+    vertices[2] = dstRec.x; vertices[3] = dstRec.y + dstRec.height;
+    vertices[4] = dstRec.x + dstRec.width; vertices[5] = dstRec.y + dstRec.height;
+    vertices[6] = dstRec.x + dstRec.width; vertices[7] = dstRec.y;
+
+    float *texcoords = quads->texcoords + quads->quadCount*8;
+    texcoords[0] = srcRec.x; texcoords[1] = srcRec.y;
+    texcoords[2] = srcRec.x; texcoords[3] = srcRec.y + srcRec.height;
+    texcoords[4] = srcRec.x + srcRec.width; texcoords[5] = srcRec.y + srcRec.height;
+    texcoords[6] = srcRec.x + srcRec.width; texcoords[7] = srcRec.y;
+
+    quads->quadCount++;
+}
+
+// Draw staged glyphs quads, copied in bulk to the render batch
+// NOTE: Consecutive draws with the same texture are merged by the render batch in a single draw call
+static void DrawTextGlyphQuads(TextGlyphQuads *quads)
+{
+    // Glyphs could be just rasterized, upload them before drawing from their cache page
+    if (quads->font.cache != NULL) UpdateFontCacheTextures(quads->font.cache);
+
+    if ((quads->quadCount > 0) && (quads->texture.id > 0))
+    {
+        rlSetTexture(quads->texture.id);
+        rlBegin(RL_QUADS);
+
+            rlColor4ub(quads->tint.r, quads->tint.g, quads->tint.b, quads->tint.a);
+            rlNormal3f(0.0f, 0.0f, 1.0f);                          // Normal vector pointing towards viewer
+            rlVertexQuads2f(quads->vertices, quads->texcoords, quads->quadCount, 0.0f, 0.0f);
+
+        rlEnd();
+        rlSetTexture(0);
+    }
+
+    quads->quadCount = 0;
+}
+
+// Update dynamic font cache pages textures with modified rows
+// NOTE: Modified rows of each page are uploaded in a single texture update
+static void UpdateFontCacheTextures(rFontCache *cache)
+{
+    for (int i = 0; i < cache->pageCount; i++)
+    {
+        FontCachePage *page = &cache->pages[i];
+
+        if (page->dirtyBottom > 0)
+        {
+            if (isGpuReady)
+            {
+                Rectangle rec = { 0, (float)page->dirtyTop, FONT_CACHE_PAGE_SIZE, (float)(page->dirtyBottom - page->dirtyTop) };
+                UpdateTextureRec(page->texture, rec, page->pixels + page->dirtyTop*FONT_CACHE_PAGE_SIZE*2);
+            }
+
+            page->dirtyTop = 0;
+            page->dirtyBottom = 0;
+        }
+    }
+}
+
+// Load font shaping data from kerning pairs and font codepoints (ligatures available)
+// NOTE: Returns NULL if font has no kerning pairs and no ligatures
+static rFontShaping *LoadFontShaping(const FontKerningPair *pairs, int pairCount, const int *codepoints, int codepointCount)
+{
+    int ligatures = 0;
+
+    for (int l = 0; l < FONT_LIGATURES_COUNT; l++)
+    {
+        for (int i = 0; i < codepointCount; i++)
+        {
+            if (codepoints[i] == fontLigatures[l][0]) { ligatures |= (1 << l); break; }
+        }
+    }
+
+    if ((pairCount == 0) && (ligatures == 0)) return NULL;
+
+    rFontShaping *shaping = (rFontShaping *)RL_CALLOC(1, sizeof(rFontShaping));
+    shaping->ligatures = ligatures;
+
+    // Hash table load is kept under 1/2, probing always ends on an empty entry
+    shaping->hashSize = 1;
+    while (shaping->hashSize < 2*pairCount) shaping->hashSize *= 2;
+    if (shaping->hashSize < 2) shaping->hashSize = 2;
+
+    shaping->pairs = (FontKerningPair *)RL_CALLOC(shaping->hashSize, sizeof(FontKerningPair));
+
+    for (int i = 0; i < pairCount; i++)
+    {
+        if (pairs[i].first == 0) continue;
+
+        unsigned int position = ((unsigned int)pairs[i].first*2654435761u ^ (unsigned int)pairs[i].second*40503u)&(shaping->hashSize - 1);
+
+        while ((shaping->pairs[position].first != 0) &&
+               ((shaping->pairs[position].first != pairs[i].first) || (shaping->pairs[position].second != pairs[i].second))) position = (position + 1)&(shaping->hashSize - 1);
+
+        // NOTE: First pair defined is kept on duplicates
+        if (shaping->pairs[position].first == 0)
+        {
+            shaping->pairs[position] = pairs[i];
+            shaping->pairCount++;
+        }
+    }
+
+    return shaping;
+}
+
+// Unload font shaping data
+static void UnloadFontShaping(rFontShaping *shaping)
+{
+    if (shaping == NULL) return;
+
+    RL_FREE(shaping->pairs);
+    RL_FREE(shaping);
+}
+
+// Get kerning advance between two codepoints, scaled to font base size
+static float GetFontShapingKerning(const rFontShaping *shaping, int codepoint, int nextCodepoint)
+{
+    unsigned int position = ((unsigned int)codepoint*2654435761u ^ (unsigned int)nextCodepoint*40503u)&(shaping->hashSize - 1);
+
+    while (shaping->pairs[position].first != 0)
+    {
+        if ((shaping->pairs[position].first == codepoint) && (shaping->pairs[position].second == nextCodepoint)) return shaping->pairs[position].advance;
+
+        position = (position + 1)&(shaping->hashSize - 1);
+    }
+
+    return 0.0f;
+}
+
+// Get ligature replacing a codepoints sequence, codepoints count replaced is returned in length
+// NOTE: If no ligature is available, codepoint is returned with length 1
+static int GetFontShapingLigature(const rFontShaping *shaping, int codepoint, int next, int nextNext, int *length)
+{
+    *length = 1;
+
+    // Supported ligatures only start with 'f' or 's'
+    if ((codepoint != 'f') && (codepoint != 's')) return codepoint;
+
+    for (int l = 0; l < FONT_LIGATURES_COUNT; l++)
+    {
+        if ((shaping->ligatures & (1 << l)) && (fontLigatures[l][1] == codepoint) && (fontLigatures[l][2] == next) &&
+            ((fontLigatures[l][3] == 0) || (fontLigatures[l][3] == nextNext)))
+        {
+            *length = (fontLigatures[l][3] == 0)? 2 : 3;
+            return fontLigatures[l][0];
+        }
+    }
+
+    return codepoint;
+}
+
+// Get next text codepoint and bytes processed, ligatures are substituted if enabled
+static int GetTextCodepointNext(Font font, const char *text, int *codepointByteCount)
+{
+    int codepoint = GetCodepointNext(text, codepointByteCount);
+
+    if (textLigatures && (font.shaping != NULL) && (font.shaping->ligatures != 0))
+    {
+        // NOTE: Ligatures sequences are ASCII, one byte per codepoint
+        int length = 1;
+        codepoint = GetFontShapingLigature(font.shaping, codepoint, text[1], (text[1] != '\0')? text[2] : 0, &length);
+        if (length > 1) *codepointByteCount = length;
+    }
+
+    return codepoint;
+}
+
+// Measure text line width, text length in bytes
+// NOTE: Line must not contain linebreaks, width matches MeasureTextEx() for a single line text
+static float MeasureTextLine(Font font, const char *text, int length, float fontSize, float spacing)
+{
+    float textWidth = 0.0f;
+    int previousCodepoint = 0;
+    int codepointCount = 0;
+
+    for (int i = 0; i < length; codepointCount++)
+    {
+        int codepointByteCount = 0;
+        int codepoint = GetTextCodepointNext(font, &text[i], &codepointByteCount);
+        int index = GetGlyphIndex(font, codepoint);
+
+        if ((font.shaping != NULL) && (previousCodepoint != 0)) textWidth += GetFontShapingKerning(font.shaping, previousCodepoint, codepoint);
+
+        if (font.glyphs[index].advanceX != 0) textWidth += font.glyphs[index].advanceX;
+        else textWidth += (font.recs[index].width + font.glyphs[index].offsetX);
+
+        previousCodepoint = codepoint;
+        i += codepointByteCount;
+    }
+
+    if (codepointCount == 0) return 0.0f;
+
+    return textWidth*fontSize/(float)font.baseSize + (float)(codepointCount - 1)*spacing;
+}
+
+// Find first text occurrence within a text of known length, -1 if not found
+// NOTE: Candidate positions are checked comparing find first and last characters 16 positions at a time
+static int FindTextIndex(const char *text, int textLength, const char *find, int findLength)
+{
+    if ((text == NULL) || (find == NULL) || (findLength > textLength)) return -1;
+    if (findLength == 0) return 0;
+
+    int last = textLength - findLength;     // Last possible occurrence position
+    int i = 0;
+
+#if defined(RTEXT_SCAN_SSE2) || defined(RTEXT_SCAN_NEON)
+    #if defined(RTEXT_SCAN_SSE2)
+    const __m128i first = _mm_set1_epi8(find[0]);
+    const __m128i end = _mm_set1_epi8(find[findLength - 1]);
+    #else
+    const uint8x16_t first = vdupq_n_u8((uint8_t)find[0]);
+    const uint8x16_t end = vdupq_n_u8((uint8_t)find[findLength - 1]);
+    #endif
+
+    for (; (i + 15) <= last; i += 16)
+    {
+    #if defined(RTEXT_SCAN_SSE2)
+        __m128i equal = _mm_and_si128(_mm_cmpeq_epi8(first, _mm_loadu_si128((const __m128i *)(text + i))),
+                                      _mm_cmpeq_epi8(end, _mm_loadu_si128((const __m128i *)(text + i + findLength - 1))));
+        unsigned int mask = (unsigned int)_mm_movemask_epi8(equal);
+    #else
+        uint8x16_t equal = vandq_u8(vceqq_u8(first, vld1q_u8((const uint8_t *)(text + i))),
+                                    vceqq_u8(end, vld1q_u8((const uint8_t *)(text + i + findLength - 1))));
+        unsigned int mask = GetTextScanMask(equal);
+    #endif
+
+        // Check full find text on candidate positions
+        for (int k = 0; mask != 0; k++, mask >>= 1)
+        {
+            if ((mask & 1) && (memcmp(text + i + k, find, findLength) == 0)) return i + k;
+        }
+    }
+#endif
+
+    for (; i <= last; i++)
+    {
+        if ((text[i] == find[0]) && (memcmp(text + i, find, findLength) == 0)) return i;
+    }
+
+    return -1;
+}
+
+#if defined(RTEXT_SCAN_NEON)
+// Get bytes comparison mask from NEON vector, one bit per byte (like SSE2 _mm_movemask_epi8())
+static unsigned int GetTextScanMask(uint8x16_t compare)
+{
+    static const uint8_t bits[16] = { 1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128 };
+    uint8x16_t masked = vandq_u8(compare, vld1q_u8(bits));
+
+    return (unsigned int)vaddv_u8(vget_low_u8(masked)) | ((unsigned int)vaddv_u8(vget_high_u8(masked)) << 8);
+}
+#endif
+
+#if defined(RTEXT_SCAN_SSE2) || defined(RTEXT_SCAN_NEON)
+// Get first set bit position in a bytes mask, mask can not be 0
+static int GetTextScanMaskFirst(unsigned int mask)
+{
+    int position = 0;
+
+#if defined(__GNUC__)
+    position = __builtin_ctz(mask);
+#else
+    while (!(mask & 1)) { mask >>= 1; position++; }
+#endif
+
+    return position;
+}
+#endif
+
+// Decode UTF-8 text into codepoints (UTF-32), returns codepoints count
+// NOTE: Codepoints array must fit length codepoints (or be NULL to just count them)
+// Text is classified 16 bytes at a time with bytes masks: ASCII blocks are widened, blocks of 2 and 3 bytes
+// sequences are validated and decoded from masks, invalid sequences are decoded as '?'(0x3f) like GetCodepointNext()
+static int DecodeTextUTF8(const char *text, int length, int *codepoints)
+{
+#if defined(RTEXT_SCAN_SSE2) || defined(RTEXT_SCAN_NEON)
+    const unsigned char *ptr = (const unsigned char *)text;     // Text bytes, unsigned for blocks decoding
+#endif
+    int count = 0;
+    int i = 0;
+
+    while (i < length)
+    {
+#if defined(RTEXT_SCAN_SSE2) || defined(RTEXT_SCAN_NEON)
+        if ((i + 16) <= length)
+        {
+            // Get non-ASCII, 2 bytes lead, 3 bytes lead and continuation bytes masks
+    #if defined(RTEXT_SCAN_SSE2)
+            __m128i bytes = _mm_loadu_si128((const __m128i *)(ptr + i));
+            unsigned int nonAscii = (unsigned int)_mm_movemask_epi8(bytes);
+    #else
+            uint8x16_t bytes = vld1q_u8(ptr + i);
+            unsigned int nonAscii = GetTextScanMask(vcgeq_u8(bytes, vdupq_n_u8(0x80)));
+    #endif
+            if (nonAscii == 0)
+            {
+                // ASCII block, bytes widened to codepoints
+                // NOTE: Every codepoint takes at least one byte, so codepoints array can fit all 16 values
+                if (codepoints != NULL)
+                {
+    #if defined(RTEXT_SCAN_SSE2)
+                    const __m128i zero = _mm_setzero_si128();
+                    __m128i low = _mm_unpacklo_epi8(bytes, zero);
+                    __m128i high = _mm_unpackhi_epi8(bytes, zero);
+
+                    _mm_storeu_si128((__m128i *)(codepoints + count), _mm_unpacklo_epi16(low, zero));
+                    _mm_storeu_si128((__m128i *)(codepoints + count + 4), _mm_unpackhi_epi16(low, zero));
+                    _mm_storeu_si128((__m128i *)(codepoints + count + 8), _mm_unpacklo_epi16(high, zero));
+                    _mm_storeu_si128((__m128i *)(codepoints + count + 12), _mm_unpackhi_epi16(high, zero));
+    #else
+                    uint16x8_t low = vmovl_u8(vget_low_u8(bytes));
+                    uint16x8_t high = vmovl_u8(vget_high_u8(bytes));
+
+                    vst1q_u32((uint32_t *)(codepoints + count), vmovl_u16(vget_low_u16(low)));
+                    vst1q_u32((uint32_t *)(codepoints + count + 4), vmovl_u16(vget_high_u16(low)));
+                    vst1q_u32((uint32_t *)(codepoints + count + 8), vmovl_u16(vget_low_u16(high)));
+                    vst1q_u32((uint32_t *)(codepoints + count + 12), vmovl_u16(vget_high_u16(high)));
+    #endif
+                }
+
+                i += 16;
+                count += 16;
+                continue;
+            }
+
+    #if defined(RTEXT_SCAN_SSE2)
+            unsigned int lead2 = (unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(bytes, _mm_set1_epi8((char)0xe0)), _mm_set1_epi8((char)0xc0)));
+            unsigned int lead3 = (unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(bytes, _mm_set1_epi8((char)0xf0)), _mm_set1_epi8((char)0xe0)));
+            unsigned int continuation = (unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(bytes, _mm_set1_epi8((char)0xc0)), _mm_set1_epi8((char)0x80)));
+    #else
+            unsigned int lead2 = GetTextScanMask(vceqq_u8(vandq_u8(bytes, vdupq_n_u8(0xe0)), vdupq_n_u8(0xc0)));
+            unsigned int lead3 = GetTextScanMask(vceqq_u8(vandq_u8(bytes, vdupq_n_u8(0xf0)), vdupq_n_u8(0xe0)));
+            unsigned int continuation = GetTextScanMask(vceqq_u8(vandq_u8(bytes, vdupq_n_u8(0xc0)), vdupq_n_u8(0x80)));
+    #endif
+            if (((lead3 & 0x7fff) == 0x1249) && ((continuation & 0x7fff) == 0x6db6))
+            {
+                // Five 3 bytes sequences (CJK), overlong (0xe0 lead, second byte < 0xa0)
+                // and surrogates (0xed lead, second byte >= 0xa0) are invalid
+    #if defined(RTEXT_SCAN_SSE2)
+                unsigned int overlong = (unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, _mm_set1_epi8((char)0xe0)));
+                unsigned int surrogate = (unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, _mm_set1_epi8((char)0xed)));
+                unsigned int high = (unsigned int)_mm_movemask_epi8(_mm_slli_epi16(bytes, 2));
+    #else
+                unsigned int overlong = GetTextScanMask(vceqq_u8(bytes, vdupq_n_u8(0xe0)));
+                unsigned int surrogate = GetTextScanMask(vceqq_u8(bytes, vdupq_n_u8(0xed)));
+                unsigned int high = GetTextScanMask(vtstq_u8(bytes, vdupq_n_u8(0x20)));
+    #endif
+                overlong &= 0x1249;
+                surrogate &= 0x1249;
+
+                if ((((overlong << 1) & ~high) | ((surrogate << 1) & high)) == 0)
+                {
+                    if (codepoints != NULL)
+                    {
+                        for (int k = 0; k < 5; k++)
+                        {
+                            const unsigned char *sequence = ptr + i + k*3;
+                            codepoints[count + k] = ((0x0f & sequence[0]) << 12) | ((0x3f & sequence[1]) << 6) | (0x3f & sequence[2]);
+                        }
+                    }
+
+                    i += 15;
+                    count += 5;
+                    continue;
+                }
+            }
+            else if ((lead2 == 0x5555) && (continuation == 0xaaaa))
+            {
+                // Eight 2 bytes sequences (Latin, Greek, Cyrillic...), overlong (0xc0 and 0xc1 leads) are invalid
+    #if defined(RTEXT_SCAN_SSE2)
+                unsigned int overlong = (unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(bytes, _mm_set1_epi8((char)0xfe)), _mm_set1_epi8((char)0xc0)));
+    #else
+                unsigned int overlong = GetTextScanMask(vceqq_u8(vandq_u8(bytes, vdupq_n_u8(0xfe)), vdupq_n_u8(0xc0)));
+    #endif
+                if (overlong == 0)
+                {
+                    if (codepoints != NULL)
+                    {
+                        for (int k = 0; k < 8; k++)
+                        {
+                            const unsigned char *sequence = ptr + i + k*2;
+                            codepoints[count + k] = ((0x1f & sequence[0]) << 6) | (0x3f & sequence[1]);
+                        }
+                    }
+
+                    i += 16;
+                    count += 8;
+                    continue;
+                }
+            }
+
+            // Mixed block of ASCII, 2 bytes and 3 bytes sequences, all sequences ending inside the block
+            if ((((lead2 << 1) | (lead3 << 1) | (lead3 << 2)) == continuation) && ((lead2 | lead3 | continuation) == nonAscii))
+            {
+                // Overlong 2 bytes sequences (0xc0 and 0xc1 leads), overlong 3 bytes sequences
+                // (0xe0 lead, second byte < 0xa0) and surrogates (0xed lead, second byte >= 0xa0) are invalid
+    #if defined(RTEXT_SCAN_SSE2)
+                unsigned int overlong2 = (unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(bytes, _mm_set1_epi8((char)0xfe)), _mm_set1_epi8((char)0xc0)));
+                unsigned int overlong3 = (unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, _mm_set1_epi8((char)0xe0)));
+                unsigned int surrogate = (unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, _mm_set1_epi8((char)0xed)));
+                unsigned int high = (unsigned int)_mm_movemask_epi8(_mm_slli_epi16(bytes, 2));
+    #else
+                unsigned int overlong2 = GetTextScanMask(vceqq_u8(vandq_u8(bytes, vdupq_n_u8(0xfe)), vdupq_n_u8(0xc0)));
+                unsigned int overlong3 = GetTextScanMask(vceqq_u8(bytes, vdupq_n_u8(0xe0)));
+                unsigned int surrogate = GetTextScanMask(vceqq_u8(bytes, vdupq_n_u8(0xed)));
+                unsigned int high = GetTextScanMask(vtstq_u8(bytes, vdupq_n_u8(0x20)));
+    #endif
+                overlong3 &= lead3;
+                surrogate &= lead3;
 
-    if (ptr != NULL) text = (char *)ptr;
+                if (((overlong2 & lead2) | ((overlong3 << 1) & ~high) | ((surrogate << 1) & high)) == 0)
+                {
+                    // Copy ASCII runs between sequences, decoding every sequence lead
+                    int *output = (codepoints != NULL)? codepoints + count : NULL;
+                    int start = 0;
 
-    return text;
-}
+                    for (unsigned int leads = (lead2 | lead3); leads != 0; leads &= (leads - 1))
+                    {
+                        int lead = GetTextScanMaskFirst(leads);
+                        const unsigned char *sequence = ptr + i + lead;
+                        int sequenceSize = ((lead3 >> lead) & 1)? 3 : 2;
 
-// Unload UTF-8 text encoded from codepoints array
-void UnloadUTF8(char *text)
-{
-    RL_FREE(text);
-}
+                        if (output != NULL)
+                        {
+                            for (int k = start; k < lead; k++) *output++ = ptr[i + k];
 
-// Load all codepoints from a UTF-8 text string, codepoints count returned by parameter
-int *LoadCodepoints(const char *text, int *count)
-{
-    int textLength = TextLength(text);
+                            if (sequenceSize == 3) *output++ = ((0x0f & sequence[0]) << 12) | ((0x3f & sequence[1]) << 6) | (0x3f & sequence[2]);
+                            else *output++ = ((0x1f & sequence[0]) << 6) | (0x3f & sequence[1]);
+                        }
 
-    int codepointSize = 0;
-    int codepointCount = 0;
+                        count += (lead - start) + 1;
+                        start = lead + sequenceSize;
+                    }
 
-    // Allocate a big enough buffer to store as many codepoints as text bytes
-    int *codepoints = (int *)RL_CALLOC(textLength, sizeof(int));
+                    if (output != NULL) for (int k = start; k < 16; k++) *output++ = ptr[i + k];
 
-    for (int i = 0; i < textLength; codepointCount++)
-    {
-        codepoints[codepointCount] = GetCodepointNext(text + i, &codepointSize);
-        i += codepointSize;
-    }
+                    count += 16 - start;
+                    i += 16;
+                    continue;
+                }
+            }
 
-    // Re-allocate buffer to the actual number of codepoints loaded
-    codepoints = (int *)RL_REALLOC(codepoints, codepointCount*sizeof(int));
+            // Invalid or 4 bytes sequences block, ASCII bytes before first non-ASCII byte
+            // are decoded directly and remaining bytes one codepoint at a time, up to next block
+            int blockEnd = i + 16;
 
-    *count = codepointCount;
+            for (; !(nonAscii & 1); nonAscii >>= 1, i++, count++)
+            {
+                if (codepoints != NULL) codepoints[count] = ptr[i];
+            }
 
-    return codepoints;
-}
+            while (i < blockEnd)
+            {
+                int codepointSize = 0;
+                int codepoint = GetCodepointNext(text + i, &codepointSize);
 
-// Unload codepoints data from memory
-void UnloadCodepoints(int *codepoints)
-{
-    RL_FREE(codepoints);
-}
+                if (codepoints != NULL) codepoints[count] = codepoint;
 
-// Get total number of characters(codepoints) in a UTF-8 encoded text, until '\0' is found
-// NOTE: If an invalid UTF-8 sequence is encountered a '?'(0x3f) codepoint is counted instead
-int GetCodepointCount(const char *text)
-{
-    unsigned int length = 0;
-    char *ptr = (char *)&text[0];
+                i += codepointSize;
+                count++;
+            }
 
-    while (*ptr != '\0')
-    {
-        int next = 0;
-        GetCodepointNext(ptr, &next);
+            continue;
+        }
+#endif
+        int codepointSize = 0;
+        int codepoint = GetCodepointNext(text + i, &codepointSize);
 
-        ptr += next;
+        if (codepoints != NULL) codepoints[count] = codepoint;
 
-        length++;
+        i += codepointSize;
+        count++;
     }
 
-    return length;
+    return count;
 }
 
-// Encode codepoint into utf8 text (char array length returned as parameter)
-// NOTE: It uses a static array to store UTF-8 bytes
-const char *CodepointToUTF8(int codepoint, int *utf8Size)
+// Write text bytes into buffer at position, truncated to buffer size (including '\0')
+static void WriteTextBuffer(char *buffer, int bufferSize, int position, const char *text, int length)
 {
-    static char utf8[6] = { 0 };
-    int size = 0;   // Byte size of codepoint
-
-    if (codepoint <= 0x7f)
-    {
-        utf8[0] = (char)codepoint;
-        size = 1;
-    }
-    else if (codepoint <= 0x7ff)
-    {
-        utf8[0] = (char)(((codepoint >> 6) & 0x1f) | 0xc0);
-        utf8[1] = (char)((codepoint & 0x3f) | 0x80);
-        size = 2;
-    }
-    else if (codepoint <= 0xffff)
-    {
-        utf8[0] = (char)(((codepoint >> 12) & 0x0f) | 0xe0);
-        utf8[1] = (char)(((codepoint >>  6) & 0x3f) | 0x80);
-        utf8[2] = (char)((codepoint & 0x3f) | 0x80);
-        size = 3;
-    }
-    else if (codepoint <= 0x10ffff)
-    {
-        utf8[0] = (char)(((codepoint >> 18) & 0x07) | 0xf0);
-        utf8[1] = (char)(((codepoint >> 12) & 0x3f) | 0x80);
-        utf8[2] = (char)(((codepoint >>  6) & 0x3f) | 0x80);
-        utf8[3] = (char)((codepoint & 0x3f) | 0x80);
-        size = 4;
-    }
-
-    *utf8Size = size;
+    if (position + length > (bufferSize - 1)) length = bufferSize - 1 - position;
 
-    return utf8;
+    if (length > 0) memcpy(buffer + position, text, length);
 }
-#endif      // SUPPORT_TEXT_MANIPULATION
 
-// Get next codepoint in a UTF-8 encoded text, scanning until '\0' is found
-// When an invalid UTF-8 byte is encountered we exit as soon as possible and a '?'(0x3f) codepoint is returned
-// Total number of bytes processed are returned as a parameter
-// NOTE: The standard says U+FFFD should be returned in case of errors
-// but that character is not supported by the default font in raylib
-int GetCodepoint(const char *text, int *codepointSize)
+// Write text buffer '\0' ending, truncated to buffer size
+static void EndTextBuffer(char *buffer, int bufferSize, int length)
 {
-/*
-    UTF-8 specs from https://www.ietf.org/rfc/rfc3629.txt
-
-    Char. number range  |        UTF-8 octet sequence
-      (hexadecimal)    |              (binary)
-    --------------------+---------------------------------------------
-    0000 0000-0000 007F | 0xxxxxxx
-    0000 0080-0000 07FF | 110xxxxx 10xxxxxx
-    0000 0800-0000 FFFF | 1110xxxx 10xxxxxx 10xxxxxx
-    0001 0000-0010 FFFF | 11110xxx 10xxxxxx 10xxxxxx 10xxxxxx
-*/
-    // NOTE: on decode errors we return as soon as possible
+    if (bufferSize > 0) buffer[(length < bufferSize)? length : (bufferSize - 1)] = '\0';
+}
 
-    int codepoint = 0x3f;   // Codepoint (defaults to '?')
-    int octet = (unsigned char)(text[0]); // The first UTF8 octet
-    *codepointSize = 1;
+#if defined(SUPPORT_FILEFORMAT_TTF)
+// Load font shaping data from TTF font data, kerning pairs extracted between provided codepoints
+// NOTE: Kerning table (kern) is used if available, otherwise pairs are queried one by one (GPOS)
+static rFontShaping *LoadFontShapingTTF(const unsigned char *fileData, int fontSize, const int *codepoints, int codepointCount)
+{
+    rFontShaping *shaping = NULL;
+    stbtt_fontinfo fontInfo = { 0 };
 
-    if (octet <= 0x7f)
-    {
-        // Only one octet (ASCII range x00-7F)
-        codepoint = text[0];
-    }
-    else if ((octet & 0xe0) == 0xc0)
-    {
-        // Two octets
+    if ((fileData == NULL) || !stbtt_InitFont(&fontInfo, (unsigned char *)fileData, 0)) return NULL;
 
-        // [0]xC2-DF    [1]UTF8-tail(x80-BF)
-        unsigned char octet1 = text[1];
+    float scale = stbtt_ScaleForPixelHeight(&fontInfo, (float)fontSize);
 
-        if ((octet1 == '\0') || ((octet1 >> 6) != 2)) { *codepointSize = 2; return codepoint; } // Unexpected sequence
+    // Keep codepoints available in the font with their glyph index
+    int *available = (int *)RL_MALLOC(codepointCount*sizeof(int));
+    int *glyphIndices = (int *)RL_MALLOC(codepointCount*sizeof(int));
+    int availableCount = 0;
 
-        if ((octet >= 0xc2) && (octet <= 0xdf))
-        {
-            codepoint = ((octet & 0x1f) << 6) | (octet1 & 0x3f);
-            *codepointSize = 2;
-        }
-    }
-    else if ((octet & 0xf0) == 0xe0)
+    for (int i = 0; i < codepointCount; i++)
     {
-        // Three octets
-        unsigned char octet1 = text[1];
-        unsigned char octet2 = '\0';
-
-        if ((octet1 == '\0') || ((octet1 >> 6) != 2)) { *codepointSize = 2; return codepoint; } // Unexpected sequence
-
-        octet2 = text[2];
-
-        if ((octet2 == '\0') || ((octet2 >> 6) != 2)) { *codepointSize = 3; return codepoint; } // Unexpected sequence
-
-        // [0]xE0    [1]xA0-BF       [2]UTF8-tail(x80-BF)
-        // [0]xE1-EC [1]UTF8-tail    [2]UTF8-tail(x80-BF)
-        // [0]xED    [1]x80-9F       [2]UTF8-tail(x80-BF)
-        // [0]xEE-EF [1]UTF8-tail    [2]UTF8-tail(x80-BF)
-
-        if (((octet == 0xe0) && !((octet1 >= 0xa0) && (octet1 <= 0xbf))) ||
-            ((octet == 0xed) && !((octet1 >= 0x80) && (octet1 <= 0x9f)))) { *codepointSize = 2; return codepoint; }
+        int index = stbtt_FindGlyphIndex(&fontInfo, codepoints[i]);
 
-        if ((octet >= 0xe0) && (octet <= 0xef))
+        if (index > 0)
         {
-            codepoint = ((octet & 0xf) << 12) | ((octet1 & 0x3f) << 6) | (octet2 & 0x3f);
-            *codepointSize = 3;
+            available[availableCount] = codepoints[i];
+            glyphIndices[availableCount] = index;
+            availableCount++;
         }
     }
-    else if ((octet & 0xf8) == 0xf0)
-    {
-        // Four octets
-        if (octet > 0xf4) return codepoint;
-
-        unsigned char octet1 = text[1];
-        unsigned char octet2 = '\0';
-        unsigned char octet3 = '\0';
-
-        if ((octet1 == '\0') || ((octet1 >> 6) != 2)) { *codepointSize = 2; return codepoint; }  // Unexpected sequence
-
-        octet2 = text[2];
-
-        if ((octet2 == '\0') || ((octet2 >> 6) != 2)) { *codepointSize = 3; return codepoint; }  // Unexpected sequence
-
-        octet3 = text[3];
 
-        if ((octet3 == '\0') || ((octet3 >> 6) != 2)) { *codepointSize = 4; return codepoint; }  // Unexpected sequence
+    FontKerningPair *pairs = NULL;
+    int pairCount = 0;
+    int pairCapacity = 0;
+    int tableLength = stbtt_GetKerningTableLength(&fontInfo);
 
-        // [0]xF0       [1]x90-BF       [2]UTF8-tail  [3]UTF8-tail
-        // [0]xF1-F3    [1]UTF8-tail    [2]UTF8-tail  [3]UTF8-tail
-        // [0]xF4       [1]x80-8F       [2]UTF8-tail  [3]UTF8-tail
+    if (tableLength > 0)
+    {
+        stbtt_kerningentry *table = (stbtt_kerningentry *)RL_MALLOC(tableLength*sizeof(stbtt_kerningentry));
+        tableLength = stbtt_GetKerningTable(&fontInfo, table, tableLength);
 
-        if (((octet == 0xf0) && !((octet1 >= 0x90) && (octet1 <= 0xbf))) ||
-            ((octet == 0xf4) && !((octet1 >= 0x80) && (octet1 <= 0x8f)))) { *codepointSize = 2; return codepoint; } // Unexpected sequence
+        // Kerning table uses glyph indices, codepoints sharing a glyph are chained
+        int *glyphFirst = (int *)RL_MALLOC(fontInfo.numGlyphs*sizeof(int));
+        int *codepointNext = (int *)RL_MALLOC((availableCount + 1)*sizeof(int));
+        for (int i = 0; i < fontInfo.numGlyphs; i++) glyphFirst[i] = -1;
 
-        if (octet >= 0xf0)
+        for (int i = availableCount - 1; i >= 0; i--)
         {
-            codepoint = ((octet & 0x7) << 18) | ((octet1 & 0x3f) << 12) | ((octet2 & 0x3f) << 6) | (octet3 & 0x3f);
-            *codepointSize = 4;
+            if (glyphIndices[i] >= fontInfo.numGlyphs) continue;
+            codepointNext[i] = glyphFirst[glyphIndices[i]];
+            glyphFirst[glyphIndices[i]] = i;
         }
-    }
 
-    if (codepoint > 0x10ffff) codepoint = 0x3f;     // Codepoints after U+10ffff are invalid
+        for (int t = 0; t < tableLength; t++)
+        {
+            if ((table[t].advance == 0) || (table[t].glyph1 >= fontInfo.numGlyphs) || (table[t].glyph2 >= fontInfo.numGlyphs)) continue;
 
-    return codepoint;
-}
+            for (int a = glyphFirst[table[t].glyph1]; a != -1; a = codepointNext[a])
+            {
+                for (int b = glyphFirst[table[t].glyph2]; b != -1; b = codepointNext[b])
+                {
+                    if (pairCount == pairCapacity)
+                    {
+                        pairCapacity = (pairCapacity > 0)? 2*pairCapacity : 256;
+                        pairs = (FontKerningPair *)RL_REALLOC(pairs, pairCapacity*sizeof(FontKerningPair));
+                    }
 
-// Get next codepoint in a byte sequence and bytes processed
-int GetCodepointNext(const char *text, int *codepointSize)
-{
-    const char *ptr = text;
-    int codepoint = 0x3f;       // Codepoint (defaults to '?')
-    *codepointSize = 1;
+                    pairs[pairCount++] = (FontKerningPair){ available[a], available[b], (float)table[t].advance*scale };
+                }
+            }
+        }
 
-    // Get current codepoint and bytes processed
-    if (0xf0 == (0xf8 & ptr[0]))
-    {
-        // 4 byte UTF-8 codepoint
-        if (((ptr[1] & 0xC0) ^ 0x80) || ((ptr[2] & 0xC0) ^ 0x80) || ((ptr[3] & 0xC0) ^ 0x80)) { return codepoint; } // 10xxxxxx checks
-        codepoint = ((0x07 & ptr[0]) << 18) | ((0x3f & ptr[1]) << 12) | ((0x3f & ptr[2]) << 6) | (0x3f & ptr[3]);
-        *codepointSize = 4;
+        RL_FREE(codepointNext);
+        RL_FREE(glyphFirst);
+        RL_FREE(table);
     }
-    else if (0xe0 == (0xf0 & ptr[0]))
-    {
-        // 3 byte UTF-8 codepoint */
-        if (((ptr[1] & 0xC0) ^ 0x80) || ((ptr[2] & 0xC0) ^ 0x80)) { return codepoint; } // 10xxxxxx checks
-        codepoint = ((0x0f & ptr[0]) << 12) | ((0x3f & ptr[1]) << 6) | (0x3f & ptr[2]);
-        *codepointSize = 3;
-    }
-    else if (0xc0 == (0xe0 & ptr[0]))
+    else if ((fontInfo.gpos != 0) && (availableCount <= FONT_KERNING_MAX_QUERY_GLYPHS))
     {
-        // 2 byte UTF-8 codepoint
-        if ((ptr[1] & 0xC0) ^ 0x80) { return codepoint; } // 10xxxxxx checks
-        codepoint = ((0x1f & ptr[0]) << 6) | (0x3f & ptr[1]);
-        *codepointSize = 2;
-    }
-    else if (0x00 == (0x80 & ptr[0]))
-    {
-        // 1 byte UTF-8 codepoint
-        codepoint = ptr[0];
-        *codepointSize = 1;
-    }
+        for (int a = 0; a < availableCount; a++)
+        {
+            for (int b = 0; b < availableCount; b++)
+            {
+                int advance = stbtt_GetGlyphKernAdvance(&fontInfo, glyphIndices[a], glyphIndices[b]);
 
-    return codepoint;
-}
+                if (advance != 0)
+                {
+                    if (pairCount == pairCapacity)
+                    {
+                        pairCapacity = (pairCapacity > 0)? 2*pairCapacity : 256;
+                        pairs = (FontKerningPair *)RL_REALLOC(pairs, pairCapacity*sizeof(FontKerningPair));
+                    }
 
-// Get previous codepoint in a byte sequence and bytes processed
-int GetCodepointPrevious(const char *text, int *codepointSize)
-{
-    const char *ptr = text;
-    int codepoint = 0x3f;       // Codepoint (defaults to '?')
-    int cpSize = 0;
-    *codepointSize = 0;
+                    pairs[pairCount++] = (FontKerningPair){ available[a], available[b], (float)advance*scale };
+                }
+            }
+        }
+    }
 
-    // Move to previous codepoint
-    do ptr--;
-    while (((0x80 & ptr[0]) != 0) && ((0xc0 & ptr[0]) ==  0x80));
+    shaping = LoadFontShaping(pairs, pairCount, available, availableCount);
 
-    codepoint = GetCodepointNext(ptr, &cpSize);
+    if (shaping != NULL) TRACELOGD("FONT: Text shaping data loaded (%i kerning pairs | ligatures mask: 0x%02x)", shaping->pairCount, shaping->ligatures);
 
-    if (codepoint != 0) *codepointSize = cpSize;
+    RL_FREE(pairs);
+    RL_FREE(glyphIndices);
+    RL_FREE(available);
 
-    return codepoint;
+    return shaping;
 }
+#endif
 
-//----------------------------------------------------------------------------------
-// Module specific Functions Definition
-//----------------------------------------------------------------------------------
 #if defined(SUPPORT_FILEFORMAT_FNT) || defined(SUPPORT_FILEFORMAT_BDF)
 // Read a line from memory
 // REQUIRES: memcpy()
@@ -2141,7 +5085,7 @@ int GetCodepointPrevious(const char *text, int *codepointSize)
 static int GetLine(const char *origin, char *buffer, int maxLength)
 {
     int count = 0;
-    for (; count < maxLength - 1; count++) if (origin[count] == '\n') break;
+    for (; count < maxLength - 1; count++) if ((origin[count] == '\n') || (origin[count] == '\0')) break;
     memcpy(buffer, origin, count);
     buffer[count] = '\0';
     return count;
@@ -2302,6 +5246,46 @@ static Font LoadBMFont(const char *fileName)
         }
     }
 
+    // Kerning pairs are optional, defined after characters
+    const char *fileTextEnd = fileText + strlen(fileText);
+    FontKerningPair *pairs = NULL;
+    int pairCount = 0;
+    int kerningCount = 0;
+
+    // MSDF fonts are marked with a distance field line, exported by ExportFontAsBMFont() at file end
+    if (strstr(fileTextPtr, "fieldType=msdf") != NULL) font.type = FONT_MSDF;
+
+    if (fileTextPtr < fileTextEnd)
+    {
+        readBytes = GetLine(fileTextPtr, buffer, MAX_BUFFER_SIZE);
+        searchPoint = strstr(buffer, "kernings");
+        fileTextPtr += (readBytes + 1);
+
+        if ((searchPoint != NULL) && (sscanf(searchPoint, "kernings count=%i", &kerningCount) == 1) && (kerningCount > 0))
+        {
+            pairs = (FontKerningPair *)RL_MALLOC(kerningCount*sizeof(FontKerningPair));
+
+            for (int i = 0; (i < kerningCount) && (fileTextPtr < fileTextEnd); i++)
+            {
+                int first = 0, second = 0, amount = 0;
+
+                readBytes = GetLine(fileTextPtr, buffer, MAX_BUFFER_SIZE);
+                readVars = sscanf(buffer, "kerning first=%i second=%i amount=%i", &first, &second, &amount);
+                fileTextPtr += (readBytes + 1);
+
+                if (readVars == 3) pairs[pairCount++] = (FontKerningPair){ first, second, (float)amount };
+            }
+        }
+    }
+
+    int *glyphCodepoints = (int *)RL_MALLOC(glyphCount*sizeof(int));
+    for (int i = 0; i < glyphCount; i++) glyphCodepoints[i] = font.glyphs[i].value;
+
+    font.shaping = LoadFontShaping(pairs, pairCount, glyphCodepoints, glyphCount);
+
+    RL_FREE(glyphCodepoints);
+    RL_FREE(pairs);
+
     UnloadImage(fullFont);
     UnloadFileText(fileText);
 
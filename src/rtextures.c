@@ -1590,10 +1590,18 @@ Image ImageTextEx(Font font, const char *text, float fontSize, float spacing, Co
 {
     Image imText = { 0 };
 #if defined(SUPPORT_MODULE_RTEXT)
+    // Dynamic fonts glyphs are only available in cache pages textures, no glyph images are kept
+    if (font.cache != NULL)
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: ImageTextEx() does not support dynamic fonts");
+        return imText;
+    }
+
     int size = (int)strlen(text);   // Get size in bytes of text
 
-    int textOffsetX = 0;            // Image drawing position X
+    float textOffsetX = 0.0f;       // Image drawing position X
     int textOffsetY = 0;            // Offset between lines (on linebreak '\n')
+    int previousCodepoint = 0;      // Previous codepoint in line, required for kerning
 
     // NOTE: Text image is generated at font base size, later scaled to desired font size
     Vector2 imSize = MeasureTextEx(font, text, (float)font.baseSize, spacing);  // WARNING: Module required: rtext
@@ -1605,27 +1613,33 @@ Image ImageTextEx(Font font, const char *text, float fontSize, float spacing, Co
     for (int i = 0; i < size;)
     {
         // Get next codepoint from byte string and glyph index in font
+        // NOTE: Ligatures and kerning are applied as MeasureTextEx() does
         int codepointByteCount = 0;
-        int codepoint = GetCodepointNext(&text[i], &codepointByteCount);    // WARNING: Module required: rtext
-        int index = GetGlyphIndex(font, codepoint);                         // WARNING: Module required: rtext
+        int codepoint = GetGlyphCodepointNext(font, &text[i], &codepointByteCount);    // WARNING: Module required: rtext
+        int index = GetGlyphIndex(font, codepoint);                                     // WARNING: Module required: rtext
 
         if (codepoint == '\n')
         {
             // NOTE: Fixed line spacing of 1.5 line-height
             // TODO: Support custom line spacing defined by user
             textOffsetY += (font.baseSize + font.baseSize/2);
-            textOffsetX = 0;
+            textOffsetX = 0.0f;
+            previousCodepoint = 0;
         }
         else
         {
+            if (previousCodepoint != 0) textOffsetX += GetGlyphKerning(font, previousCodepoint, codepoint); // WARNING: Module required: rtext
+
             if ((codepoint != ' ') && (codepoint != '\t'))
             {
-                Rectangle rec = { (float)(textOffsetX + font.glyphs[index].offsetX), (float)(textOffsetY + font.glyphs[index].offsetY), (float)font.recs[index].width, (float)font.recs[index].height };
+                Rectangle rec = { (float)((int)textOffsetX + font.glyphs[index].offsetX), (float)(textOffsetY + font.glyphs[index].offsetY), (float)font.recs[index].width, (float)font.recs[index].height };
                 ImageDraw(&imText, font.glyphs[index].image, (Rectangle){ 0, 0, (float)font.glyphs[index].image.width, (float)font.glyphs[index].image.height }, rec, tint);
             }
 
-            if (font.glyphs[index].advanceX == 0) textOffsetX += (int)(font.recs[index].width + spacing);
-            else textOffsetX += font.glyphs[index].advanceX + (int)spacing;
+            if (font.glyphs[index].advanceX == 0) textOffsetX += (float)(int)(font.recs[index].width + spacing);
+            else textOffsetX += (float)(font.glyphs[index].advanceX + (int)spacing);
+
+            previousCodepoint = codepoint;
         }
 
         i += codepointByteCount;   // Move text bytes counter to next codepoint